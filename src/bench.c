@@ -0,0 +1,70 @@
+/*
+ *  bench.c - Benchmark helpers
+ *
+ *  hwdecode-demos (C) 2009-2010 Splitted-Desktop Systems
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "sysdeps.h"
+#include "bench.h"
+#include "common.h"
+#include "debug.h"
+#include "utils.h"
+
+/* Tests run for at least that long */
+#define BENCH_MIN_USEC 500000
+
+/* The benchmarks do not link common.c, so they provide the default
+   context of the demos */
+static CommonContext g_common_context = {
+    .color_matrix       = COLOR_MATRIX_BT601,
+    .color_range        = COLOR_RANGE_LIMITED,
+};
+
+CommonContext *common_get_context(void)
+{
+    return &g_common_context;
+}
+
+/* Debug messages are dropped, they would be printed for each run */
+void debug_printf(const char *msg, ...)
+{
+}
+
+double bench_run(BenchFunc func, void *data)
+{
+    uint64_t start, elapsed;
+    unsigned int runs = 0;
+
+    func(data);
+
+    start = get_ticks_usec();
+    do {
+        func(data);
+        runs++;
+        elapsed = get_ticks_usec() - start;
+    } while (elapsed < BENCH_MIN_USEC);
+    return (double)elapsed / runs;
+}
+
+void bench_report(const char *name, double usec, uint64_t bytes)
+{
+    if (bytes > 0)
+        printf("%-32s %10.3f ms %10.1f MB/s\n", name, usec / 1000.0,
+               bytes / usec);
+    else
+        printf("%-32s %10.3f ms\n", name, usec / 1000.0);
+}
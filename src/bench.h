@@ -0,0 +1,36 @@
+/*
+ *  bench.h - Benchmark helpers
+ *
+ *  hwdecode-demos (C) 2009-2010 Splitted-Desktop Systems
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <stdint.h>
+
+typedef void (*BenchFunc)(void *data);
+
+// Runs FUNC once to warm up, then repeatedly for at least half a second,
+// and returns the mean time per run in microseconds
+double bench_run(BenchFunc func, void *data);
+
+// Prints the mean time per run of test NAME, and the throughput if BYTES
+// are processed per run
+void bench_report(const char *name, double usec, uint64_t bytes);
+
+#endif /* BENCH_H */
@@ -0,0 +1,357 @@
+/*
+ *  bench_bits.c - Bitstream reader benchmarks
+ *
+ *  hwdecode-demos (C) 2009-2010 Splitted-Desktop Systems
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "sysdeps.h"
+#include "bench.h"
+#include "get_bits.h"
+#include "put_bits.h"
+#include "h264.h"
+#include "mpeg2.h"
+#include "input.h"
+#include "utils.h"
+#include <getopt.h>
+
+/* Slices past that much data are left out, runs would take seconds */
+#define BITS_DATA_MAX (256 << 20)
+
+/* Size of the synthetic Exp-Golomb stream, only used as a check */
+#define BITS_CHECK_SIZE (1 << 20)
+
+typedef struct _BitsUnit BitsUnit;
+
+struct _BitsUnit {
+    const uint8_t      *data;
+    unsigned int        size;
+};
+
+typedef struct _BitsArgs BitsArgs;
+
+struct _BitsArgs {
+    BitsUnit           *units;          // slices, starting with their header
+    unsigned int        num_units;
+    unsigned int        units_size;
+    uint64_t            size;           // total size of the units
+    uint32_t            sum;            // sum of the values read
+};
+
+/* Reads each unit with widths of 1 to 32 bits */
+static void read_bits(void *data)
+{
+    BitsArgs * const args = data;
+    GetBitContext gb;
+    unsigned int i, n = 0;
+    uint32_t sum = 0;
+
+    for (i = 0; i < args->num_units; i++) {
+        init_get_bits(&gb, args->units[i].data, args->units[i].size);
+        while (get_bits_left(&gb) > 0) {
+            sum += get_bits(&gb, 1 + n);
+            n = (n + 7) % 32;
+        }
+    }
+    args->sum = sum;
+}
+
+static void read_bits1(void *data)
+{
+    BitsArgs * const args = data;
+    GetBitContext gb;
+    unsigned int i;
+    uint32_t sum = 0;
+
+    for (i = 0; i < args->num_units; i++) {
+        init_get_bits(&gb, args->units[i].data, args->units[i].size);
+        while (get_bits_left(&gb) > 0)
+            sum += get_bits1(&gb);
+    }
+    args->sum = sum;
+}
+
+/* Reads Exp-Golomb codes past the NAL unit header: the slice header, then
+   slice data read the same way */
+static void read_ue_golomb(void *data)
+{
+    BitsArgs * const args = data;
+    GetBitContext gb;
+    unsigned int i;
+    uint32_t sum = 0;
+
+    for (i = 0; i < args->num_units; i++) {
+        init_get_bits(&gb, args->units[i].data, args->units[i].size);
+        skip_bits(&gb, 8);
+        while (get_bits_left(&gb) >= 2 * 32 + 1)
+            sum += get_ue_golomb(&gb);
+    }
+    args->sum = sum;
+}
+
+/* Bit by bit Exp-Golomb decoding, as a reference */
+static void read_ue_golomb_naive(void *data)
+{
+    BitsArgs * const args = data;
+    GetBitContext gb;
+    unsigned int i, n;
+    uint32_t sum = 0;
+
+    for (i = 0; i < args->num_units; i++) {
+        init_get_bits(&gb, args->units[i].data, args->units[i].size);
+        skip_bits(&gb, 8);
+        while (get_bits_left(&gb) >= 2 * 32 + 1) {
+            for (n = 0; n < 32 && !get_bits1(&gb); n++)
+                ;
+            if (n == 32)
+                sum += UINT32_MAX;
+            else
+                sum += ((1ULL << n) | get_bits(&gb, n)) - 1;
+        }
+    }
+    args->sum = sum;
+}
+
+static int add_unit(BitsArgs *args, const uint8_t *data, unsigned int size)
+{
+    BitsUnit *units;
+
+    if (args->size + size > BITS_DATA_MAX)
+        return 0;
+
+    units = fast_realloc(args->units, &args->units_size,
+                         (args->num_units + 1) * sizeof(*units));
+    if (!units)
+        return -1;
+    args->units = units;
+
+    units[args->num_units].data = data;
+    units[args->num_units].size = size;
+    args->num_units++;
+    args->size += size;
+    return 1;
+}
+
+static int get_h264_slices(BitsArgs *args)
+{
+    H264Parser *parser;
+    H264Picture picture;
+    const uint8_t *data;
+    size_t size;
+    unsigned int i;
+    int ret;
+
+    h264_get_video_data(&data, &size);
+    parser = h264_parser_new(data, size);
+    if (!parser)
+        return -1;
+
+    while ((ret = h264_parser_get_picture(parser, &picture)) > 0) {
+        for (i = 0; i < picture.slice_count && ret > 0; i++)
+            ret = add_unit(args, data + picture.slices[i].slice_data_offset,
+                           picture.slices[i].slice_data_size);
+        if (ret <= 0)
+            break;
+    }
+    h264_parser_destroy(parser);
+    return ret;
+}
+
+static int get_mpeg2_slices(BitsArgs *args)
+{
+    MPEG2Parser *parser;
+    MPEG2Picture picture;
+    const uint8_t *data;
+    size_t size;
+    unsigned int i;
+    int ret;
+
+    mpeg2_get_video_data(&data, &size);
+    parser = mpeg2_parser_new(data, size);
+    if (!parser)
+        return -1;
+
+    while ((ret = mpeg2_parser_get_picture(parser, &picture)) > 0) {
+        for (i = 0; i < picture.slice_count && ret > 0; i++)
+            ret = add_unit(args, data + picture.slices[i].slice_data_offset,
+                           picture.slices[i].slice_data_size);
+        if (ret <= 0)
+            break;
+    }
+    mpeg2_parser_destroy(parser);
+    return ret;
+}
+
+/* Exp-Golomb codes are only timed on H.264 slices, whose headers use them */
+static const struct {
+    const char  *name;
+    int        (*get_slices)(BitsArgs *args);
+    unsigned int has_golomb;
+}
+g_codecs[] = {
+    { "h264",   get_h264_slices,        1 },
+    { "mpeg2",  get_mpeg2_slices,       0 },
+};
+
+static int run_codec_tests(unsigned int codec)
+{
+    BitsArgs args;
+    uint32_t sum;
+    double usec;
+    int error = -1;
+
+    memset(&args, 0, sizeof(args));
+    if (g_codecs[codec].get_slices(&args) < 0 || args.num_units == 0) {
+        fprintf(stderr, "ERROR: could not parse %s slices\n",
+                g_codecs[codec].name);
+        goto end;
+    }
+    printf("%s: %u slices, %.1f KB\n", g_codecs[codec].name,
+           args.num_units, args.size / 1024.0);
+
+    bench_report("  get_bits(), 1 to 32 bits",
+                 bench_run(read_bits, &args), args.size);
+    bench_report("  get_bits1()",
+                 bench_run(read_bits1, &args), args.size);
+
+    if (g_codecs[codec].has_golomb) {
+        read_ue_golomb_naive(&args);
+        sum = args.sum;
+        usec = bench_run(read_ue_golomb, &args);
+        if (args.sum != sum) {
+            fprintf(stderr, "ERROR: get_ue_golomb() returned wrong values\n");
+            goto end;
+        }
+        bench_report("  get_ue_golomb()", usec, args.size);
+    }
+    error = 0;
+end:
+    free(args.units);
+    return error;
+}
+
+/* Fills BUF with Exp-Golomb codes of random values of up to 12 bits,
+   and returns the number of codes and the sum of their values */
+static unsigned int
+put_ue_golombs(uint8_t *buf, unsigned int size, uint32_t *psum)
+{
+    PutBitContext pb;
+    unsigned int count = 0, n;
+    uint32_t v, sum = 0;
+
+    init_put_bits(&pb, buf, size);
+    while (put_bits_count(&pb) + 2 * 13 + 32 <= 8 * size) {
+        v = gen_random_int() % (1U << (gen_random_int() % 13)) + 1;
+        for (n = 0; (v >> n) > 1; n++)
+            ;
+        put_bits(&pb, n, 0);
+        put_bits(&pb, n + 1, v);
+        sum += v - 1;
+        count++;
+    }
+    flush_put_bits(&pb);
+    *psum = sum;
+    return count;
+}
+
+/* Reads back codes written by put_ue_golombs() */
+static int check_ue_golomb(void)
+{
+    GetBitContext gb;
+    uint8_t *buf;
+    unsigned int i, count;
+    uint32_t sum, put_sum;
+
+    buf = malloc(BITS_CHECK_SIZE);
+    if (!buf)
+        return -1;
+
+    gen_random_seed(1);
+    count = put_ue_golombs(buf, BITS_CHECK_SIZE, &put_sum);
+    init_get_bits(&gb, buf, BITS_CHECK_SIZE);
+    for (i = 0, sum = 0; i < count; i++)
+        sum += get_ue_golomb(&gb);
+    free(buf);
+    return sum == put_sum ? 0 : -1;
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr, "Usage: %s [--input FILE] [CODEC]...\n", prog);
+    fprintf(stderr, "Reads the slices of the built-in h264 and mpeg2 clips, "
+            "or of FILE as CODEC\n");
+}
+
+int main(int argc, char *argv[])
+{
+    static const struct option options[] = {
+        { "input", required_argument, NULL, 'i' },
+        { NULL, }
+    };
+    const char *input_filename = NULL;
+    unsigned int i, codecs = 0;
+    int c, error = 0;
+
+    while ((c = getopt_long(argc, argv, "i:", options, NULL)) != -1) {
+        switch (c) {
+        case 'i':
+            input_filename = optarg;
+            break;
+        default:
+            usage(argv[0]);
+            return 1;
+        }
+    }
+    for (; optind < argc; optind++) {
+        for (i = 0; i < ARRAY_ELEMS(g_codecs); i++) {
+            if (strcmp(argv[optind], g_codecs[i].name) == 0)
+                break;
+        }
+        if (i == ARRAY_ELEMS(g_codecs)) {
+            usage(argv[0]);
+            return 1;
+        }
+        codecs |= 1U << i;
+    }
+
+    /* An input file holds a single codec */
+    if (input_filename) {
+        if (codecs == 0 || (codecs & (codecs - 1)) != 0) {
+            usage(argv[0]);
+            return 1;
+        }
+        if (input_open(input_filename) < 0) {
+            fprintf(stderr, "ERROR: could not map input file '%s'\n",
+                    input_filename);
+            return 1;
+        }
+    }
+    if (codecs == 0)
+        codecs = (1U << ARRAY_ELEMS(g_codecs)) - 1;
+
+    if (check_ue_golomb() < 0) {
+        fprintf(stderr, "ERROR: get_ue_golomb() does not read back "
+                "put_bits() codes\n");
+        return 1;
+    }
+
+    for (i = 0; i < ARRAY_ELEMS(g_codecs); i++) {
+        if ((codecs & (1U << i)) && run_codec_tests(i) < 0)
+            error = 1;
+    }
+    input_close();
+    return error;
+}
@@ -0,0 +1,228 @@
+/*
+ *  bench_image.c - Image conversion benchmarks
+ *
+ *  hwdecode-demos (C) 2009-2010 Splitted-Desktop Systems
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "sysdeps.h"
+#include "bench.h"
+#include "cpu.h"
+#include "image.h"
+#include "thread_pool.h"
+#include "utils.h"
+#include <unistd.h>
+
+typedef struct _ConvertTest ConvertTest;
+
+struct _ConvertTest {
+    const char         *name;
+    uint32_t            src_format;
+    uint32_t            dst_format;
+    unsigned int        src_flags;
+};
+
+/* Uncached sources are regular memory flagged as such, which only times
+   the streaming loads path. Write-combined memory is much slower to
+   read directly */
+static const ConvertTest g_convert_tests[] = {
+    { "RGB32 to ARGB",           IMAGE_RGB32, IMAGE_ARGB,  0 },
+    { "RGB32 to RGBA",           IMAGE_RGB32, IMAGE_RGBA,  0 },
+    { "RGB32 to ABGR",           IMAGE_RGB32, IMAGE_ABGR,  0 },
+    { "RGB32 to BGRA",           IMAGE_RGB32, IMAGE_BGRA,  0 },
+    { "NV12 to RGB32",           IMAGE_NV12,  IMAGE_RGB32, 0 },
+    { "I420 to RGB32",           IMAGE_I420,  IMAGE_RGB32, 0 },
+    { "NV12 copy",               IMAGE_NV12,  IMAGE_NV12,  0 },
+    { "NV12 copy, uncached",     IMAGE_NV12,  IMAGE_NV12,  IMAGE_FLAG_UNCACHED },
+    { "NV12 to RGB32, uncached", IMAGE_NV12,  IMAGE_RGB32, IMAGE_FLAG_UNCACHED },
+    { NULL, }
+};
+
+/* Kernel sets, from the C ones up. Each level is run if the host CPU
+   supports it, and its output is checked against the C one */
+static const struct {
+    const char  *name;
+    unsigned int features;
+}
+g_isa_levels[] = {
+    { "c",      0                                                         },
+    { "sse2",   CPU_FEATURE_SSE2                                          },
+    { "ssse3",  CPU_FEATURE_SSE2|CPU_FEATURE_SSSE3                        },
+    { "sse4.1", CPU_FEATURE_SSE2|CPU_FEATURE_SSSE3|CPU_FEATURE_SSE4_1     },
+    { "avx2",   CPU_FEATURE_SSE2|CPU_FEATURE_SSSE3|CPU_FEATURE_SSE4_1|
+                CPU_FEATURE_SSE4_2|CPU_FEATURE_AVX2                       },
+    { "neon",   CPU_FEATURE_NEON                                          },
+};
+
+typedef struct _ConvertArgs ConvertArgs;
+
+struct _ConvertArgs {
+    Image              *src_img;
+    Image              *dst_img;
+    int                 error;
+};
+
+static void convert(void *data)
+{
+    ConvertArgs * const args = data;
+
+    if (image_convert(args->dst_img, args->src_img) < 0)
+        args->error = -1;
+}
+
+static void fill_random(Image *img)
+{
+    unsigned int i;
+
+    for (i = 0; i < img->data_size; i++)
+        img->data[i] = gen_random_int();
+}
+
+/* Runs TEST with each kernel set on one thread, then with the best one
+   on 1 to MAX_THREADS threads */
+static int run_convert_test(const ConvertTest *test,
+                            unsigned int width, unsigned int height,
+                            unsigned int max_threads)
+{
+    const unsigned int features = cpu_get_features();
+    ConvertArgs args;
+    uint8_t *ref_data = NULL;
+    unsigned int i, data_size;
+    char name[64];
+    double usec, serial_usec = 0.0;
+    int error = -1;
+
+    args.src_img = image_create(width, height, test->src_format);
+    args.dst_img = image_create(width, height, test->dst_format);
+    if (!args.src_img || !args.dst_img)
+        goto end;
+    fill_random(args.src_img);
+    args.src_img->flags |= test->src_flags;
+
+    /* Reference output, from the C kernels */
+    data_size = args.dst_img->data_size;
+    ref_data = malloc(data_size);
+    if (!ref_data)
+        goto end;
+    cpu_set_features_mask(0);
+    args.error = 0;
+    convert(&args);
+    if (args.error < 0)
+        goto end;
+    memcpy(ref_data, args.dst_img->data, data_size);
+
+    printf("%s\n", test->name);
+    for (i = 0; i < ARRAY_ELEMS(g_isa_levels); i++) {
+        if ((features & g_isa_levels[i].features) != g_isa_levels[i].features)
+            continue;
+        cpu_set_features_mask(g_isa_levels[i].features);
+        args.error = 0;
+        usec = bench_run(convert, &args);
+        if (args.error < 0)
+            goto end;
+        if (memcmp(args.dst_img->data, ref_data, data_size) != 0) {
+            fprintf(stderr, "ERROR: %s kernels do not match the C ones\n",
+                    g_isa_levels[i].name);
+            goto end;
+        }
+        snprintf(name, sizeof(name), "  %s", g_isa_levels[i].name);
+        bench_report(name, usec, args.src_img->data_size);
+    }
+    cpu_set_features_mask(~0U);
+
+    /* Bands split across threads must not change the 1-thread output,
+       which matched the C one above */
+    for (i = 1; max_threads > 1 && i <= max_threads; i++) {
+        if (thread_pool_init(i) < 0)
+            goto end;
+        args.error = 0;
+        usec = bench_run(convert, &args);
+        thread_pool_exit();
+        if (args.error < 0)
+            goto end;
+        if (memcmp(args.dst_img->data, ref_data, data_size) != 0) {
+            fprintf(stderr, "ERROR: %u-thread output does not match the "
+                    "1-thread one\n", i);
+            goto end;
+        }
+        if (i == 1)
+            serial_usec = usec;
+        snprintf(name, sizeof(name), "  %u thread(s), %.2fx", i,
+                 serial_usec / usec);
+        bench_report(name, usec, args.src_img->data_size);
+    }
+    error = 0;
+end:
+    cpu_set_features_mask(~0U);
+    thread_pool_exit();
+    free(ref_data);
+    if (args.dst_img)
+        image_destroy(args.dst_img);
+    if (args.src_img)
+        image_destroy(args.src_img);
+    return error;
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr, "Usage: %s [-t THREADS] [WIDTHxHEIGHT]\n", prog);
+    fprintf(stderr, "Conversions run with 1 to THREADS threads, by default "
+            "one per CPU\n");
+}
+
+int main(int argc, char *argv[])
+{
+    unsigned int i, width = 1920, height = 1080, num_threads = 0;
+    int c;
+
+    while ((c = getopt(argc, argv, "t:")) != -1) {
+        switch (c) {
+        case 't':
+            num_threads = atoi(optarg);
+            break;
+        default:
+            usage(argv[0]);
+            return 1;
+        }
+    }
+    if (optind < argc &&
+        sscanf(argv[optind], "%ux%u", &width, &height) != 2) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    /* Conversions are split into bands run by the pool, as with the
+       --threads option of the demos. 0 selects a thread per CPU */
+    if (thread_pool_init(num_threads) < 0)
+        return 1;
+    num_threads = thread_pool_get_size();
+    thread_pool_exit();
+
+    printf("CPU features: %s\n", cpu_get_features_string());
+    printf("Image size: %ux%u, up to %u thread(s)\n", width, height,
+           num_threads);
+
+    gen_random_seed(1);
+    for (i = 0; g_convert_tests[i].name; i++) {
+        if (run_convert_test(&g_convert_tests[i], width, height,
+                             num_threads) < 0) {
+            fprintf(stderr, "ERROR: %s test failed\n", g_convert_tests[i].name);
+            return 1;
+        }
+    }
+    image_exit();
+    return 0;
+}
@@ -0,0 +1,102 @@
+/*
+ *  bench_jpeg.c - JPEG parser benchmarks
+ *
+ *  hwdecode-demos (C) 2009-2010 Splitted-Desktop Systems
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "sysdeps.h"
+#include "bench.h"
+#include "input.h"
+#include "jpeg.h"
+#include <sys/stat.h>
+
+typedef struct _JPEGArgs JPEGArgs;
+
+struct _JPEGArgs {
+    const char         *dirname;        // or parse buf
+    const uint8_t      *buf;
+    size_t              size;
+    unsigned int        count;          // number of images parsed
+    uint64_t            bytes;          // size of the images parsed
+    int                 error;
+};
+
+/* Parses every image of the input, as a decoder would */
+static void parse(void *data)
+{
+    JPEGArgs * const args = data;
+    JPEGParser *parser;
+    JPEGPicture picture;
+    int ret;
+
+    if (args->dirname)
+        parser = jpeg_parser_open_dir(args->dirname);
+    else
+        parser = jpeg_parser_new(args->buf, args->size);
+    if (!parser) {
+        args->error = -1;
+        return;
+    }
+
+    args->count = 0;
+    args->bytes = 0;
+    while ((ret = jpeg_parser_get_picture(parser, &picture)) > 0) {
+        args->count++;
+        args->bytes += picture.data_size;
+    }
+    if (ret < 0)
+        args->error = -1;
+    jpeg_parser_destroy(parser);
+}
+
+int main(int argc, char *argv[])
+{
+    JPEGArgs args;
+    struct stat st;
+    double usec;
+
+    memset(&args, 0, sizeof(args));
+    if (argc > 2) {
+        fprintf(stderr, "Usage: %s [DIRECTORY|FILE]\n", argv[0]);
+        fprintf(stderr, "Parses the .jpg and .jpeg files of DIRECTORY, a JPEG "
+                "or MJPEG FILE, or the built-in image\n");
+        return 1;
+    }
+
+    if (argc == 2) {
+        if (stat(argv[1], &st) == 0 && S_ISDIR(st.st_mode))
+            args.dirname = argv[1];
+        else if (input_open(argv[1]) < 0) {
+            fprintf(stderr, "ERROR: could not map input file '%s'\n", argv[1]);
+            return 1;
+        }
+    }
+    if (!args.dirname)
+        jpeg_get_video_data(&args.buf, &args.size);
+
+    usec = bench_run(parse, &args);
+    if (args.error < 0 || args.count == 0) {
+        fprintf(stderr, "ERROR: could not parse JPEG images\n");
+        return 1;
+    }
+    bench_report("jpeg_parser_get_picture()", usec, args.bytes);
+    printf("%u images, %.1f images per second\n",
+           args.count, args.count * 1000000.0 / usec);
+
+    input_close();
+    return 0;
+}
@@ -0,0 +1,108 @@
+/*
+ *  bench_startcode.c - Start code scanner benchmarks
+ *
+ *  hwdecode-demos (C) 2009-2010 Splitted-Desktop Systems
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "sysdeps.h"
+#include "bench.h"
+#include "cpu.h"
+#include "input.h"
+#include "startcode.h"
+
+/* Input streams are repeated up to that size, so that they do not fit
+   in caches */
+#define STREAM_SIZE (64 << 20)
+
+typedef struct _StartCodeArgs StartCodeArgs;
+
+struct _StartCodeArgs {
+    const uint8_t      *buf;
+    unsigned int        size;
+    int                 count;          // number of units found
+};
+
+/* Byte by byte scan, as a reference */
+static void split_naive(void *data)
+{
+    StartCodeArgs * const args = data;
+    const uint8_t * const buf = args->buf;
+    unsigned int i;
+    int count = 0;
+
+    for (i = 0; i + 3 <= args->size; i++) {
+        if (buf[i] == 0 && buf[i + 1] == 0 && buf[i + 2] == 1)
+            count++;
+    }
+    args->count = count;
+}
+
+static void split(void *data)
+{
+    StartCodeArgs * const args = data;
+    StartCodeUnit *units;
+
+    args->count = startcode_split(args->buf, args->size, &units);
+    free(units);
+}
+
+int main(int argc, char *argv[])
+{
+    StartCodeArgs args;
+    const uint8_t *data;
+    size_t data_size;
+    unsigned int pos, n;
+    uint8_t *buf;
+    int naive_count;
+
+    if (argc != 2) {
+        fprintf(stderr, "Usage: %s FILE\n", argv[0]);
+        fprintf(stderr, "FILE is an H.264, MPEG-2 or VC-1 elementary stream\n");
+        return 1;
+    }
+
+    if (input_open(argv[1]) < 0 || !input_get_data(&data, &data_size)) {
+        fprintf(stderr, "ERROR: could not map input file '%s'\n", argv[1]);
+        return 1;
+    }
+
+    buf = malloc(STREAM_SIZE);
+    if (!buf)
+        return 1;
+    for (pos = 0; pos < STREAM_SIZE; pos += n) {
+        n = MIN(data_size, STREAM_SIZE - pos);
+        memcpy(buf + pos, data, n);
+    }
+    input_close();
+
+    printf("CPU features: %s\n", cpu_get_features_string());
+
+    args.buf  = buf;
+    args.size = STREAM_SIZE;
+    bench_report("naive scan", bench_run(split_naive, &args), args.size);
+    naive_count = args.count;
+    bench_report("startcode_split()", bench_run(split, &args), args.size);
+    if (args.count != naive_count) {
+        fprintf(stderr, "ERROR: startcode_split() found %d units, not %d\n",
+                args.count, naive_count);
+        return 1;
+    }
+    printf("%d units\n", args.count);
+
+    free(buf);
+    return 0;
+}
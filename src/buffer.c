@@ -21,6 +21,7 @@
 #include "sysdeps.h"
 #include "buffer.h"
 #include "utils.h"
+#include <limits.h>
 
 static int buffer_allocate(Buffer *buffer, unsigned int buf_size)
 {
@@ -40,9 +41,45 @@ static int buffer_allocate(Buffer *buffer, unsigned int buf_size)
 
 static inline void buffer_init(Buffer *buffer)
 {
-    buffer->data          = NULL;
-    buffer->data_size     = 0;
-    buffer->data_size_max = 0;
+    buffer->data           = NULL;
+    buffer->data_size      = 0;
+    buffer->data_size_max  = 0;
+    buffer->segments       = NULL;
+    buffer->segments_count = 0;
+    buffer->segments_size  = 0;
+    buffer->size           = 0;
+}
+
+/* Appends a segment, or extends the last one if the new range follows it */
+static int buffer_add_segment(Buffer *buffer, const uint8_t *ref,
+                              unsigned int offset, unsigned int size)
+{
+    BufferSegment *segment, *segments;
+
+    if (buffer->segments_count > 0) {
+        segment = &buffer->segments[buffer->segments_count - 1];
+        if ((ref ? segment->ref && segment->ref + segment->size == ref
+             : !segment->ref && segment->offset + segment->size == offset) &&
+            size <= UINT_MAX - segment->size) {
+            segment->size += size;
+            return 0;
+        }
+    }
+
+    segments = fast_realloc(
+        buffer->segments,
+        &buffer->segments_size,
+        (buffer->segments_count + 1) * sizeof(*segments)
+    );
+    if (!segments)
+        return -1;
+    buffer->segments = segments;
+
+    segment = &segments[buffer->segments_count++];
+    segment->ref    = ref;
+    segment->offset = offset;
+    segment->size   = size;
+    return 0;
 }
 
 Buffer *buffer_create(unsigned int size)
@@ -66,10 +103,8 @@ void buffer_destroy(Buffer *buffer)
     if (!buffer)
         return;
 
-    if (buffer->data) {
-        free(buffer->data);
-        buffer_init(buffer);
-    }
+    free(buffer->data);
+    free(buffer->segments);
     free(buffer);
 }
 
@@ -81,20 +116,117 @@ int buffer_append(Buffer *buffer, const uint8_t *buf, unsigned int buf_size)
     if (buffer_allocate(buffer, buffer->data_size + buf_size) < 0)
         return -1;
 
+    if (buffer->segments_count > 0 &&
+        buffer_add_segment(buffer, NULL, buffer->data_size, buf_size) < 0)
+        return -1;
+
     memcpy(buffer->data + buffer->data_size, buf, buf_size);
     buffer->data_size += buf_size;
+    buffer->size      += buf_size;
+    return 0;
+}
+
+int buffer_append_ref(Buffer *buffer, const uint8_t *buf, size_t buf_size)
+{
+    unsigned int size;
+
+    if (!buffer)
+        return -1;
+
+    /* Bytes copied so far become the first segment */
+    if (buffer->segments_count == 0 && buffer->data_size > 0 &&
+        buffer_add_segment(buffer, NULL, 0, buffer->data_size) < 0)
+        return -1;
+
+    /* Segments hold up to 4 GiB each */
+    do {
+        size = MIN(buf_size, UINT_MAX);
+        if (buffer_add_segment(buffer, buf, 0, size) < 0)
+            return -1;
+        buffer->size += size;
+        buf          += size;
+        buf_size     -= size;
+    } while (buf_size > 0);
     return 0;
 }
 
-int buffer_steal(Buffer *buffer, uint8_t **buf, unsigned int *buf_size)
+size_t buffer_get_size(Buffer *buffer)
 {
+    return buffer ? buffer->size : 0;
+}
+
+unsigned int buffer_get_segment_count(Buffer *buffer)
+{
+    if (!buffer)
+        return 0;
+    if (buffer->segments_count > 0)
+        return buffer->segments_count;
+    return buffer->data_size > 0;
+}
+
+int buffer_get_segment(Buffer *buffer, unsigned int segment,
+                       const uint8_t **buf, unsigned int *buf_size)
+{
+    const BufferSegment *s;
+
+    if (segment >= buffer_get_segment_count(buffer))
+        return -1;
+
+    if (buffer->segments_count == 0) {
+        *buf      = buffer->data;
+        *buf_size = buffer->data_size;
+        return 0;
+    }
+
+    s = &buffer->segments[segment];
+    *buf      = s->ref ? s->ref : buffer->data + s->offset;
+    *buf_size = s->size;
+    return 0;
+}
+
+int buffer_flatten(Buffer *buffer, uint8_t *buf)
+{
+    const uint8_t *segment_buf;
+    unsigned int i, n, segment_size;
+
     if (!buffer || !buf)
         return -1;
 
+    n = buffer_get_segment_count(buffer);
+    for (i = 0; i < n; i++) {
+        if (buffer_get_segment(buffer, i, &segment_buf, &segment_size) < 0)
+            return -1;
+        memcpy(buf, segment_buf, segment_size);
+        buf += segment_size;
+    }
+    return 0;
+}
+
+int buffer_steal(Buffer *buffer, uint8_t **buf, size_t *buf_size)
+{
+    uint8_t *data;
+
+    if (!buffer || !buf)
+        return -1;
+
+    if (buffer->segments_count > 0) {
+        data = malloc(MAX(buffer->size, 1));
+        if (!data)
+            return -1;
+        if (buffer_flatten(buffer, data) < 0) {
+            free(data);
+            return -1;
+        }
+        free(buffer->data);
+        free(buffer->segments);
+    }
+    else
+        data = buffer->data;
+
     if (buf_size)
-        *buf_size = buffer->data_size;
+        *buf_size = buffer->size;
 
-    *buf = buffer->data;
+    *buf = data;
     buffer_init(buffer);
     return 0;
 }
@@ -22,16 +22,51 @@
 #define BUFFER_H
 
 typedef struct _Buffer Buffer;
+typedef struct _BufferSegment BufferSegment;
 
+// A range of the buffer contents: either referenced memory, or bytes
+// copied into the buffer data, at OFFSET
+struct _BufferSegment {
+    const uint8_t      *ref;
+    unsigned int        offset;
+    unsigned int        size;
+};
+
+// The buffer contents are the DATA bytes, until a reference is appended.
+// From then on, they are described by the SEGMENTS list, and DATA only
+// holds the copied bytes
 struct _Buffer {
     uint8_t            *data;
     unsigned int        data_size;
     unsigned int        data_size_max;
+    BufferSegment      *segments;
+    unsigned int        segments_count;
+    unsigned int        segments_size;
+    size_t              size;
 };
 
 Buffer *buffer_create(unsigned int size);
 void buffer_destroy(Buffer *buffer);
 int buffer_append(Buffer *buffer, const uint8_t *buf, unsigned int buf_size);
-int buffer_steal(Buffer *buffer, uint8_t **buf, unsigned int *buf_size);
+
+// Appends BUF without copying it, so it must outlive the buffer
+int buffer_append_ref(Buffer *buffer, const uint8_t *buf, size_t buf_size);
+
+// Returns the size of the buffer contents
+size_t buffer_get_size(Buffer *buffer);
+
+// Returns the number of contiguous segments of the buffer contents
+unsigned int buffer_get_segment_count(Buffer *buffer);
+
+// Returns the contiguous segment SEGMENT of the buffer contents
+int buffer_get_segment(Buffer *buffer, unsigned int segment,
+                       const uint8_t **buf, unsigned int *buf_size);
+
+// Copies the buffer contents to BUF, which holds buffer_get_size() bytes
+int buffer_flatten(Buffer *buffer, uint8_t *buf);
+
+// Hands the buffer contents over to the caller, who frees them. Contents
+// with references are flattened into a new allocation first
+int buffer_steal(Buffer *buffer, uint8_t **buf, size_t *buf_size);
 
 #endif /* BUFFER_H */
@@ -22,11 +22,15 @@
 #include "sysdeps.h"
 #include "common.h"
 #include "utils.h"
+#include "input.h"
+#include "thread_pool.h"
 #include <strings.h> /* strcasecmp() [POSIX.1-2001] */
 #include <stddef.h>
 #include <stdarg.h>
 #include <locale.h>
 #include <errno.h>
+#include <limits.h>
+#include <inttypes.h>
 
 #ifdef USE_VAAPI
 #include "vaapi.h"
@@ -72,6 +76,8 @@ static CommonContext g_common_context = {
     .getimage_format    = 0,
     .putimage_mode      = PUTIMAGE_NONE,
     .putimage_format    = 0,
+    .color_matrix       = COLOR_MATRIX_BT601,
+    .color_range        = COLOR_RANGE_LIMITED,
 };
 
 CommonContext *common_get_context(void)
@@ -159,6 +165,17 @@ uint32_t getimage_format(void)
     return common_get_context()->getimage_format;
 }
 
+enum ImageRotation getimage_rotation(void)
+{
+    switch (common_get_context()->rotation) {
+    case ROTATION_90:  return IMAGE_ROTATION_90;
+    case ROTATION_180: return IMAGE_ROTATION_180;
+    case ROTATION_270: return IMAGE_ROTATION_270;
+    default:           break;
+    }
+    return IMAGE_ROTATION_0;
+}
+
 enum PutImageMode putimage_mode(void)
 {
     return common_get_context()->putimage_mode;
@@ -169,6 +186,42 @@ uint32_t putimage_format(void)
     return common_get_context()->putimage_format;
 }
 
+Image *putimage_get_image(void)
+{
+    CommonContext * const common = common_get_context();
+    const unsigned int num_images = MAX(common->genimage_frames, 1);
+    Image *img;
+    unsigned int i;
+
+    /* Overlays are generated upfront and kept across frames, so that
+       benchmarks measure uploads, and backends only upload the modified
+       tiles again. Several images are used in turn */
+    if (!common->putimage_images) {
+        common->putimage_images = calloc(num_images, sizeof(Image *));
+        if (!common->putimage_images)
+            return NULL;
+        for (i = 0; i < num_images; i++) {
+            common->putimage_images[i] = image_generate_frame(
+                common->putimage_size.width,
+                common->putimage_size.height,
+                i
+            );
+            if (!common->putimage_images[i])
+                return NULL;
+        }
+    }
+
+    img = common->putimage_images[common->putimage_image_index];
+    if (!img)
+        return NULL;
+
+    /* Backends hold the contents of the previous image */
+    if (num_images > 1)
+        image_mark_dirty(img, 0, 0, img->width, img->height);
+    common->putimage_image_index = (common->putimage_image_index + 1) % num_images;
+    return img;
+}
+
 typedef struct {
     unsigned int value;
     const char  *str;
@@ -208,6 +261,7 @@ static const map_t map_genimage_types[] = {
     { GENIMAGE_RECTS,           "rects"         },
     { GENIMAGE_RGB_RECTS,       "rgb-rects"     },
     { GENIMAGE_FLOWERS,         "flowers"       },
+    { GENIMAGE_PATTERNS,        "patterns"      },
     { 0, }
 };
 
@@ -226,6 +280,34 @@ static const map_t map_putimage_modes[] = {
     { 0, }
 };
 
+static const map_t map_color_matrices[] = {
+    { COLOR_MATRIX_BT601,       "bt.601"        },
+    { COLOR_MATRIX_BT709,       "bt.709"        },
+    { 0, }
+};
+
+static const map_t map_color_ranges[] = {
+    { COLOR_RANGE_LIMITED,      "limited"       },
+    { COLOR_RANGE_FULL,         "full"          },
+    { 0, }
+};
+
+static const map_t map_output_formats[] = {
+    { OUTPUT_FORMAT_AUTO,       "auto"          },
+    { OUTPUT_FORMAT_PPM,        "ppm"           },
+    { OUTPUT_FORMAT_Y4M,        "y4m"           },
+    { OUTPUT_FORMAT_YUV,        "yuv"           },
+    { OUTPUT_FORMAT_NV12,       "nv12"          },
+    { 0, }
+};
+
+static const map_t map_hash_types[] = {
+    { HASH_NONE,                "none"          },
+    { HASH_CRC32C,              "crc32c"        },
+    { HASH_XXH64,               "xxh64"         },
+    { 0, }
+};
+
 static const map_t map_image_formats[] = {
     { IMAGE_NV12,               "nv12"          },
     { IMAGE_YV12,               "yv12"          },
@@ -319,6 +401,46 @@ static int map_get_value(const map_t m[], const char *str, uint32_t *value)
     return 0;
 }
 
+/* Prints one line per frame with the checksum of each plane */
+static int getimage_hash(Image *img)
+{
+    CommonContext * const common = common_get_context();
+    static unsigned int frame_num = 0;
+    uint64_t hashes[MAX_IMAGE_PLANES];
+    int i, num_planes;
+
+    num_planes = image_hash(img, common->hash_type, hashes);
+    if (num_planes < 0)
+        return -1;
+
+    printf("frame %u: %s %ux%u %s", frame_num++,
+           string_of_FOURCC(img->format), img->width, img->height,
+           map_get_string(map_hash_types, common->hash_type));
+    for (i = 0; i < num_planes; i++)
+        printf(" %0*" PRIx64, hash_get_digits(common->hash_type), hashes[i]);
+    printf("\n");
+    return 0;
+}
+
+int getimage_convert(Image *dst_img, Image *src_img)
+{
+    CommonContext * const common = common_get_context();
+
+    if (common->hash_type != HASH_NONE && getimage_hash(src_img) < 0) {
+        fprintf(stderr, "ERROR: frame checksum failed\n");
+        return -1;
+    }
+
+    /* Raw YUV outputs record decoded frames before any conversion */
+    if (common->output && output_get_format(common->output) != OUTPUT_FORMAT_PPM) {
+        if (output_write_image(common->output, src_img) < 0) {
+            fprintf(stderr, "ERROR: output frame write failed\n");
+            return -1;
+        }
+    }
+    return image_convert_rotate(dst_img, src_img, getimage_rotation());
+}
+
 static void error(const char *format, ...)
 {
     va_list args;
@@ -464,6 +586,22 @@ static int opt_subparse_float(const char *arg, const opt_t *opt)
     return 0;
 }
 
+static int opt_subparse_uint(const char *arg, const opt_t *opt)
+{
+    unsigned int * const pval = opt->var;
+    unsigned long v;
+    char *end_ptr;
+
+    assert(pval);
+
+    errno = 0;
+    v = strtoul(arg, &end_ptr, 10);
+    if (end_ptr == arg || *end_ptr != '\0' || errno == ERANGE || v > UINT_MAX)
+        return -1;
+    *pval = v;
+    return 0;
+}
+
 static int opt_subparse_size(const char *arg, const opt_t *opt)
 {
     return get_size(arg, opt->var, opt->varflag);
@@ -611,11 +749,31 @@ static const opt_t g_options[] = {
       "Select the windowing system",
       ENUM_VALUE(display_type, display_types, 0),
     },
+    { /* Decode the video data of a file instead of the built-in clip */
+      "input",
+      "Decode the video data of a file instead of the built-in clip",
+      STRING_VALUE(input_filename),
+    },
     { /* Specify the output file name */
       "output",
       "Specify the output file name",
       STRING_VALUE(output_filename),
     },
+    { /* Select the output file format: "auto", "ppm", "y4m", "yuv", "nv12" */
+      "output-format",
+      "Select the output file format (default: from the file extension)",
+      ENUM_VALUE(output_format, output_formats, OUTPUT_FORMAT_AUTO),
+    },
+    { /* Write the output file with O_DIRECT, bypassing the page cache */
+      "output-direct",
+      "Write the output file with O_DIRECT, bypassing the page cache",
+      BOOL_VALUE(use_output_direct),
+    },
+    { /* Print a checksum of each plane of decoded frames: "crc32c", "xxh64" */
+      "hash",
+      "Print a checksum of each plane of decoded frames",
+      ENUM_VALUE(hash_type, hash_types, HASH_NONE),
+    },
     { /* Allow rendering of the decoded video frame into a child window */
       "subwindow",
       "Allow rendering of the decoded video frame into a child window",
@@ -631,11 +789,22 @@ static const opt_t g_options[] = {
       "Select the rotation mode",
       ENUM_VALUE(rotation, rotation_modes, ROTATION_NONE),
     },
-    { /* Select type of generated image: "rects", "rgb-rects", "flowers" */
+    { /* Select type of generated image: "rects", "rgb-rects", "flowers",
+         "patterns" */
       "genimage",
       "Select type of generated image",
       ENUM_VALUE(genimage_type, genimage_types, 0),
     },
+    { /* Seed generated images, so that runs are reproducible */
+      "genimage-seed",
+      "Seed generated images, so that runs are reproducible",
+      STRUCT_VALUE_WITH_FLAG(uint, genimage_seed),
+    },
+    { /* Generate a ring of N distinct images upfront for --putimage */
+      "genimage-frames",
+      "Generate a ring of N distinct images upfront for --putimage",
+      STRUCT_VALUE(uint, genimage_frames),
+    },
     { /* Download the decoded frame from an HW video surface */
       "getimage",
       "Download the decoded frame from an HW video surface",
@@ -647,9 +816,9 @@ static const opt_t g_options[] = {
       "Specify the target image format used for \"GetImage\" demos",
       ENUM_VALUE(getimage_format, image_formats, 0),
     },
-    { /* Allow vaGetImage() from a specific region */
+    { /* Allow GetImage from a specific region (VA-API, VDPAU) */
       "getimage-rect",
-      "Allow vaGetImage() from a specific region",
+      "Allow GetImage from a specific region",
       STRUCT_VALUE_WITH_FLAG(rect, getimage_rect),
     },
     { /* Upload a generated image to a HW video surface */
@@ -668,6 +837,26 @@ static const opt_t g_options[] = {
       "Specify the source image size used for \"PutImage\" demos",
       STRUCT_VALUE(size, putimage_size),
     },
+    { /* Select the YUV to RGB conversion matrix: "bt.601", "bt.709" */
+      "color-matrix",
+      "Select the YUV to RGB conversion matrix",
+      ENUM_VALUE(color_matrix, color_matrices, 0),
+    },
+    { /* Select the YUV range: "limited" (16-235), "full" (0-255) */
+      "color-range",
+      "Select the YUV range",
+      ENUM_VALUE(color_range, color_ranges, 0),
+    },
+    { /* Specify the number of threads for image conversions (0: auto) */
+      "threads",
+      "Specify the number of threads used for image conversions",
+      STRUCT_VALUE(uint, num_threads),
+    },
+    { /* Back large images with huge pages, if available */
+      "hugepages",
+      "Back large images with huge pages, if available",
+      BOOL_VALUE(use_hugepages),
+    },
 #if USE_FFMPEG
     { /* Select the HW acceleration API. e.g. for FFmpeg demos */
       "hwaccel",
@@ -1062,6 +1251,7 @@ static int options_parse(int argc, char *argv[])
 int main(int argc, char *argv[])
 {
     CommonContext * const common = common_get_context();
+    Rectangle window_rect;
     int i, is_error = 1;
 
     /* Option defaults */
@@ -1145,6 +1335,14 @@ int main(int argc, char *argv[])
                    common->cliprects[i].height);
     }
 
+    if (common->use_genimage_seed)
+        gen_random_seed(common->genimage_seed);
+
+    if (thread_pool_init(common->num_threads) < 0) {
+        fprintf(stderr, "ERROR: thread pool creation failed\n");
+        goto end;
+    }
+
     common->cliprects_image = image_create(common->window_size.width,
                                            common->window_size.height,
                                            IMAGE_RGB32);
@@ -1153,17 +1351,17 @@ int main(int argc, char *argv[])
         goto end;
     }
 
-    image_draw_rectangle(common->cliprects_image,
-                         0, 0, common->window_size.width, common->window_size.height,
-                         0xffffffff);
-
-    for (i = 0; i < common->cliprects_count; i++)
-        image_draw_rectangle(common->cliprects_image,
-                             common->cliprects[i].x,
-                             common->cliprects[i].y,
-                             common->cliprects[i].width,
-                             common->cliprects[i].height,
-                             0xffff5400);
+    window_rect.x      = 0;
+    window_rect.y      = 0;
+    window_rect.width  = common->window_size.width;
+    window_rect.height = common->window_size.height;
+    if (image_fill_rects(common->cliprects_image, &window_rect, 1,
+                         0xffffffff) < 0 ||
+        image_fill_rects(common->cliprects_image, common->cliprects,
+                         common->cliprects_count, 0xffff5400) < 0) {
+        fprintf(stderr, "ERROR: cliprects image rasterization failed\n");
+        goto end;
+    }
 
     common->image = image_create(common->window_size.width,
                                  common->window_size.height,
@@ -1173,10 +1371,22 @@ int main(int argc, char *argv[])
         goto end;
     }
 
+    if (common->input_filename) {
+        if (input_open(common->input_filename) < 0) {
+            fprintf(stderr, "ERROR: could not map input file '%s'\n",
+                    common->input_filename);
+            goto end;
+        }
+        printf("Decode video data from '%s'\n", common->input_filename);
+    }
+
     if (common->output_filename) {
-        common->output_file = fopen(common->output_filename, "wb");
-        if (!common->output_file) {
-            fprintf(stderr, "ERROR: output file creation failed");
+        common->output = output_open(common->output_filename,
+                                     common->output_format,
+                                     (common->use_output_direct ?
+                                      OUTPUT_FLAG_DIRECT : 0));
+        if (!common->output) {
+            fprintf(stderr, "ERROR: output file creation failed\n");
             goto end;
         }
     }
@@ -1191,8 +1401,9 @@ int main(int argc, char *argv[])
         goto end;
     }
 
-    if (common->output_file && getimage_mode() == GETIMAGE_FROM_VIDEO) {
-        if (image_write(common->image, common->output_file) < 0) {
+    if (common->output && getimage_mode() == GETIMAGE_FROM_VIDEO &&
+        output_get_format(common->output) == OUTPUT_FORMAT_PPM) {
+        if (output_write_image(common->output, common->image) < 0) {
             fprintf(stderr, "ERROR: image write failed\n");
             goto end;
         }
@@ -1210,10 +1421,20 @@ int main(int argc, char *argv[])
 
     is_error = 0;
 end:
-    if (common->output_file)
-        fclose(common->output_file);
+    if (output_close(common->output) < 0) {
+        fprintf(stderr, "ERROR: output file write failed\n");
+        is_error = 1;
+    }
     free(common->cliprects);
     image_destroy(common->cliprects_image);
+    if (common->putimage_images) {
+        for (i = 0; i < MAX(common->genimage_frames, 1); i++)
+            image_destroy(common->putimage_images[i]);
+        free(common->putimage_images);
+    }
     image_destroy(common->image);
+    image_exit();
+    thread_pool_exit();
+    input_close();
     return is_error;
 }
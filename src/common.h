@@ -22,6 +22,7 @@
 #define HWDECODE_DEMOS_COMMON_H
 
 #include "image.h"
+#include "output.h"
 
 enum HWAccelType {
     HWACCEL_NONE,
@@ -47,7 +48,8 @@ enum GenImageType {
     GENIMAGE_AUTO = 0,  /* automatic selection   */
     GENIMAGE_RECTS,     /* random rectangles     */
     GENIMAGE_RGB_RECTS, /* R/G/B rectangles      */
-    GENIMAGE_FLOWERS    /* flowers (needs Cairo) */
+    GENIMAGE_FLOWERS,   /* flowers (needs Cairo) */
+    GENIMAGE_PATTERNS   /* seeded test patterns  */
 };
 
 enum GetImageMode {
@@ -63,6 +65,16 @@ enum PutImageMode {
     PUTIMAGE_BLEND
 };
 
+enum ColorMatrix {
+    COLOR_MATRIX_BT601 = 0,
+    COLOR_MATRIX_BT709
+};
+
+enum ColorRange {
+    COLOR_RANGE_LIMITED = 0,
+    COLOR_RANGE_FULL
+};
+
 enum TextureTarget {
     TEXTURE_TARGET_2D = 1,
     TEXTURE_TARGET_RECT
@@ -75,15 +87,6 @@ struct _Size {
     unsigned int        height;
 };
 
-typedef struct _Rectangle Rectangle;
-
-struct _Rectangle {
-    int                 x;
-    int                 y;
-    unsigned int        width;
-    unsigned int        height;
-};
-
 typedef struct _CommonContext CommonContext;
 
 struct _CommonContext {
@@ -94,11 +97,18 @@ struct _CommonContext {
     Rectangle           subwindow_rect;
     enum RotationMode   rotation;
 
-    FILE               *output_file;
+    char               *input_filename;
+    Output             *output;
     char               *output_filename;
+    enum OutputFormat   output_format;
+    unsigned int        use_output_direct;
+    enum HashType       hash_type;
 
     Image              *image;
     enum GenImageType   genimage_type;
+    unsigned int        use_genimage_seed;
+    unsigned int        genimage_seed;
+    unsigned int        genimage_frames;
     enum GetImageMode   getimage_mode;
     uint32_t            getimage_format;
     unsigned int        use_getimage_rect;
@@ -106,6 +116,12 @@ struct _CommonContext {
     enum PutImageMode   putimage_mode;
     uint32_t            putimage_format;
     Size                putimage_size;
+    Image             **putimage_images;
+    unsigned int        putimage_image_index;
+    enum ColorMatrix    color_matrix;
+    enum ColorRange     color_range;
+    unsigned int        num_threads;
+    unsigned int        use_hugepages;
 
     Rectangle          *cliprects;
     unsigned int        cliprects_size;
@@ -161,7 +177,10 @@ enum HWAccelType hwaccel_type(void);
 enum DisplayType display_type(void);
 enum GetImageMode getimage_mode(void);
 uint32_t getimage_format(void);
+enum ImageRotation getimage_rotation(void);
+int getimage_convert(Image *dst_img, Image *src_img);
 enum PutImageMode putimage_mode(void);
 uint32_t putimage_format(void);
+Image *putimage_get_image(void);
 
 #endif /* HWDECODE_DEMOS_COMMON_H */
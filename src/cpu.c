@@ -0,0 +1,140 @@
+/*
+ *  cpu.c - CPU features detection
+ *
+ *  hwdecode-demos (C) 2009-2010 Splitted-Desktop Systems
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "sysdeps.h"
+#include "cpu.h"
+#include "utils.h"
+
+static const struct {
+    unsigned int feature;
+    const char  *name;
+}
+g_feature_names[] = {
+    { CPU_FEATURE_SSE2,     "sse2"          },
+    { CPU_FEATURE_SSSE3,    "ssse3"         },
+    { CPU_FEATURE_SSE4_1,   "sse4.1"        },
+    { CPU_FEATURE_SSE4_2,   "sse4.2"        },
+    { CPU_FEATURE_AVX2,     "avx2"          },
+    { CPU_FEATURE_NEON,     "neon"          },
+};
+
+static unsigned int g_features_mask = ~0U;
+
+#if USE_SIMD_X86
+#include <cpuid.h>
+
+#ifndef bit_OSXSAVE
+#define bit_OSXSAVE     (1 << 27)
+#endif
+#ifndef bit_AVX2
+#define bit_AVX2        (1 << 5)
+#endif
+
+static unsigned int get_x86_features(void)
+{
+    unsigned int eax, ebx, ecx, edx, xcr0_lo, xcr0_hi;
+    unsigned int features = 0;
+
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx))
+        return 0;
+
+    if (edx & bit_SSE2)
+        features |= CPU_FEATURE_SSE2;
+    if (ecx & bit_SSSE3)
+        features |= CPU_FEATURE_SSSE3;
+    if (ecx & bit_SSE4_1)
+        features |= CPU_FEATURE_SSE4_1;
+    if (ecx & bit_SSE4_2)
+        features |= CPU_FEATURE_SSE4_2;
+
+    /* AVX2 also needs the OS to save the YMM registers state */
+    if ((ecx & (bit_OSXSAVE|bit_AVX)) != (bit_OSXSAVE|bit_AVX))
+        return features;
+    __asm__ __volatile__ ("xgetbv" : "=a" (xcr0_lo), "=d" (xcr0_hi) : "c" (0));
+    if ((xcr0_lo & 0x6) != 0x6)
+        return features;
+
+    if (__get_cpuid_max(0, NULL) < 7)
+        return features;
+    __cpuid_count(7, 0, eax, ebx, ecx, edx);
+    if (ebx & bit_AVX2)
+        features |= CPU_FEATURE_AVX2;
+    return features;
+}
+#endif
+
+/* Returns the features listed in NAMES, e.g. "sse2,ssse3" */
+static unsigned int parse_features(const char *names)
+{
+    unsigned int i, features = 0;
+
+    for (i = 0; i < ARRAY_ELEMS(g_feature_names); i++) {
+        if (find_string(g_feature_names[i].name, names, ", "))
+            features |= g_feature_names[i].feature;
+    }
+    return features;
+}
+
+unsigned int cpu_get_features(void)
+{
+    static int initialized = 0;
+    static unsigned int features = 0;
+    const char *env;
+
+    if (!initialized) {
+#if USE_SIMD_X86
+        features |= get_x86_features();
+#endif
+#if USE_SIMD_NEON
+        features |= CPU_FEATURE_NEON;
+#endif
+        /* Restrict kernels to the listed features, e.g. to compare
+           them. "none" selects the C kernels */
+        env = getenv("HWDECODE_CPU_FEATURES");
+        if (env)
+            features &= parse_features(env);
+        initialized = 1;
+    }
+    return features & g_features_mask;
+}
+
+void cpu_set_features_mask(unsigned int mask)
+{
+    g_features_mask = mask;
+}
+
+const char *cpu_get_features_string(void)
+{
+    static char str[64];
+    const unsigned int features = cpu_get_features();
+    unsigned int i;
+
+    str[0] = '\0';
+    for (i = 0; i < ARRAY_ELEMS(g_feature_names); i++) {
+        if (!(features & g_feature_names[i].feature))
+            continue;
+        if (str[0] != '\0')
+            strcat(str, " ");
+        strcat(str, g_feature_names[i].name);
+    }
+    if (str[0] == '\0')
+        strcpy(str, "none");
+    return str;
+}
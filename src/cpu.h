@@ -0,0 +1,58 @@
+/*
+ *  cpu.h - CPU features detection
+ *
+ *  hwdecode-demos (C) 2009-2010 Splitted-Desktop Systems
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef CPU_H
+#define CPU_H
+
+#include "config.h"
+
+// x86 kernels are built with per-function target attributes
+#if HAVE_X86_SIMD && (defined(__i386__) || defined(__x86_64__))
+# define USE_SIMD_X86 1
+#endif
+
+// NEON kernels are only built if the compiler targets NEON already
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+# define USE_SIMD_NEON 1
+#endif
+
+enum {
+    CPU_FEATURE_SSE2    = 1 << 0,
+    CPU_FEATURE_SSSE3   = 1 << 1,
+    CPU_FEATURE_SSE4_1  = 1 << 2,
+    CPU_FEATURE_SSE4_2  = 1 << 3,
+    CPU_FEATURE_AVX2    = 1 << 4,
+    CPU_FEATURE_NEON    = 1 << 5,
+};
+
+// Returns the set of CPU_FEATURE_* flags supported by the host. The
+// HWDECODE_CPU_FEATURES environment variable, e.g. "sse2,ssse3" or
+// "none", restricts it to the listed features
+unsigned int cpu_get_features(void);
+
+// Further restricts cpu_get_features() to the CPU_FEATURE_* flags in
+// MASK, e.g. to compare kernels within a run. Kernels are selected again
+// on their next use. ~0 lifts the restriction
+void cpu_set_features_mask(unsigned int mask);
+
+// Returns a human readable list of the supported CPU features
+const char *cpu_get_features_string(void);
+
+#endif /* CPU_H */
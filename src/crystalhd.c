@@ -21,6 +21,7 @@
 #include "sysdeps.h"
 #include "crystalhd.h"
 #include "common.h"
+#include "input.h"
 #include "utils.h"
 #include "x11.h"
 
@@ -30,6 +31,13 @@
 /* DtsProcOutput() timeout in milliseconds */
 #define DTS_OUTPUT_TIMEOUT 1000
 
+/* Input segments smaller than that are gathered before DtsProcInput() */
+#define DTS_INPUT_GATHER_SIZE 4096
+
+/* Larger segments are sent by chunks of that size, so that the pages of
+   an input file can be released as they are consumed */
+#define DTS_INPUT_CHUNK_SIZE (1 << 20)
+
 static CrystalHDContext *crystalhd_context;
 
 static const char *string_of_BC_STATUS(BC_STATUS status)
@@ -98,8 +106,10 @@ static int crystalhd_init(void)
     if (!crystalhd_check_status(status, "DtsDeviceOpen()"))
         return -1;
 
-    chd->picture      = NULL;
-    crystalhd_context = chd;
+    chd->picture         = NULL;
+    chd->input_pool      = NULL;
+    chd->input_pool_size = 0;
+    crystalhd_context    = chd;
     return 0;
 }
 
@@ -122,6 +132,7 @@ static int crystalhd_exit(void)
         chd->picture = NULL;
     }
 
+    free(chd->input_pool);
     free(crystalhd_context);
     crystalhd_context = NULL;
     return 0;
@@ -243,6 +254,11 @@ again:
 
     memset(&output, 0, sizeof(output));
     output.PoutFlags      = BC_POUT_FLAGS_SIZE;
+    if (chd->picture->pitches[0] != width) {
+        /* Image pitches are padded, StrideSz is the extra row length */
+        output.PoutFlags |= BC_POUT_FLAGS_STRIDE;
+        output.StrideSz   = chd->picture->pitches[0] - width;
+    }
     output.PicInfo.width  = width;
     output.PicInfo.height = height;
     output.Ybuff          = chd->picture->pixels[0];
@@ -274,18 +290,28 @@ again:
     return 0;
 }
 
-int crystalhd_decode(const uint8_t *buf, unsigned int buf_size)
+static int crystalhd_send_input(CrystalHDContext *chd,
+                                const uint8_t *buf, unsigned int buf_size)
 {
-    CrystalHDContext * const chd = crystalhd_get_context();
-    CommonContext * const common = common_get_context();
     BC_STATUS status;
+    unsigned int size;
 
-    if (!chd)
-        return -1;
+    while (buf_size > 0) {
+        size = MIN(buf_size, DTS_INPUT_CHUNK_SIZE);
+        status = DtsProcInput(chd->device, (uint8_t *)buf, size, 0, FALSE);
+        if (!crystalhd_check_status(status, "DtsProcInput()"))
+            return -1;
+        buf      += size;
+        buf_size -= size;
+        input_release(buf);
+    }
+    return 0;
+}
 
-    status = DtsProcInput(chd->device, (uint8_t *)buf, buf_size, 0, FALSE);
-    if (!crystalhd_check_status(status, "DtsProcInput()"))
-        return -1;
+static int crystalhd_finish_input(CrystalHDContext *chd)
+{
+    CommonContext * const common = common_get_context();
+    BC_STATUS status;
 
     /* DtsFlushInput() requires that current slices are correctly
        identified. e.g. for H.264, the decoder waits for the next one
@@ -309,7 +335,59 @@ int crystalhd_decode(const uint8_t *buf, unsigned int buf_size)
         if (crystalhd_get_output() < 0)
             return -1;
     }
-    return image_convert(common->image, chd->picture);
+    return getimage_convert(common->image, chd->picture);
+}
+
+int crystalhd_decode(const uint8_t *buf, unsigned int buf_size)
+{
+    CrystalHDContext * const chd = crystalhd_get_context();
+
+    if (!chd)
+        return -1;
+
+    if (crystalhd_send_input(chd, buf, buf_size) < 0)
+        return -1;
+    return crystalhd_finish_input(chd);
+}
+
+int crystalhd_decode_buffer(Buffer *buffer)
+{
+    CrystalHDContext * const chd = crystalhd_get_context();
+    const uint8_t *buf;
+    uint8_t *pool;
+    unsigned int i, n, buf_size, pool_size = 0;
+
+    if (!chd)
+        return -1;
+
+    n = buffer_get_segment_count(buffer);
+    for (i = 0; i < n; i++) {
+        if (buffer_get_segment(buffer, i, &buf, &buf_size) < 0)
+            return -1;
+
+        if (buf_size < DTS_INPUT_GATHER_SIZE) {
+            pool = fast_realloc(chd->input_pool, &chd->input_pool_size,
+                                pool_size + buf_size);
+            if (!pool)
+                return -1;
+            chd->input_pool = pool;
+            memcpy(pool + pool_size, buf, buf_size);
+            pool_size += buf_size;
+            continue;
+        }
+
+        if (pool_size > 0) {
+            if (crystalhd_send_input(chd, chd->input_pool, pool_size) < 0)
+                return -1;
+            pool_size = 0;
+        }
+        if (crystalhd_send_input(chd, buf, buf_size) < 0)
+            return -1;
+    }
+    if (pool_size > 0 &&
+        crystalhd_send_input(chd, chd->input_pool, pool_size) < 0)
+        return -1;
+    return crystalhd_finish_input(chd);
 }
 
 static int crystalhd_display(void)
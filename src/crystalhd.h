@@ -23,6 +23,7 @@
 
 #include <libcrystalhd_if.h>
 #include "image.h"
+#include "buffer.h"
 
 typedef struct _CrystalHDContext CrystalHDContext;
 
@@ -31,6 +32,8 @@ struct _CrystalHDContext {
     Image              *picture;
     unsigned int        picture_width;
     unsigned int        picture_height;
+    uint8_t            *input_pool;     // gathers small input segments
+    unsigned int        input_pool_size;
 };
 
 CrystalHDContext *crystalhd_get_context(void);
@@ -38,4 +41,8 @@ CrystalHDContext *crystalhd_get_context(void);
 int crystalhd_init_decoder(int codec, unsigned int width, unsigned int height);
 int crystalhd_decode(const uint8_t *buf, unsigned int buf_size);
 
+// Decodes the contents of BUFFER. Large segments are sent to the device
+// as is, and runs of small ones are gathered into a single copy
+int crystalhd_decode_buffer(Buffer *buffer);
+
 #endif /* CRYSTALHD_H */
@@ -245,7 +245,7 @@ int ffmpeg_decode(AVCodecContext *avctx, const uint8_t *buf, unsigned int buf_si
             image.pixels[i]  = ffmpeg->frame->data[i];
             image.pitches[i] = ffmpeg->frame->linesize[i];
         }
-        if (image_convert(common->image, &image) < 0)
+        if (getimage_convert(common->image, &image) < 0)
             return -1;
     }
     return got_picture;
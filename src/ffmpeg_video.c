@@ -20,6 +20,9 @@
 
 #include "sysdeps.h"
 #include "ffmpeg.h"
+#include "common.h"
+#include "input.h"
+#include <limits.h>
 
 #ifdef HAVE_LIBAVFORMAT_AVFORMAT_H
 # include <libavformat/avformat.h>
@@ -59,6 +62,55 @@
 #define FORCE_VIDEO_FORMAT NULL
 #endif
 
+/* Size of the I/O buffer of video data too large to be read in place */
+#define VIDEO_READER_BUFFER_SIZE (32*1024)
+
+typedef struct _VideoReader VideoReader;
+
+struct _VideoReader {
+    const uint8_t      *data;
+    size_t              size;
+    size_t              pos;
+};
+
+static int read_video_data(void *opaque, uint8_t *buf, int buf_size)
+{
+    VideoReader * const reader = opaque;
+    const size_t size = MIN((size_t)buf_size, reader->size - reader->pos);
+
+    memcpy(buf, reader->data + reader->pos, size);
+    input_release(reader->data + reader->pos);
+    reader->pos += size;
+    return size;
+}
+
+static int64_t seek_video_data(void *opaque, int64_t offset, int whence)
+{
+    VideoReader * const reader = opaque;
+
+#ifdef AVSEEK_FORCE
+    whence &= ~AVSEEK_FORCE;
+#endif
+    switch (whence) {
+    case SEEK_SET:
+        break;
+    case SEEK_CUR:
+        offset += reader->pos;
+        break;
+    case SEEK_END:
+        offset += reader->size;
+        break;
+    case AVSEEK_SIZE:
+        return reader->size;
+    default:
+        return -1;
+    }
+    if (offset < 0 || (uint64_t)offset > reader->size)
+        return -1;
+    reader->pos = offset;
+    return offset;
+}
+
 int decode(void)
 {
     AVProbeData pd;
@@ -72,7 +124,9 @@ int decode(void)
     int i, got_picture, error = -1;
 
     const uint8_t *video_data;
-    unsigned int video_data_size;
+    size_t video_data_size;
+    VideoReader reader;
+    uint8_t *io_buffer = NULL;
 
     av_register_all();
     av_init_packet(&packet);
@@ -81,13 +135,28 @@ int decode(void)
     pd.filename = "";
     pd.buf      = (uint8_t *)video_data;
     pd.buf_size = MIN(video_data_size, 32*1024);
-    if (FORCE_VIDEO_FORMAT)
+    /* Input files are probed, e.g. for VC-1 in RCV files */
+    if (FORCE_VIDEO_FORMAT && !common_get_context()->input_filename)
         format = av_find_input_format(FORCE_VIDEO_FORMAT);
     if (!format && (format = av_probe_input_format(&pd, 1)) == NULL)
         goto end;
 
-    if (init_put_byte(&ioctx, (uint8_t *)video_data, video_data_size, 0, NULL, NULL, NULL, NULL) < 0)
-        goto end;
+    /* I/O buffers have an int size, so larger inputs are copied through
+       a small one */
+    if (video_data_size <= INT_MAX) {
+        if (init_put_byte(&ioctx, (uint8_t *)video_data, video_data_size, 0, NULL, NULL, NULL, NULL) < 0)
+            goto end;
+    }
+    else {
+        reader.data = video_data;
+        reader.size = video_data_size;
+        reader.pos  = 0;
+        if ((io_buffer = av_malloc(VIDEO_READER_BUFFER_SIZE)) == NULL)
+            goto end;
+        if (init_put_byte(&ioctx, io_buffer, VIDEO_READER_BUFFER_SIZE, 0, &reader,
+                          read_video_data, NULL, seek_video_data) < 0)
+            goto end;
+    }
 
     if (av_open_input_stream(&ic, &ioctx, "", format, NULL) < 0)
         goto end;
@@ -116,6 +185,8 @@ int decode(void)
 
     got_picture = 0;
     while (av_read_frame(ic, &packet) == 0) {
+        /* IOCTX reads small video data in place, without a copy */
+        input_release(ioctx.buf_ptr);
         if (packet.stream_index != video_stream->index)
             continue;
         if ((got_picture = ffmpeg_decode(avctx, packet.data, packet.size)) < 0)
@@ -138,5 +209,8 @@ end:
         avcodec_close(avctx);
     if (ic)
         av_close_input_stream(ic);
+    /* The I/O buffer may have been reallocated while probing */
+    if (io_buffer)
+        av_free(ioctx.buffer);
     return error;
 }
@@ -0,0 +1,266 @@
+/*
+ *  get_bits.h - Bitstream reader
+ *
+ *  hwdecode-demos (C) 2009-2010 Splitted-Desktop Systems
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef GET_BITS_H
+#define GET_BITS_H
+
+#include <stdint.h>
+#include <string.h>
+
+/*
+ * Bits are read MSB first from a 64-bit cache, which every refill tops
+ * up to at least 56 bits, so that reads of up to 32 bits never need more
+ * than one refill.
+ *
+ * By default, refills use unaligned big-endian 64-bit loads while at
+ * least 8 bytes remain, then fall back to byte loads, and never read past
+ * the end of the buffer. Reads past the end return zeros, which the
+ * checked variants and get_bits_left() report.
+ *
+ * Defining GET_BITS_PADDED before including this file selects branch-free
+ * refills, which always load 8 bytes. Buffers then need GET_BITS_PADDING
+ * readable bytes past their end, and must not be overread.
+ */
+#define GET_BITS_PADDING 16
+
+typedef struct GetBitContext {
+    const uint8_t  *buffer;
+    unsigned int    size;
+    unsigned int    index;
+    uint64_t        cache;
+    unsigned int    bits_left;
+} GetBitContext;
+
+static inline uint64_t get_bits_load_be64(const uint8_t *p)
+{
+    uint64_t v;
+
+    memcpy(&v, p, sizeof(v));
+#ifdef WORDS_BIGENDIAN
+    return v;
+#else
+    return __builtin_bswap64(v);
+#endif
+}
+
+/**
+ * Tops up the cache to at least 56 bits.
+ */
+static inline void refill_get_bits(GetBitContext *s)
+{
+#ifdef GET_BITS_PADDED
+    s->cache     |= get_bits_load_be64(s->buffer + s->index) >> s->bits_left;
+    s->index     += (63 - s->bits_left) >> 3;
+    s->bits_left |= 56;
+#else
+    if (s->index + 8 <= s->size) {
+        s->cache     |= get_bits_load_be64(s->buffer + s->index) >> s->bits_left;
+        s->index     += (63 - s->bits_left) >> 3;
+        s->bits_left |= 56;
+        return;
+    }
+    for (; s->bits_left <= 56; s->bits_left += 8, s->index++) {
+        if (s->index < s->size)
+            s->cache |= (uint64_t)s->buffer[s->index] << (56 - s->bits_left);
+    }
+#endif
+}
+
+/**
+ * Initializes the GetBitContext s.
+ *
+ * @param buffer the buffer to read bits from
+ * @param buffer_size the size in bytes of buffer
+ */
+static inline void
+init_get_bits(GetBitContext *s, const uint8_t *buffer, unsigned int buffer_size)
+{
+    s->buffer    = buffer;
+    s->size      = buffer_size;
+    s->index     = 0;
+    s->cache     = 0;
+    s->bits_left = 0;
+    refill_get_bits(s);
+}
+
+/**
+ * Returns the number of bits read so far.
+ */
+static inline unsigned int get_bits_count(const GetBitContext *s)
+{
+    return s->index * 8 - s->bits_left;
+}
+
+/**
+ * Returns the number of bits left, negative if the stream was overread.
+ */
+static inline int get_bits_left(const GetBitContext *s)
+{
+    return (int)(s->size * 8) - (int)get_bits_count(s);
+}
+
+/**
+ * Returns the next n bits, with n <= 32, without consuming them.
+ */
+static inline uint32_t show_bits(GetBitContext *s, unsigned int n)
+{
+    if (s->bits_left < n)
+        refill_get_bits(s);
+    /* Shift twice so that n == 0 is defined too */
+    return (s->cache >> (63 - n)) >> 1;
+}
+
+/**
+ * Skips n bits, with n <= 32.
+ */
+static inline void skip_bits(GetBitContext *s, unsigned int n)
+{
+    if (s->bits_left < n)
+        refill_get_bits(s);
+    s->cache    <<= n;
+    s->bits_left -= n;
+}
+
+/**
+ * Reads n bits, with n <= 32.
+ */
+static inline uint32_t get_bits(GetBitContext *s, unsigned int n)
+{
+    const uint32_t v = show_bits(s, n);
+
+    s->cache    <<= n;
+    s->bits_left -= n;
+    return v;
+}
+
+/**
+ * Reads one bit.
+ */
+static inline unsigned int get_bits1(GetBitContext *s)
+{
+    return get_bits(s, 1);
+}
+
+/**
+ * Moves to bit position pos, which may be anywhere in the buffer.
+ */
+static inline void seek_get_bits(GetBitContext *s, unsigned int pos)
+{
+    s->index     = pos / 8;
+    s->cache     = 0;
+    s->bits_left = 0;
+    refill_get_bits(s);
+    skip_bits(s, pos % 8);
+}
+
+/**
+ * Skips n bits, for any n.
+ */
+static inline void skip_bits_long(GetBitContext *s, unsigned int n)
+{
+    if (n <= s->bits_left) {
+        s->cache    <<= n;
+        s->bits_left -= n;
+        return;
+    }
+    seek_get_bits(s, get_bits_count(s) + n);
+}
+
+/**
+ * Skips bits up to the next byte boundary.
+ */
+static inline void align_get_bits(GetBitContext *s)
+{
+    skip_bits(s, -get_bits_count(s) & 7);
+}
+
+/**
+ * Reads an unsigned Exp-Golomb code, up to 2^32 - 2.
+ */
+static inline uint32_t get_ue_golomb(GetBitContext *s)
+{
+    unsigned int n;
+
+    if (s->bits_left < 56)
+        refill_get_bits(s);
+
+    /* Codes of up to 55 bits are in the cache now */
+    n = __builtin_clzll(s->cache | 1);
+    if (n < 28) {
+        const unsigned int len = 2 * n + 1;
+        const uint32_t v = s->cache >> (64 - len);
+        s->cache    <<= len;
+        s->bits_left -= len;
+        return v - 1;
+    }
+
+    for (n = 0; n < 32 && !get_bits1(s); n++)
+        ;
+    if (n == 32)
+        return UINT32_MAX;
+    return ((1ULL << n) | get_bits(s, n)) - 1;
+}
+
+/**
+ * Reads a signed Exp-Golomb code.
+ */
+static inline int32_t get_se_golomb(GetBitContext *s)
+{
+    const uint32_t k = get_ue_golomb(s);
+    const int32_t v = (int32_t)((k >> 1) + (k & 1));
+
+    return (k & 1) ? v : -v;
+}
+
+/**
+ * Checked variants: they fail without consuming anything if the stream
+ * has fewer bits left than the value needs.
+ */
+static inline int get_bits_checked(GetBitContext *s, unsigned int n, uint32_t *pval)
+{
+    if (get_bits_left(s) < (int)n)
+        return -1;
+    *pval = get_bits(s, n);
+    return 0;
+}
+
+static inline int get_ue_golomb_checked(GetBitContext *s, uint32_t *pval)
+{
+    const GetBitContext saved = *s;
+
+    *pval = get_ue_golomb(s);
+    if (get_bits_left(s) >= 0 && *pval != UINT32_MAX)
+        return 0;
+
+    *s = saved;
+    return -1;
+}
+
+static inline int get_se_golomb_checked(GetBitContext *s, int32_t *pval)
+{
+    uint32_t k;
+
+    if (get_ue_golomb_checked(s, &k) < 0)
+        return -1;
+    *pval = (k & 1) ? (int32_t)((k >> 1) + 1) : -(int32_t)(k >> 1);
+    return 0;
+}
+
+#endif /* GET_BITS_H */
@@ -20,11 +20,14 @@
 
 #include "sysdeps.h"
 #include "h264.h"
+#include "mp4.h"
+#include "startcode.h"
+#include "get_bits.h"
+#include "utils.h"
+#include "input.h"
 
-#define H264_CLIP_WIDTH           320
-#define H264_CLIP_HEIGHT          240
-#define H264_CLIP_SLICE_OFFSET     52
-#define H264_CLIP_SLICE_SIZE    12071
+#define DEBUG 1
+#include "debug.h"
 
 /* Data dump of a 320x240 H.264 video clip (h264.mp4), it has a single frame */
 static const uint8_t h264_clip[] = {
@@ -1100,129 +1103,1810 @@ static const uint8_t h264_clip[] = {
   0x2e, 0x33, 0x32, 0x2e, 0x30
 };
 
-static const H264PictureInfo h264_pic_info = {
-    .profile_idc = 77,
-    .level_idc = 13,
-    .width = H264_CLIP_WIDTH,
-    .height = H264_CLIP_HEIGHT,
-    .picture_width_in_mbs_minus1 = (H264_CLIP_WIDTH + 15) / 16 - 1,
-    .picture_height_in_mbs_minus1 = (H264_CLIP_HEIGHT + 15) / 16 - 1,
-    .bit_depth_luma_minus8 = 0,
-    .bit_depth_chroma_minus8 = 0,
-    .num_ref_frames = 1,
-    .seq_fields = {
-        .bits = {
-            .chroma_format_idc = 1,
-            .residual_colour_transform_flag = 0,
-            .gaps_in_frame_num_value_allowed_flag = 0,
-            .frame_mbs_only_flag = 1,
-            .mb_adaptive_frame_field_flag = 0,
-            .direct_8x8_inference_flag = 1,
-            .MinLumaBiPredSize8x8 = 0,
-            .log2_max_frame_num_minus4 = 1,
-            .pic_order_cnt_type = 0,
-            .log2_max_pic_order_cnt_lsb_minus4 = 2,
-            .delta_pic_order_always_zero_flag = 0,
-        },
-    },
-    .num_slice_groups_minus1 = 0,
-    .slice_group_map_type = 0,
-    .slice_group_change_rate_minus1 = 0,
-    .pic_init_qp_minus26 = 0,
-    .pic_init_qs_minus26 = 0,
-    .chroma_qp_index_offset = -2,
-    .second_chroma_qp_index_offset = -2,
-    .pic_fields = {
-        .bits = {
-            .entropy_coding_mode_flag = 1,
-            .weighted_pred_flag = 0,
-            .weighted_bipred_idc = 0,
-            .transform_8x8_mode_flag = 0,
-            .field_pic_flag = 0,
-            .bottom_field_flag = 0,
-            .constrained_intra_pred_flag = 0,
-            .pic_order_present_flag = 0,
-            .deblocking_filter_control_present_flag = 1,
-            .redundant_pic_cnt_present_flag = 0,
-            .reference_pic_flag = 1,
-        },
-    },
+/* Default scaling lists (Table 7-3 and 7-4), in zig-zag scan order */
+static const uint8_t default_4x4_intra[16] = {
+     6, 13, 13, 20, 20, 20, 28, 28, 28, 28, 32, 32, 32, 37, 37, 42
 };
 
-static const H264SliceInfo h264_slice_info = {
-    .macroblock_offset = 39,
-    .first_mb_in_slice = 0,
-    .slice_type = 2,
-    .direct_spatial_mv_pred_flag = 0,
-    .num_ref_idx_l0_active_minus1 = 0,
-    .num_ref_idx_l1_active_minus1 = 0,
-    .cabac_init_idc = 0,
-    .slice_qp_delta = 2,
-    .disable_deblocking_filter_idc = 1,
-    .slice_alpha_c0_offset_div2 = 0,
-    .slice_beta_offset_div2 = 0,
-    .luma_log2_weight_denom = 0,
-    .chroma_log2_weight_denom = 0,
-    .luma_weight_l0_flag = 0,
-    .chroma_weight_l0_flag = 0,
-    .luma_weight_l1_flag = 0,
-    .chroma_weight_l1_flag = 0,
+static const uint8_t default_4x4_inter[16] = {
+    10, 14, 14, 20, 20, 20, 24, 24, 24, 24, 27, 27, 27, 30, 30, 34
 };
 
-static const H264IQMatrix h264_iq_matrix = {
-    { { 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
-        0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10 },
-      { 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
-        0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10 },
-      { 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
-        0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10 },
-      { 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
-        0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10 },
-      { 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
-        0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10 },
-      { 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
-        0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10 } },
-    { { 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
-        0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
-        0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
-        0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
-        0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
-        0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
-        0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
-        0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10 },
-      { 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
-        0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
-        0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
-        0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
-        0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
-        0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
-        0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
-        0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10 } }
+static const uint8_t default_8x8_intra[64] = {
+     6, 10, 10, 13, 11, 13, 16, 16, 16, 16, 18, 18, 18, 18, 18, 23,
+    23, 23, 23, 23, 23, 25, 25, 25, 25, 25, 25, 25, 27, 27, 27, 27,
+    27, 27, 27, 27, 29, 29, 29, 29, 29, 29, 29, 31, 31, 31, 31, 31,
+    31, 33, 33, 33, 33, 33, 36, 36, 36, 36, 38, 38, 38, 40, 40, 42
 };
 
-void h264_get_video_data(const uint8_t **data, unsigned int *size)
+static const uint8_t default_8x8_inter[64] = {
+     9, 13, 13, 15, 13, 15, 17, 17, 17, 17, 19, 19, 19, 19, 19, 21,
+    21, 21, 21, 21, 21, 22, 22, 22, 22, 22, 22, 22, 24, 24, 24, 24,
+    24, 24, 24, 24, 25, 25, 25, 25, 25, 25, 25, 27, 27, 27, 27, 27,
+    27, 28, 28, 28, 28, 28, 30, 30, 30, 30, 32, 32, 32, 33, 33, 35
+};
+
+/* NAL unit types */
+#define NAL_SLICE               1
+#define NAL_IDR_SLICE           5
+#define NAL_SEI                 6
+#define NAL_SPS                 7
+#define NAL_PPS                 8
+#define NAL_AU_DELIMITER        9
+#define NAL_END_OF_SEQUENCE     10
+#define NAL_END_OF_STREAM       11
+#define NAL_PREFIX              14
+#define NAL_RESERVED_18         18
+
+/* Slice types */
+#define SLICE_TYPE_P            0
+#define SLICE_TYPE_B            1
+#define SLICE_TYPE_I            2
+#define SLICE_TYPE_SP           3
+#define SLICE_TYPE_SI           4
+
+#define MAX_SPS_COUNT           32
+#define MAX_PPS_COUNT           256
+#define MAX_DPB_SIZE            16
+#define MAX_MMCO_COUNT          66
+#define MAX_REF_LIST_SIZE       (2 * (MAX_DPB_SIZE + 1) + 1)
+
+/* Slice headers are only unescaped up to this size, which holds the
+   largest prediction weight tables and reference list modifications */
+#define MAX_SLICE_HEADER_SIZE   2048
+
+#define TOP_FIELD               H264_PICTURE_TOP_FIELD
+#define BOTTOM_FIELD            H264_PICTURE_BOTTOM_FIELD
+#define FRAME                   (TOP_FIELD | BOTTOM_FIELD)
+
+typedef struct _H264SPS         H264SPS;
+typedef struct _H264PPS         H264PPS;
+typedef struct _H264MMCO        H264MMCO;
+typedef struct _H264SliceHeader H264SliceHeader;
+typedef struct _H264Frame       H264Frame;
+typedef struct _H264RefEntry    H264RefEntry;
+
+struct _H264SPS {
+    unsigned int        profile_idc;
+    unsigned int        level_idc;
+    unsigned int        chroma_format_idc;
+    unsigned int        separate_colour_plane_flag;
+    unsigned int        bit_depth_luma_minus8;
+    unsigned int        bit_depth_chroma_minus8;
+    unsigned int        scaling_matrix_present_flag;
+    uint8_t             scaling_lists_4x4[6][16];
+    uint8_t             scaling_lists_8x8[6][64];
+    unsigned int        log2_max_frame_num;
+    unsigned int        pic_order_cnt_type;
+    unsigned int        log2_max_pic_order_cnt_lsb;
+    unsigned int        delta_pic_order_always_zero_flag;
+    int                 offset_for_non_ref_pic;
+    int                 offset_for_top_to_bottom_field;
+    unsigned int        num_ref_frames_in_pic_order_cnt_cycle;
+    int                 offset_for_ref_frame[255];
+    unsigned int        num_ref_frames;
+    unsigned int        gaps_in_frame_num_value_allowed_flag;
+    unsigned int        pic_width_in_mbs;
+    unsigned int        pic_height_in_map_units;
+    unsigned int        frame_mbs_only_flag;
+    unsigned int        mb_adaptive_frame_field_flag;
+    unsigned int        direct_8x8_inference_flag;
+    unsigned int        width;          // after cropping
+    unsigned int        height;
+};
+
+struct _H264PPS {
+    unsigned int        seq_parameter_set_id;
+    unsigned int        entropy_coding_mode_flag;
+    unsigned int        pic_order_present_flag;
+    unsigned int        num_slice_groups_minus1;
+    unsigned int        slice_group_map_type;
+    unsigned int        slice_group_change_rate_minus1;
+    unsigned int        num_ref_idx_default_active[2];
+    unsigned int        weighted_pred_flag;
+    unsigned int        weighted_bipred_idc;
+    int                 pic_init_qp_minus26;
+    int                 pic_init_qs_minus26;
+    int                 chroma_qp_index_offset;
+    int                 second_chroma_qp_index_offset;
+    unsigned int        deblocking_filter_control_present_flag;
+    unsigned int        constrained_intra_pred_flag;
+    unsigned int        redundant_pic_cnt_present_flag;
+    unsigned int        transform_8x8_mode_flag;
+    uint8_t             scaling_lists_4x4[6][16];
+    uint8_t             scaling_lists_8x8[6][64];
+};
+
+struct _H264MMCO {
+    unsigned int        op;
+    unsigned int        value;          // difference_of_pic_nums_minus1,
+                                        // long_term_pic_num or
+                                        // max_long_term_frame_idx_plus1
+    unsigned int        long_term_frame_idx;
+};
+
+struct _H264SliceHeader {
+    H264SliceInfo       info;
+    unsigned int        nal_unit_type;
+    unsigned int        nal_ref_idc;
+    unsigned int        pic_parameter_set_id;
+    unsigned int        frame_num;
+    unsigned int        field_pic_flag;
+    unsigned int        bottom_field_flag;
+    unsigned int        idr_pic_id;
+    unsigned int        pic_order_cnt_lsb;
+    int                 delta_pic_order_cnt_bottom;
+    int                 delta_pic_order_cnt[2];
+    unsigned int        redundant_pic_cnt;
+    unsigned int        num_ref_idx_active[2];
+    unsigned int        num_modifications[2];
+    unsigned int        modification_of_pic_nums_idc[2][33];
+    unsigned int        modification_value[2][33];
+    unsigned int        long_term_reference_flag;
+    unsigned int        adaptive_ref_pic_marking_mode_flag;
+    unsigned int        num_mmcos;
+    H264MMCO            mmcos[MAX_MMCO_COUNT];
+};
+
+/* A frame of the DPB, it is free when none of its fields is a reference */
+struct _H264Frame {
+    int                 frame_idx;      // -1 for frames inferred from gaps
+    unsigned int        frame_num;
+    int                 frame_num_wrap;
+    unsigned int        long_term_frame_idx;
+    int                 field_order_cnt[2];
+    unsigned int        short_ref;      // fields used for short-term reference
+    unsigned int        long_ref;       // fields used for long-term reference
+};
+
+/* An entry of a reference picture list, either a frame or a field */
+struct _H264RefEntry {
+    H264Frame          *frame;
+    unsigned int        fields;
+    unsigned int        long_term;
+};
+
+struct _H264Parser {
+    const uint8_t      *buf;
+    size_t              size;
+    size_t              pos;            // offset of the next NAL unit
+    size_t              next_pos;       // offset past the NAL unit at POS
+
+    /* MP4 input, with length-prefixed NAL units */
+    MP4Demuxer         *mp4;
+    unsigned int        nal_length_size;
+    unsigned int        sample;         // next sample to read
+    size_t              sample_end;
+
+    H264SPS            *sps[MAX_SPS_COUNT];
+    H264PPS            *pps[MAX_PPS_COUNT];
+    uint8_t            *rbsp;
+    unsigned int        rbsp_size;
+
+    /* Current picture */
+    H264SliceHeader     first_slice;
+    const H264SPS      *cur_sps;
+    const H264PPS      *cur_pps;
+    H264Frame           cur_frame;
+    unsigned int        cur_fields;
+    int                 cur_poc;
+    unsigned int        is_second_field;
+    unsigned int        first_field;    // parity of an unpaired field
+    unsigned int        has_mmco5;
+
+    /* Picture order count state */
+    int                 poc_msb;
+    int                 prev_poc_msb;
+    unsigned int        prev_poc_lsb;
+    unsigned int        frame_num_offset;
+    unsigned int        prev_frame_num_offset;
+    unsigned int        prev_frame_num;
+    unsigned int        prev_ref_frame_num;
+
+    /* Reference frames */
+    H264Frame           dpb[MAX_DPB_SIZE + 1];
+    int                 max_long_term_frame_idx;
+    unsigned int        num_frames;
+
+    H264SliceInfo      *slices;
+    unsigned int        slices_size;
+};
+
+/* Unescapes up to MAX_SIZE bytes of NAL into the parser buffer, and
+   starts reading them. Returns the unescaped size, or -1 on error */
+static int
+load_rbsp(H264Parser *parser, GetBitContext *gb, const uint8_t *nal,
+          unsigned int size, unsigned int max_size)
+{
+    size = MIN(size, max_size);
+    parser->rbsp = fast_realloc(parser->rbsp, &parser->rbsp_size, size);
+    if (!parser->rbsp)
+        return -1;
+
+    size = startcode_unescape(parser->rbsp, nal, size);
+    init_get_bits(gb, parser->rbsp, size);
+    return size;
+}
+
+/* Returns whether there is more data before the RBSP trailing bits */
+static int more_rbsp_data(H264Parser *parser, GetBitContext *gb, unsigned int size)
+{
+    const uint8_t * const rbsp = parser->rbsp;
+
+    while (size > 0 && rbsp[size - 1] == 0)
+        size--;
+    if (size == 0)
+        return 0;
+    return get_bits_count(gb) < size * 8 - 1 - __builtin_ctz(rbsp[size - 1]);
+}
+
+/* Converts a bit offset into the RBSP of NAL to one into NAL itself */
+static unsigned int
+get_escaped_bit_offset(const uint8_t *nal, unsigned int size, unsigned int offset)
+{
+    unsigned int i, n = 0, zeros = 0;
+
+    for (i = 0; i < size; i++) {
+        if (zeros >= 2 && nal[i] == 3) {
+            zeros = 0;
+            continue;
+        }
+        if (n == offset / 8)
+            break;
+        zeros = nal[i] ? 0 : zeros + 1;
+        n++;
+    }
+    return i * 8 + offset % 8;
+}
+
+static void
+read_scaling_list(GetBitContext *gb, uint8_t *list, unsigned int size,
+                  const uint8_t *default_list, const uint8_t *fallback_list)
+{
+    unsigned int i, last_scale = 8, next_scale = 8;
+
+    if (!get_bits1(gb)) {
+        memcpy(list, fallback_list, size);
+        return;
+    }
+
+    for (i = 0; i < size; i++) {
+        if (next_scale) {
+            next_scale = (last_scale + get_se_golomb(gb)) & 0xff;
+            if (i == 0 && next_scale == 0) {
+                memcpy(list, default_list, size);
+                return;
+            }
+        }
+        list[i] = next_scale ? next_scale : last_scale;
+        last_scale = list[i];
+    }
+}
+
+/* Reads the 4x4 lists and N8X8 8x8 lists, with the fall-back lists of
+   the first intra and inter ones (7.4.2.1.1) */
+static void
+read_scaling_lists(GetBitContext *gb, uint8_t lists_4x4[6][16],
+                   uint8_t lists_8x8[6][64], unsigned int n8x8,
+                   const uint8_t *fallback_4x4[2], const uint8_t *fallback_8x8[2])
+{
+    unsigned int i;
+
+    for (i = 0; i < 6; i++)
+        read_scaling_list(gb, lists_4x4[i], 16,
+                          i < 3 ? default_4x4_intra : default_4x4_inter,
+                          i % 3 ? lists_4x4[i - 1] : fallback_4x4[i / 3]);
+
+    for (i = 0; i < n8x8; i++)
+        read_scaling_list(gb, lists_8x8[i], 64,
+                          i & 1 ? default_8x8_inter : default_8x8_intra,
+                          i < 2 ? fallback_8x8[i] : lists_8x8[i - 2]);
+}
+
+static int parse_sps(H264Parser *parser, const uint8_t *nal, unsigned int size)
+{
+    static const uint8_t *default_4x4[2] = { default_4x4_intra, default_4x4_inter };
+    static const uint8_t *default_8x8[2] = { default_8x8_intra, default_8x8_inter };
+    H264SPS *sps = NULL;
+    GetBitContext gb;
+    unsigned int i, id, profile_idc, level_idc, frame_height_in_mbs;
+    unsigned int crop_left, crop_right, crop_top, crop_bottom;
+    unsigned int crop_unit_x, crop_unit_y;
+
+    if (load_rbsp(parser, &gb, nal, size, size) < 0)
+        return -1;
+
+    skip_bits(&gb, 8);
+    profile_idc = get_bits(&gb, 8);
+    skip_bits(&gb, 8);                  // constraint_set_flags, reserved
+    level_idc   = get_bits(&gb, 8);
+    id          = get_ue_golomb(&gb);
+    if (id >= MAX_SPS_COUNT)
+        goto error;
+
+    sps = calloc(1, sizeof(*sps));
+    if (!sps)
+        goto error;
+    sps->profile_idc       = profile_idc;
+    sps->level_idc         = level_idc;
+    sps->chroma_format_idc = 1;
+
+    switch (profile_idc) {
+    case 100: case 110: case 122: case 244: case 44:
+    case 83: case 86: case 118: case 128: case 138: case 139: case 134: case 135:
+        sps->chroma_format_idc = get_ue_golomb(&gb);
+        if (sps->chroma_format_idc > 3)
+            goto error;
+        if (sps->chroma_format_idc == 3)
+            sps->separate_colour_plane_flag = get_bits1(&gb);
+        sps->bit_depth_luma_minus8   = get_ue_golomb(&gb);
+        sps->bit_depth_chroma_minus8 = get_ue_golomb(&gb);
+        if (sps->bit_depth_luma_minus8 > 6 || sps->bit_depth_chroma_minus8 > 6)
+            goto error;
+        skip_bits(&gb, 1);              // qpprime_y_zero_transform_bypass_flag
+        sps->scaling_matrix_present_flag = get_bits1(&gb);
+        if (sps->scaling_matrix_present_flag)
+            read_scaling_lists(&gb, sps->scaling_lists_4x4, sps->scaling_lists_8x8,
+                               sps->chroma_format_idc != 3 ? 2 : 6,
+                               default_4x4, default_8x8);
+        break;
+    }
+    if (!sps->scaling_matrix_present_flag) {
+        memset(sps->scaling_lists_4x4, 16, sizeof(sps->scaling_lists_4x4));
+        memset(sps->scaling_lists_8x8, 16, sizeof(sps->scaling_lists_8x8));
+    }
+
+    sps->log2_max_frame_num = get_ue_golomb(&gb) + 4;
+    sps->pic_order_cnt_type = get_ue_golomb(&gb);
+    if (sps->log2_max_frame_num > 16 || sps->pic_order_cnt_type > 2)
+        goto error;
+
+    switch (sps->pic_order_cnt_type) {
+    case 0:
+        sps->log2_max_pic_order_cnt_lsb = get_ue_golomb(&gb) + 4;
+        if (sps->log2_max_pic_order_cnt_lsb > 16)
+            goto error;
+        break;
+    case 1:
+        sps->delta_pic_order_always_zero_flag      = get_bits1(&gb);
+        sps->offset_for_non_ref_pic                = get_se_golomb(&gb);
+        sps->offset_for_top_to_bottom_field        = get_se_golomb(&gb);
+        sps->num_ref_frames_in_pic_order_cnt_cycle = get_ue_golomb(&gb);
+        if (sps->num_ref_frames_in_pic_order_cnt_cycle > 255)
+            goto error;
+        for (i = 0; i < sps->num_ref_frames_in_pic_order_cnt_cycle; i++)
+            sps->offset_for_ref_frame[i] = get_se_golomb(&gb);
+        break;
+    }
+
+    sps->num_ref_frames                       = get_ue_golomb(&gb);
+    sps->gaps_in_frame_num_value_allowed_flag = get_bits1(&gb);
+    sps->pic_width_in_mbs                     = get_ue_golomb(&gb) + 1;
+    sps->pic_height_in_map_units              = get_ue_golomb(&gb) + 1;
+    sps->frame_mbs_only_flag                  = get_bits1(&gb);
+    if (!sps->frame_mbs_only_flag)
+        sps->mb_adaptive_frame_field_flag     = get_bits1(&gb);
+    sps->direct_8x8_inference_flag            = get_bits1(&gb);
+    if (sps->num_ref_frames > MAX_DPB_SIZE ||
+        sps->pic_width_in_mbs > 1024 || sps->pic_height_in_map_units > 1024)
+        goto error;
+
+    /* Cropping is in chroma samples, and field lines for field coding */
+    frame_height_in_mbs = sps->pic_height_in_map_units << !sps->frame_mbs_only_flag;
+    sps->width  = sps->pic_width_in_mbs * 16;
+    sps->height = frame_height_in_mbs * 16;
+    if (get_bits1(&gb)) {
+        crop_left   = get_ue_golomb(&gb);
+        crop_right  = get_ue_golomb(&gb);
+        crop_top    = get_ue_golomb(&gb);
+        crop_bottom = get_ue_golomb(&gb);
+        crop_unit_x = 1;
+        crop_unit_y = 2 - sps->frame_mbs_only_flag;
+        if (!sps->separate_colour_plane_flag && sps->chroma_format_idc > 0) {
+            if (sps->chroma_format_idc < 3)
+                crop_unit_x *= 2;
+            if (sps->chroma_format_idc < 2)
+                crop_unit_y *= 2;
+        }
+        if ((uint64_t)(crop_left + crop_right) * crop_unit_x < sps->width &&
+            (uint64_t)(crop_top + crop_bottom) * crop_unit_y < sps->height) {
+            sps->width  -= (crop_left + crop_right) * crop_unit_x;
+            sps->height -= (crop_top + crop_bottom) * crop_unit_y;
+        }
+    }
+    if (get_bits_left(&gb) < 0)
+        goto error;
+
+    free(parser->sps[id]);
+    parser->sps[id] = sps;
+    return 0;
+
+error:
+    D(bug("invalid sequence parameter set\n"));
+    free(sps);
+    return -1;
+}
+
+static int parse_pps(H264Parser *parser, const uint8_t *nal, unsigned int size)
+{
+    const uint8_t *fallback_4x4[2], *fallback_8x8[2];
+    const H264SPS *sps;
+    H264PPS *pps = NULL;
+    GetBitContext gb;
+    unsigned int i, id, bits, rbsp_size;
+    int ret;
+
+    if ((ret = load_rbsp(parser, &gb, nal, size, size)) < 0)
+        return -1;
+    rbsp_size = ret;
+
+    skip_bits(&gb, 8);
+    id = get_ue_golomb(&gb);
+    if (id >= MAX_PPS_COUNT)
+        goto error;
+
+    pps = calloc(1, sizeof(*pps));
+    if (!pps)
+        goto error;
+    pps->seq_parameter_set_id = get_ue_golomb(&gb);
+    if (pps->seq_parameter_set_id >= MAX_SPS_COUNT ||
+        !(sps = parser->sps[pps->seq_parameter_set_id]))
+        goto error;
+
+    pps->entropy_coding_mode_flag = get_bits1(&gb);
+    pps->pic_order_present_flag   = get_bits1(&gb);
+    pps->num_slice_groups_minus1  = get_ue_golomb(&gb);
+    if (pps->num_slice_groups_minus1 > 7)
+        goto error;
+    if (pps->num_slice_groups_minus1 > 0) {
+        pps->slice_group_map_type = get_ue_golomb(&gb);
+        switch (pps->slice_group_map_type) {
+        case 0:
+            for (i = 0; i <= pps->num_slice_groups_minus1; i++)
+                get_ue_golomb(&gb);     // run_length_minus1
+            break;
+        case 2:
+            for (i = 0; i < pps->num_slice_groups_minus1; i++) {
+                get_ue_golomb(&gb);     // top_left
+                get_ue_golomb(&gb);     // bottom_right
+            }
+            break;
+        case 3: case 4: case 5:
+            skip_bits(&gb, 1);          // slice_group_change_direction_flag
+            pps->slice_group_change_rate_minus1 = get_ue_golomb(&gb);
+            break;
+        case 6:
+            for (bits = 0; (1U << bits) <= pps->num_slice_groups_minus1; bits++)
+                ;
+            skip_bits_long(&gb, (get_ue_golomb(&gb) + 1) * bits);
+            break;
+        }
+    }
+
+    pps->num_ref_idx_default_active[0]  = get_ue_golomb(&gb) + 1;
+    pps->num_ref_idx_default_active[1]  = get_ue_golomb(&gb) + 1;
+    pps->weighted_pred_flag             = get_bits1(&gb);
+    pps->weighted_bipred_idc            = get_bits(&gb, 2);
+    pps->pic_init_qp_minus26            = get_se_golomb(&gb);
+    pps->pic_init_qs_minus26            = get_se_golomb(&gb);
+    pps->chroma_qp_index_offset         = get_se_golomb(&gb);
+    pps->deblocking_filter_control_present_flag = get_bits1(&gb);
+    pps->constrained_intra_pred_flag    = get_bits1(&gb);
+    pps->redundant_pic_cnt_present_flag = get_bits1(&gb);
+    pps->second_chroma_qp_index_offset  = pps->chroma_qp_index_offset;
+    if (pps->num_ref_idx_default_active[0] > 32 ||
+        pps->num_ref_idx_default_active[1] > 32)
+        goto error;
+
+    /* Lists not present in the PPS are the SPS ones */
+    memcpy(pps->scaling_lists_4x4, sps->scaling_lists_4x4, sizeof(pps->scaling_lists_4x4));
+    memcpy(pps->scaling_lists_8x8, sps->scaling_lists_8x8, sizeof(pps->scaling_lists_8x8));
+
+    if (more_rbsp_data(parser, &gb, rbsp_size)) {
+        pps->transform_8x8_mode_flag = get_bits1(&gb);
+        if (get_bits1(&gb)) {
+            if (sps->scaling_matrix_present_flag) {
+                fallback_4x4[0] = sps->scaling_lists_4x4[0];
+                fallback_4x4[1] = sps->scaling_lists_4x4[3];
+                fallback_8x8[0] = sps->scaling_lists_8x8[0];
+                fallback_8x8[1] = sps->scaling_lists_8x8[1];
+            }
+            else {
+                fallback_4x4[0] = default_4x4_intra;
+                fallback_4x4[1] = default_4x4_inter;
+                fallback_8x8[0] = default_8x8_intra;
+                fallback_8x8[1] = default_8x8_inter;
+            }
+            read_scaling_lists(&gb, pps->scaling_lists_4x4, pps->scaling_lists_8x8,
+                               pps->transform_8x8_mode_flag *
+                               (sps->chroma_format_idc != 3 ? 2 : 6),
+                               fallback_4x4, fallback_8x8);
+        }
+        pps->second_chroma_qp_index_offset = get_se_golomb(&gb);
+    }
+    if (get_bits_left(&gb) < 0)
+        goto error;
+
+    free(parser->pps[id]);
+    parser->pps[id] = pps;
+    return 0;
+
+error:
+    D(bug("invalid picture parameter set\n"));
+    free(pps);
+    return -1;
+}
+
+static int parse_parameter_set(H264Parser *parser, const uint8_t *nal, unsigned int size)
+{
+    switch (nal[0] & 0x1f) {
+    case NAL_SPS:
+        return parse_sps(parser, nal, size);
+    case NAL_PPS:
+        return parse_pps(parser, nal, size);
+    }
+    return 0;
+}
+
+/* Reads the weights of one reference list, with explicit weights
+   flagged if any entry has some */
+static void
+read_pred_weights(GetBitContext *gb, const H264SliceInfo *slice,
+                  unsigned int count, unsigned int chroma_array_type,
+                  unsigned char *luma_weight_flag,
+                  short luma_weight[32], short luma_offset[32],
+                  unsigned char *chroma_weight_flag,
+                  short chroma_weight[32][2], short chroma_offset[32][2])
+{
+    unsigned int i, j;
+
+    for (i = 0; i < count; i++) {
+        luma_weight[i] = 1 << slice->luma_log2_weight_denom;
+        luma_offset[i] = 0;
+        if (get_bits1(gb)) {
+            *luma_weight_flag = 1;
+            luma_weight[i] = get_se_golomb(gb);
+            luma_offset[i] = get_se_golomb(gb);
+        }
+        if (!chroma_array_type)
+            continue;
+        for (j = 0; j < 2; j++) {
+            chroma_weight[i][j] = 1 << slice->chroma_log2_weight_denom;
+            chroma_offset[i][j] = 0;
+        }
+        if (get_bits1(gb)) {
+            *chroma_weight_flag = 1;
+            for (j = 0; j < 2; j++) {
+                chroma_weight[i][j] = get_se_golomb(gb);
+                chroma_offset[i][j] = get_se_golomb(gb);
+            }
+        }
+    }
+}
+
+static void
+parse_pred_weight_table(const H264SPS *sps, H264SliceHeader *hdr, GetBitContext *gb)
+{
+    H264SliceInfo * const slice = &hdr->info;
+    const unsigned int chroma_array_type =
+        sps->separate_colour_plane_flag ? 0 : sps->chroma_format_idc;
+
+    slice->luma_log2_weight_denom = get_ue_golomb(gb) & 7;
+    if (chroma_array_type)
+        slice->chroma_log2_weight_denom = get_ue_golomb(gb) & 7;
+
+    read_pred_weights(gb, slice, hdr->num_ref_idx_active[0], chroma_array_type,
+                      &slice->luma_weight_l0_flag,
+                      slice->luma_weight_l0, slice->luma_offset_l0,
+                      &slice->chroma_weight_l0_flag,
+                      slice->chroma_weight_l0, slice->chroma_offset_l0);
+    read_pred_weights(gb, slice, hdr->num_ref_idx_active[1], chroma_array_type,
+                      &slice->luma_weight_l1_flag,
+                      slice->luma_weight_l1, slice->luma_offset_l1,
+                      &slice->chroma_weight_l1_flag,
+                      slice->chroma_weight_l1, slice->chroma_offset_l1);
+}
+
+static int
+parse_ref_pic_list_modification(H264SliceHeader *hdr, GetBitContext *gb,
+                                unsigned int list)
+{
+    unsigned int i, idc;
+
+    if (!get_bits1(gb))                 // ref_pic_list_modification_flag
+        return 0;
+
+    for (i = 0; (idc = get_ue_golomb(gb)) != 3; i++) {
+        if (idc > 2 || i >= ARRAY_ELEMS(hdr->modification_of_pic_nums_idc[list]) ||
+            get_bits_left(gb) < 0)
+            return -1;
+        hdr->modification_of_pic_nums_idc[list][i] = idc;
+        hdr->modification_value[list][i] = get_ue_golomb(gb);
+    }
+    hdr->num_modifications[list] = i;
+    return 0;
+}
+
+static int parse_dec_ref_pic_marking(H264SliceHeader *hdr, GetBitContext *gb)
+{
+    H264MMCO *mmco;
+    unsigned int op;
+
+    if (hdr->nal_unit_type == NAL_IDR_SLICE) {
+        skip_bits(gb, 1);               // no_output_of_prior_pics_flag
+        hdr->long_term_reference_flag = get_bits1(gb);
+        return 0;
+    }
+
+    hdr->adaptive_ref_pic_marking_mode_flag = get_bits1(gb);
+    if (!hdr->adaptive_ref_pic_marking_mode_flag)
+        return 0;
+
+    while ((op = get_ue_golomb(gb)) != 0) {
+        if (op > 6 || hdr->num_mmcos >= MAX_MMCO_COUNT || get_bits_left(gb) < 0)
+            return -1;
+        mmco = &hdr->mmcos[hdr->num_mmcos++];
+        mmco->op = op;
+        if (op == 1 || op == 2 || op == 4)
+            mmco->value = get_ue_golomb(gb);
+        else if (op == 3) {
+            mmco->value = get_ue_golomb(gb);
+            mmco->long_term_frame_idx = get_ue_golomb(gb);
+        }
+        else if (op == 6)
+            mmco->long_term_frame_idx = get_ue_golomb(gb);
+    }
+    return 0;
+}
+
+/* Parses the slice header, up to the slice data */
+static int
+parse_slice_header(H264Parser *parser, H264SliceHeader *hdr,
+                   const uint8_t *nal, unsigned int size)
+{
+    H264SliceInfo * const slice = &hdr->info;
+    const H264SPS *sps;
+    const H264PPS *pps;
+    GetBitContext gb;
+    unsigned int list, num_lists, slice_type, max_refs;
+    unsigned int pic_size, change_rate, bits;
+
+    if (load_rbsp(parser, &gb, nal, size, MAX_SLICE_HEADER_SIZE) < 0)
+        return -1;
+
+    memset(hdr, 0, sizeof(*hdr));
+    hdr->nal_ref_idc   = (nal[0] >> 5) & 3;
+    hdr->nal_unit_type = nal[0] & 0x1f;
+    skip_bits(&gb, 8);
+
+    slice->first_mb_in_slice = get_ue_golomb(&gb);
+    slice_type = get_ue_golomb(&gb);
+    if (slice_type > 9)
+        return -1;
+    slice->slice_type = slice_type % 5;
+
+    hdr->pic_parameter_set_id = get_ue_golomb(&gb);
+    if (hdr->pic_parameter_set_id >= MAX_PPS_COUNT ||
+        !(pps = parser->pps[hdr->pic_parameter_set_id]) ||
+        !(sps = parser->sps[pps->seq_parameter_set_id])) {
+        D(bug("missing parameter sets for slice\n"));
+        return -1;
+    }
+
+    if (sps->separate_colour_plane_flag)
+        skip_bits(&gb, 2);              // colour_plane_id
+    hdr->frame_num = get_bits(&gb, sps->log2_max_frame_num);
+    if (!sps->frame_mbs_only_flag) {
+        hdr->field_pic_flag = get_bits1(&gb);
+        if (hdr->field_pic_flag)
+            hdr->bottom_field_flag = get_bits1(&gb);
+    }
+    if (hdr->nal_unit_type == NAL_IDR_SLICE)
+        hdr->idr_pic_id = get_ue_golomb(&gb);
+
+    if (sps->pic_order_cnt_type == 0) {
+        hdr->pic_order_cnt_lsb = get_bits(&gb, sps->log2_max_pic_order_cnt_lsb);
+        if (pps->pic_order_present_flag && !hdr->field_pic_flag)
+            hdr->delta_pic_order_cnt_bottom = get_se_golomb(&gb);
+    }
+    if (sps->pic_order_cnt_type == 1 && !sps->delta_pic_order_always_zero_flag) {
+        hdr->delta_pic_order_cnt[0] = get_se_golomb(&gb);
+        if (pps->pic_order_present_flag && !hdr->field_pic_flag)
+            hdr->delta_pic_order_cnt[1] = get_se_golomb(&gb);
+    }
+    if (pps->redundant_pic_cnt_present_flag)
+        hdr->redundant_pic_cnt = get_ue_golomb(&gb);
+    if (slice->slice_type == SLICE_TYPE_B)
+        slice->direct_spatial_mv_pred_flag = get_bits1(&gb);
+
+    switch (slice->slice_type) {
+    case SLICE_TYPE_P:
+    case SLICE_TYPE_SP:
+        num_lists = 1;
+        break;
+    case SLICE_TYPE_B:
+        num_lists = 2;
+        break;
+    default:
+        num_lists = 0;
+        break;
+    }
+
+    for (list = 0; list < num_lists; list++)
+        hdr->num_ref_idx_active[list] = pps->num_ref_idx_default_active[list];
+    if (num_lists > 0 && get_bits1(&gb)) {  // num_ref_idx_active_override_flag
+        for (list = 0; list < num_lists; list++)
+            hdr->num_ref_idx_active[list] = get_ue_golomb(&gb) + 1;
+    }
+    max_refs = hdr->field_pic_flag ? 32 : 16;
+    if (hdr->num_ref_idx_active[0] > max_refs || hdr->num_ref_idx_active[1] > max_refs)
+        return -1;
+    slice->num_ref_idx_l0_active_minus1 = MAX(hdr->num_ref_idx_active[0], 1) - 1;
+    slice->num_ref_idx_l1_active_minus1 = MAX(hdr->num_ref_idx_active[1], 1) - 1;
+
+    for (list = 0; list < num_lists; list++) {
+        if (parse_ref_pic_list_modification(hdr, &gb, list) < 0)
+            return -1;
+    }
+
+    if ((pps->weighted_pred_flag && num_lists == 1) ||
+        (pps->weighted_bipred_idc == 1 && num_lists == 2))
+        parse_pred_weight_table(sps, hdr, &gb);
+
+    if (hdr->nal_ref_idc && parse_dec_ref_pic_marking(hdr, &gb) < 0)
+        return -1;
+
+    if (pps->entropy_coding_mode_flag &&
+        slice->slice_type != SLICE_TYPE_I && slice->slice_type != SLICE_TYPE_SI)
+        slice->cabac_init_idc = get_ue_golomb(&gb);
+    slice->slice_qp_delta = get_se_golomb(&gb);
+    if (slice->slice_type == SLICE_TYPE_SP || slice->slice_type == SLICE_TYPE_SI) {
+        if (slice->slice_type == SLICE_TYPE_SP)
+            skip_bits(&gb, 1);          // sp_for_switch_flag
+        get_se_golomb(&gb);             // slice_qs_delta
+    }
+    if (pps->deblocking_filter_control_present_flag) {
+        slice->disable_deblocking_filter_idc = get_ue_golomb(&gb);
+        if (slice->disable_deblocking_filter_idc != 1) {
+            slice->slice_alpha_c0_offset_div2 = get_se_golomb(&gb);
+            slice->slice_beta_offset_div2     = get_se_golomb(&gb);
+        }
+    }
+    if (pps->num_slice_groups_minus1 > 0 &&
+        pps->slice_group_map_type >= 3 && pps->slice_group_map_type <= 5) {
+        /* Ceil(Log2(PicSizeInMapUnits / SliceGroupChangeRate + 1)) bits */
+        pic_size    = sps->pic_width_in_mbs * sps->pic_height_in_map_units;
+        change_rate = pps->slice_group_change_rate_minus1 + 1;
+        for (bits = 0; ((uint64_t)change_rate << bits) < pic_size + change_rate; bits++)
+            ;
+        skip_bits(&gb, bits);           // slice_group_change_cycle
+    }
+    if (get_bits_left(&gb) < 0)
+        return -1;
+
+    slice->macroblock_offset = get_escaped_bit_offset(nal, size, get_bits_count(&gb));
+    return 0;
+}
+
+/* Checks whether the slice starts a new picture (7.4.1.2.4) */
+static int
+is_new_picture(const H264SliceHeader *a, const H264SliceHeader *b)
+{
+    return (a->frame_num                  != b->frame_num ||
+            a->pic_parameter_set_id       != b->pic_parameter_set_id ||
+            a->field_pic_flag             != b->field_pic_flag ||
+            a->bottom_field_flag          != b->bottom_field_flag ||
+            !a->nal_ref_idc               != !b->nal_ref_idc ||
+            a->pic_order_cnt_lsb          != b->pic_order_cnt_lsb ||
+            a->delta_pic_order_cnt_bottom != b->delta_pic_order_cnt_bottom ||
+            a->delta_pic_order_cnt[0]     != b->delta_pic_order_cnt[0] ||
+            a->delta_pic_order_cnt[1]     != b->delta_pic_order_cnt[1] ||
+            (a->nal_unit_type == NAL_IDR_SLICE) != (b->nal_unit_type == NAL_IDR_SLICE) ||
+            (a->nal_unit_type == NAL_IDR_SLICE && a->idr_pic_id != b->idr_pic_id));
+}
+
+/* Computes the field order counts of the current picture (8.2.1) */
+static void
+compute_poc(H264Parser *parser, const H264SliceHeader *hdr, int poc[2])
+{
+    const H264SPS * const sps = parser->cur_sps;
+    const unsigned int max_frame_num = 1U << sps->log2_max_frame_num;
+    const int is_idr = hdr->nal_unit_type == NAL_IDR_SLICE;
+    int max_poc_lsb, expected_poc, delta_per_cycle;
+    unsigned int i, abs_frame_num, num_cycle;
+
+    if (is_idr)
+        parser->frame_num_offset = 0;
+    else if (parser->prev_frame_num > hdr->frame_num)
+        parser->frame_num_offset = parser->prev_frame_num_offset + max_frame_num;
+    else
+        parser->frame_num_offset = parser->prev_frame_num_offset;
+
+    switch (sps->pic_order_cnt_type) {
+    case 0:
+        if (is_idr) {
+            parser->prev_poc_msb = 0;
+            parser->prev_poc_lsb = 0;
+        }
+        max_poc_lsb = 1 << sps->log2_max_pic_order_cnt_lsb;
+        if (hdr->pic_order_cnt_lsb < parser->prev_poc_lsb &&
+            parser->prev_poc_lsb - hdr->pic_order_cnt_lsb >= max_poc_lsb / 2)
+            parser->poc_msb = parser->prev_poc_msb + max_poc_lsb;
+        else if (hdr->pic_order_cnt_lsb > parser->prev_poc_lsb &&
+                 hdr->pic_order_cnt_lsb - parser->prev_poc_lsb > max_poc_lsb / 2)
+            parser->poc_msb = parser->prev_poc_msb - max_poc_lsb;
+        else
+            parser->poc_msb = parser->prev_poc_msb;
+        poc[0] = parser->poc_msb + hdr->pic_order_cnt_lsb;
+        poc[1] = poc[0];
+        if (!hdr->field_pic_flag)
+            poc[1] += hdr->delta_pic_order_cnt_bottom;
+        break;
+    case 1:
+        num_cycle = sps->num_ref_frames_in_pic_order_cnt_cycle;
+        abs_frame_num = num_cycle ? parser->frame_num_offset + hdr->frame_num : 0;
+        if (!hdr->nal_ref_idc && abs_frame_num > 0)
+            abs_frame_num--;
+
+        expected_poc = 0;
+        if (abs_frame_num > 0) {
+            for (delta_per_cycle = 0, i = 0; i < num_cycle; i++)
+                delta_per_cycle += sps->offset_for_ref_frame[i];
+            expected_poc = (abs_frame_num - 1) / num_cycle * delta_per_cycle;
+            for (i = 0; i <= (abs_frame_num - 1) % num_cycle; i++)
+                expected_poc += sps->offset_for_ref_frame[i];
+        }
+        if (!hdr->nal_ref_idc)
+            expected_poc += sps->offset_for_non_ref_pic;
+
+        if (!hdr->field_pic_flag) {
+            poc[0] = expected_poc + hdr->delta_pic_order_cnt[0];
+            poc[1] = poc[0] + sps->offset_for_top_to_bottom_field +
+                hdr->delta_pic_order_cnt[1];
+        }
+        else {
+            poc[0] = expected_poc + hdr->delta_pic_order_cnt[0];
+            poc[1] = poc[0] + sps->offset_for_top_to_bottom_field;
+            if (hdr->bottom_field_flag)
+                poc[0] = poc[1];
+            else
+                poc[1] = poc[0];
+        }
+        break;
+    default:
+        if (is_idr)
+            poc[0] = 0;
+        else if (!hdr->nal_ref_idc)
+            poc[0] = 2 * (parser->frame_num_offset + hdr->frame_num) - 1;
+        else
+            poc[0] = 2 * (parser->frame_num_offset + hdr->frame_num);
+        poc[1] = poc[0];
+        break;
+    }
+}
+
+static inline int get_frame_poc(const H264Frame *frame, unsigned int fields)
+{
+    if (fields == TOP_FIELD)
+        return frame->field_order_cnt[0];
+    if (fields == BOTTOM_FIELD)
+        return frame->field_order_cnt[1];
+    return MIN(frame->field_order_cnt[0], frame->field_order_cnt[1]);
+}
+
+static inline int get_frame_num_wrap(const H264Parser *parser, unsigned int frame_num,
+                                     unsigned int cur_frame_num)
+{
+    if (frame_num > cur_frame_num)
+        return frame_num - (1 << parser->cur_sps->log2_max_frame_num);
+    return frame_num;
+}
+
+/* Returns the (frame or field) picture number of the current picture */
+static inline int get_cur_pic_num(const H264Parser *parser)
+{
+    const unsigned int frame_num = parser->first_slice.frame_num;
+
+    return parser->cur_fields == FRAME ? frame_num : 2 * frame_num + 1;
+}
+
+/* Finds the short-term reference frame or field with PicNum PIC_NUM, or
+   the long-term one with LongTermPicNum PIC_NUM (8.2.4.1) */
+static H264Frame *
+find_ref_pic(H264Parser *parser, int pic_num, int long_term, unsigned int *pfields)
+{
+    H264Frame *frame;
+    unsigned int i, field, fields;
+    int num;
+
+    for (i = 0; i < ARRAY_ELEMS(parser->dpb); i++) {
+        frame  = &parser->dpb[i];
+        fields = long_term ? frame->long_ref : frame->short_ref;
+        num    = long_term ? (int)frame->long_term_frame_idx : frame->frame_num_wrap;
+        if (parser->cur_fields == FRAME) {
+            if (fields == FRAME && num == pic_num) {
+                *pfields = FRAME;
+                return frame;
+            }
+            continue;
+        }
+        for (field = TOP_FIELD; field <= BOTTOM_FIELD; field <<= 1) {
+            if ((fields & field) && 2 * num + (field == parser->cur_fields) == pic_num) {
+                *pfields = field;
+                return frame;
+            }
+        }
+    }
+    return NULL;
+}
+
+static H264Frame *find_frame(H264Parser *parser, int frame_idx)
+{
+    H264Frame *frame;
+    unsigned int i;
+
+    for (i = 0; i < ARRAY_ELEMS(parser->dpb); i++) {
+        frame = &parser->dpb[i];
+        if ((frame->short_ref | frame->long_ref) && frame->frame_idx == frame_idx)
+            return frame;
+    }
+    return NULL;
+}
+
+static H264Frame *alloc_frame(H264Parser *parser)
+{
+    H264Frame *frame;
+    unsigned int i;
+
+    for (i = 0; i < ARRAY_ELEMS(parser->dpb); i++) {
+        frame = &parser->dpb[i];
+        if (!(frame->short_ref | frame->long_ref))
+            return frame;
+    }
+
+    /* The stream has more reference frames than it declares */
+    D(bug("DPB overflow, dropping a reference frame\n"));
+    frame = &parser->dpb[0];
+    frame->short_ref = frame->long_ref = 0;
+    return frame;
+}
+
+/* Sliding window reference marking, for a frame with FRAME_NUM (8.2.5.3) */
+static void sliding_window(H264Parser *parser, unsigned int frame_num)
+{
+    const unsigned int max_refs = MAX(parser->cur_sps->num_ref_frames, 1);
+    H264Frame *frame, *oldest = NULL;
+    unsigned int i, num_refs = 0;
+    int wrap, oldest_wrap = 0;
+
+    for (i = 0; i < ARRAY_ELEMS(parser->dpb); i++) {
+        frame = &parser->dpb[i];
+        if (!(frame->short_ref | frame->long_ref))
+            continue;
+        num_refs++;
+        if (frame->long_ref)
+            continue;
+        wrap = get_frame_num_wrap(parser, frame->frame_num, frame_num);
+        if (!oldest || wrap < oldest_wrap) {
+            oldest      = frame;
+            oldest_wrap = wrap;
+        }
+    }
+    if (num_refs >= max_refs && oldest)
+        oldest->short_ref = 0;
+}
+
+/* Infers the frames missing from gaps in frame_num (8.2.5.2) */
+static void fill_frame_num_gap(H264Parser *parser, unsigned int frame_num)
 {
+    const unsigned int max_frame_num = 1U << parser->cur_sps->log2_max_frame_num;
+    unsigned int unused_frame_num = (parser->prev_ref_frame_num + 1) % max_frame_num;
+    H264Frame *frame;
+
+    D(bug("gap in frame_num, from %u to %u\n", unused_frame_num, frame_num));
+
+    for (; unused_frame_num != frame_num;
+         unused_frame_num = (unused_frame_num + 1) % max_frame_num) {
+        sliding_window(parser, unused_frame_num);
+        frame = alloc_frame(parser);
+        memset(frame, 0, sizeof(*frame));
+        frame->frame_idx = -1;
+        frame->frame_num = unused_frame_num;
+        frame->short_ref = FRAME;
+
+        if (unused_frame_num < parser->prev_frame_num)
+            parser->prev_frame_num_offset += max_frame_num;
+        parser->prev_frame_num     = unused_frame_num;
+        parser->prev_ref_frame_num = unused_frame_num;
+    }
+}
+
+/* Frees the long-term reference frame with LONG_TERM_FRAME_IDX, unless
+   it is KEEP */
+static void
+unmark_long_term_frame_idx(H264Parser *parser, unsigned int long_term_frame_idx,
+                           const H264Frame *keep)
+{
+    H264Frame *frame;
+    unsigned int i;
+
+    for (i = 0; i < ARRAY_ELEMS(parser->dpb); i++) {
+        frame = &parser->dpb[i];
+        if (frame->long_ref && frame->long_term_frame_idx == long_term_frame_idx &&
+            frame != keep)
+            frame->long_ref = 0;
+    }
+}
+
+/* Marks the current picture and the DPB after decoding (8.2.5) */
+static void mark_reference_picture(H264Parser *parser)
+{
+    const H264SliceHeader * const hdr = &parser->first_slice;
+    const H264MMCO *mmco;
+    H264Frame *cur, *frame;
+    unsigned int i, j, fields, long_term = 0, long_term_frame_idx = 0;
+
+    parser->has_mmco5 = 0;
+    if (!hdr->nal_ref_idc)
+        return;
+
+    /* The first field of the current frame, if it's a reference */
+    cur = parser->is_second_field ? find_frame(parser, parser->cur_frame.frame_idx) : NULL;
+
+    if (hdr->nal_unit_type == NAL_IDR_SLICE) {
+        long_term = hdr->long_term_reference_flag;
+        parser->max_long_term_frame_idx = long_term ? 0 : -1;
+    }
+    else if (hdr->adaptive_ref_pic_marking_mode_flag) {
+        for (i = 0; i < hdr->num_mmcos; i++) {
+            mmco = &hdr->mmcos[i];
+            switch (mmco->op) {
+            case 1:
+                frame = find_ref_pic(parser, get_cur_pic_num(parser) - (int)(mmco->value + 1),
+                                     0, &fields);
+                if (frame)
+                    frame->short_ref &= ~fields;
+                break;
+            case 2:
+                frame = find_ref_pic(parser, mmco->value, 1, &fields);
+                if (frame)
+                    frame->long_ref &= ~fields;
+                break;
+            case 3:
+                frame = find_ref_pic(parser, get_cur_pic_num(parser) - (int)(mmco->value + 1),
+                                     0, &fields);
+                if (!frame)
+                    break;
+                unmark_long_term_frame_idx(parser, mmco->long_term_frame_idx, frame);
+                frame->short_ref &= ~fields;
+                frame->long_ref  |= fields;
+                frame->long_term_frame_idx = mmco->long_term_frame_idx;
+                break;
+            case 4:
+                parser->max_long_term_frame_idx = (int)mmco->value - 1;
+                for (j = 0; j < ARRAY_ELEMS(parser->dpb); j++) {
+                    frame = &parser->dpb[j];
+                    if ((int)frame->long_term_frame_idx > parser->max_long_term_frame_idx)
+                        frame->long_ref = 0;
+                }
+                break;
+            case 5:
+                for (j = 0; j < ARRAY_ELEMS(parser->dpb); j++)
+                    parser->dpb[j].short_ref = parser->dpb[j].long_ref = 0;
+                parser->max_long_term_frame_idx = -1;
+                parser->has_mmco5 = 1;
+                cur = NULL;
+                break;
+            case 6:
+                unmark_long_term_frame_idx(parser, mmco->long_term_frame_idx, cur);
+                long_term = 1;
+                long_term_frame_idx = mmco->long_term_frame_idx;
+                break;
+            }
+        }
+    }
+    else if (!cur || !cur->short_ref)
+        sliding_window(parser, hdr->frame_num);
+
+    /* The current picture may have just freed its first field */
+    if (cur && !(cur->short_ref | cur->long_ref))
+        cur = NULL;
+    if (!cur) {
+        cur = alloc_frame(parser);
+        *cur = parser->cur_frame;
+        cur->short_ref = cur->long_ref = 0;
+    }
+    else {
+        cur->field_order_cnt[0] = parser->cur_frame.field_order_cnt[0];
+        cur->field_order_cnt[1] = parser->cur_frame.field_order_cnt[1];
+    }
+    cur->frame_num_wrap = cur->frame_num;
+
+    if (long_term) {
+        cur->long_ref |= parser->cur_fields;
+        cur->long_term_frame_idx = long_term_frame_idx;
+    }
+    else
+        cur->short_ref |= parser->cur_fields;
+}
+
+static void
+set_reference_picture(H264ReferencePicture *ref, const H264Frame *frame,
+                      unsigned int fields, unsigned int long_term)
+{
+    if (!frame) {
+        memset(ref, 0, sizeof(*ref));
+        ref->frame_idx = -1;
+        return;
+    }
+
+    ref->frame_idx          = frame->frame_idx;
+    ref->frame_num          = long_term ? frame->long_term_frame_idx : frame->frame_num;
+    ref->field_order_cnt[0] = frame->field_order_cnt[0];
+    ref->field_order_cnt[1] = frame->field_order_cnt[1];
+    ref->flags              = fields | (long_term ? H264_PICTURE_LONG_TERM : 0);
+}
+
+/* Sorts FRAMES by ascending KEYS, keeping the DPB order of equal keys */
+static void sort_frames(H264Frame **frames, int64_t *keys, unsigned int count)
+{
+    H264Frame *frame;
+    int64_t key;
+    unsigned int i, j;
+
+    for (i = 1; i < count; i++) {
+        frame = frames[i];
+        key   = keys[i];
+        for (j = i; j > 0 && keys[j - 1] > key; j--) {
+            frames[j] = frames[j - 1];
+            keys[j]   = keys[j - 1];
+        }
+        frames[j] = frame;
+        keys[j]   = key;
+    }
+}
+
+/* Appends reference FRAMES to LIST as frames, or alternating fields
+   starting with the parity of the current field (8.2.4.2.5) */
+static unsigned int
+append_ref_entries(H264Parser *parser, H264RefEntry *list, unsigned int n,
+                   H264Frame **frames, unsigned int count, unsigned int long_term)
+{
+    const unsigned int parity[2] = { parser->cur_fields, parser->cur_fields ^ FRAME };
+    unsigned int i, k, next[2] = { 0, 0 };
+
+#define FIELDS(frame) (long_term ? (frame)->long_ref : (frame)->short_ref)
+    if (parser->cur_fields == FRAME) {
+        for (i = 0; i < count; i++, n++) {
+            list[n].frame     = frames[i];
+            list[n].fields    = FRAME;
+            list[n].long_term = long_term;
+        }
+        return n;
+    }
+
+    for (k = 0;;) {
+        for (i = next[k]; i < count && !(FIELDS(frames[i]) & parity[k]); i++)
+            ;
+        if (i >= count) {
+            k ^= 1;
+            for (i = next[k]; i < count && !(FIELDS(frames[i]) & parity[k]); i++)
+                ;
+            if (i >= count)
+                break;
+        }
+        list[n].frame     = frames[i];
+        list[n].fields    = parity[k];
+        list[n].long_term = long_term;
+        n++;
+        next[k] = i + 1;
+        k ^= 1;
+    }
+#undef FIELDS
+    return n;
+}
+
+/* Collects the reference frames usable by the current picture */
+static unsigned int
+collect_ref_frames(H264Parser *parser, H264Frame **frames, unsigned int long_term)
+{
+    H264Frame *frame;
+    unsigned int i, fields, count = 0;
+
+    for (i = 0; i < ARRAY_ELEMS(parser->dpb); i++) {
+        frame  = &parser->dpb[i];
+        fields = long_term ? frame->long_ref : frame->short_ref;
+        if (parser->cur_fields == FRAME ? fields == FRAME : fields != 0)
+            frames[count++] = frame;
+    }
+    return count;
+}
+
+/* Initializes the reference picture lists (8.2.4.2) */
+static void
+init_ref_lists(H264Parser *parser, unsigned int slice_type,
+               H264RefEntry lists[2][MAX_REF_LIST_SIZE], unsigned int count[2])
+{
+    H264Frame *short_frames[2][MAX_DPB_SIZE + 1], *long_frames[MAX_DPB_SIZE + 1];
+    int64_t short_keys[2][MAX_DPB_SIZE + 1], long_keys[MAX_DPB_SIZE + 1];
+    unsigned int i, list, num_lists, num_short, num_long;
+    H264RefEntry tmp;
+    int64_t poc;
+
+    count[0] = count[1] = 0;
+    if (slice_type == SLICE_TYPE_P || slice_type == SLICE_TYPE_SP)
+        num_lists = 1;
+    else if (slice_type == SLICE_TYPE_B)
+        num_lists = 2;
+    else
+        return;
+
+    /* Short-term references by descending PicNum or FrameNumWrap for P,
+       or by POC distance, preceding ones first in list 0 for B */
+    num_short = collect_ref_frames(parser, short_frames[0], 0);
+    for (i = 0; i < num_short; i++) {
+        short_frames[1][i] = short_frames[0][i];
+        if (num_lists == 1) {
+            short_keys[0][i] = -short_frames[0][i]->frame_num_wrap;
+            continue;
+        }
+        poc = get_frame_poc(short_frames[0][i], short_frames[0][i]->short_ref) - parser->cur_poc;
+        short_keys[0][i] = poc <= 0 ? -poc : (INT64_C(1) << 33) + poc;
+        short_keys[1][i] = poc >  0 ?  poc : (INT64_C(1) << 33) - poc;
+    }
+
+    /* Long-term references by ascending LongTermPicNum or LongTermFrameIdx */
+    num_long = collect_ref_frames(parser, long_frames, 1);
+    for (i = 0; i < num_long; i++)
+        long_keys[i] = long_frames[i]->long_term_frame_idx;
+    sort_frames(long_frames, long_keys, num_long);
+
+    for (list = 0; list < num_lists; list++) {
+        sort_frames(short_frames[list], short_keys[list], num_short);
+        count[list] = append_ref_entries(parser, lists[list], 0,
+                                         short_frames[list], num_short, 0);
+        count[list] = append_ref_entries(parser, lists[list], count[list],
+                                         long_frames, num_long, 1);
+    }
+
+    /* List 1 starts with another picture than list 0, if it can */
+    if (num_lists == 2 && count[1] > 1 && count[0] == count[1]) {
+        for (i = 0; i < count[1]; i++) {
+            if (lists[0][i].frame  != lists[1][i].frame ||
+                lists[0][i].fields != lists[1][i].fields)
+                break;
+        }
+        if (i == count[1]) {
+            tmp         = lists[1][0];
+            lists[1][0] = lists[1][1];
+            lists[1][1] = tmp;
+        }
+    }
+}
+
+/* Applies the reference picture list modifications (8.2.4.3) */
+static void
+modify_ref_list(H264Parser *parser, const H264SliceHeader *hdr,
+                unsigned int list, H264RefEntry *ref_list)
+{
+    const unsigned int max_frame_num = 1U << parser->cur_sps->log2_max_frame_num;
+    const int max_pic_num = parser->cur_fields == FRAME ? max_frame_num : 2 * max_frame_num;
+    const int cur_pic_num = get_cur_pic_num(parser);
+    const unsigned int num_refs = hdr->num_ref_idx_active[list];
+    unsigned int i, c, n, value, ref_idx = 0;
+    int pic_num, pic_num_pred = cur_pic_num;
+    H264RefEntry entry;
+
+    for (i = 0; i < hdr->num_modifications[list] && ref_idx < num_refs; i++) {
+        value = hdr->modification_value[list][i];
+        entry.fields = 0;
+        if (hdr->modification_of_pic_nums_idc[list][i] < 2) {
+            if (value >= (unsigned int)max_pic_num)
+                continue;
+            if (hdr->modification_of_pic_nums_idc[list][i] == 0) {
+                pic_num_pred -= value + 1;
+                if (pic_num_pred < 0)
+                    pic_num_pred += max_pic_num;
+            }
+            else {
+                pic_num_pred += value + 1;
+                if (pic_num_pred >= max_pic_num)
+                    pic_num_pred -= max_pic_num;
+            }
+            pic_num = pic_num_pred > cur_pic_num ? pic_num_pred - max_pic_num : pic_num_pred;
+            entry.frame     = find_ref_pic(parser, pic_num, 0, &entry.fields);
+            entry.long_term = 0;
+        }
+        else {
+            entry.frame     = find_ref_pic(parser, value, 1, &entry.fields);
+            entry.long_term = 1;
+        }
+        if (!entry.frame)
+            D(bug("missing reference picture for list %u\n", list));
+
+        /* Insert the entry and remove its later duplicate */
+        for (c = num_refs; c > ref_idx; c--)
+            ref_list[c] = ref_list[c - 1];
+        ref_list[ref_idx++] = entry;
+        for (c = n = ref_idx; c <= num_refs; c++) {
+            if (ref_list[c].frame     != entry.frame ||
+                ref_list[c].fields    != entry.fields ||
+                ref_list[c].long_term != entry.long_term)
+                ref_list[n++] = ref_list[c];
+        }
+    }
+}
+
+static void
+build_ref_lists(H264Parser *parser, const H264SliceHeader *hdr, H264SliceInfo *slice)
+{
+    H264RefEntry lists[2][MAX_REF_LIST_SIZE];
+    H264ReferencePicture *ref_list;
+    unsigned int i, list, count[2];
+
+    init_ref_lists(parser, slice->slice_type, lists, count);
+
+    for (list = 0; list < 2; list++) {
+        for (i = count[list]; i <= hdr->num_ref_idx_active[list]; i++) {
+            lists[list][i].frame     = NULL;
+            lists[list][i].fields    = 0;
+            lists[list][i].long_term = 0;
+        }
+        modify_ref_list(parser, hdr, list, lists[list]);
+
+        ref_list = list ? slice->RefPicList1 : slice->RefPicList0;
+        for (i = 0; i < 32; i++) {
+            if (i < hdr->num_ref_idx_active[list])
+                set_reference_picture(&ref_list[i], lists[list][i].frame,
+                                      lists[list][i].fields, lists[list][i].long_term);
+            else
+                set_reference_picture(&ref_list[i], NULL, 0, 0);
+        }
+    }
+}
+
+static void fill_picture_info(H264Parser *parser, H264Picture *picture)
+{
+    const H264SliceHeader * const hdr = &parser->first_slice;
+    const H264SPS * const sps = parser->cur_sps;
+    const H264PPS * const pps = parser->cur_pps;
+    H264PictureInfo * const pic_info = &picture->pic_info;
+
+    pic_info->profile_idc                  = sps->profile_idc;
+    pic_info->level_idc                    = sps->level_idc;
+    pic_info->width                        = sps->width;
+    pic_info->height                       = sps->height;
+    pic_info->picture_width_in_mbs_minus1  = sps->pic_width_in_mbs - 1;
+    pic_info->picture_height_in_mbs_minus1 =
+        (sps->pic_height_in_map_units << !sps->frame_mbs_only_flag) - 1;
+    pic_info->bit_depth_luma_minus8        = sps->bit_depth_luma_minus8;
+    pic_info->bit_depth_chroma_minus8      = sps->bit_depth_chroma_minus8;
+    pic_info->num_ref_frames               = sps->num_ref_frames;
+
+#define SEQ_FIELD(field, value) pic_info->seq_fields.bits.field = (value)
+    SEQ_FIELD(chroma_format_idc,                    sps->chroma_format_idc);
+    SEQ_FIELD(residual_colour_transform_flag,       sps->separate_colour_plane_flag);
+    SEQ_FIELD(gaps_in_frame_num_value_allowed_flag, sps->gaps_in_frame_num_value_allowed_flag);
+    SEQ_FIELD(frame_mbs_only_flag,                  sps->frame_mbs_only_flag);
+    SEQ_FIELD(mb_adaptive_frame_field_flag,         sps->mb_adaptive_frame_field_flag);
+    SEQ_FIELD(direct_8x8_inference_flag,            sps->direct_8x8_inference_flag);
+    SEQ_FIELD(MinLumaBiPredSize8x8,                 sps->level_idc >= 31);
+    SEQ_FIELD(log2_max_frame_num_minus4,            sps->log2_max_frame_num - 4);
+    SEQ_FIELD(pic_order_cnt_type,                   sps->pic_order_cnt_type);
+    if (sps->pic_order_cnt_type == 0)
+        SEQ_FIELD(log2_max_pic_order_cnt_lsb_minus4, sps->log2_max_pic_order_cnt_lsb - 4);
+    SEQ_FIELD(delta_pic_order_always_zero_flag,     sps->delta_pic_order_always_zero_flag);
+#undef SEQ_FIELD
+
+    pic_info->num_slice_groups_minus1        = pps->num_slice_groups_minus1;
+    pic_info->slice_group_map_type           = pps->slice_group_map_type;
+    pic_info->slice_group_change_rate_minus1 = pps->slice_group_change_rate_minus1;
+    pic_info->pic_init_qp_minus26            = pps->pic_init_qp_minus26;
+    pic_info->pic_init_qs_minus26            = pps->pic_init_qs_minus26;
+    pic_info->chroma_qp_index_offset         = pps->chroma_qp_index_offset;
+    pic_info->second_chroma_qp_index_offset  = pps->second_chroma_qp_index_offset;
+
+#define PIC_FIELD(field, value) pic_info->pic_fields.bits.field = (value)
+    PIC_FIELD(entropy_coding_mode_flag,               pps->entropy_coding_mode_flag);
+    PIC_FIELD(weighted_pred_flag,                     pps->weighted_pred_flag);
+    PIC_FIELD(weighted_bipred_idc,                    pps->weighted_bipred_idc);
+    PIC_FIELD(transform_8x8_mode_flag,                pps->transform_8x8_mode_flag);
+    PIC_FIELD(field_pic_flag,                         hdr->field_pic_flag);
+    PIC_FIELD(bottom_field_flag,                      hdr->bottom_field_flag);
+    PIC_FIELD(constrained_intra_pred_flag,            pps->constrained_intra_pred_flag);
+    PIC_FIELD(pic_order_present_flag,                 pps->pic_order_present_flag);
+    PIC_FIELD(deblocking_filter_control_present_flag, pps->deblocking_filter_control_present_flag);
+    PIC_FIELD(redundant_pic_cnt_present_flag,         pps->redundant_pic_cnt_present_flag);
+    PIC_FIELD(reference_pic_flag,                     hdr->nal_ref_idc != 0);
+#undef PIC_FIELD
+
+    memcpy(picture->iq_matrix.ScalingList4x4, pps->scaling_lists_4x4,
+           sizeof(picture->iq_matrix.ScalingList4x4));
+    memcpy(picture->iq_matrix.ScalingList8x8, pps->scaling_lists_8x8,
+           sizeof(picture->iq_matrix.ScalingList8x8));
+}
+
+/* Sets up the current picture from its first slice */
+static void
+begin_picture(H264Parser *parser, H264Picture *picture, const H264SliceHeader *hdr)
+{
+    H264Frame * const cur = &parser->cur_frame;
+    H264Frame *frame;
+    unsigned int i, n;
+    int poc[2];
+
+    parser->first_slice = *hdr;
+    parser->cur_pps     = parser->pps[hdr->pic_parameter_set_id];
+    parser->cur_sps     = parser->sps[parser->cur_pps->seq_parameter_set_id];
+    parser->cur_fields  = (!hdr->field_pic_flag ? FRAME :
+                           hdr->bottom_field_flag ? BOTTOM_FIELD : TOP_FIELD);
+
+    /* The second field of a frame shares its decoding order number */
+    parser->is_second_field = (parser->first_field &&
+                               hdr->field_pic_flag &&
+                               parser->cur_fields != parser->first_field &&
+                               hdr->frame_num == cur->frame_num);
+    if (!parser->is_second_field) {
+        if (hdr->nal_unit_type == NAL_IDR_SLICE) {
+            for (i = 0; i < ARRAY_ELEMS(parser->dpb); i++)
+                parser->dpb[i].short_ref = parser->dpb[i].long_ref = 0;
+            parser->prev_ref_frame_num = 0;
+        }
+        else if (hdr->frame_num != parser->prev_ref_frame_num &&
+                 hdr->frame_num != ((parser->prev_ref_frame_num + 1) %
+                                    (1U << parser->cur_sps->log2_max_frame_num)) &&
+                 parser->cur_sps->gaps_in_frame_num_value_allowed_flag)
+            fill_frame_num_gap(parser, hdr->frame_num);
+
+        memset(cur, 0, sizeof(*cur));
+        cur->frame_idx = parser->num_frames++;
+        cur->frame_num = hdr->frame_num;
+    }
+
+    compute_poc(parser, hdr, poc);
+    if (parser->cur_fields & TOP_FIELD)
+        cur->field_order_cnt[0] = poc[0];
+    if (parser->cur_fields & BOTTOM_FIELD)
+        cur->field_order_cnt[1] = poc[1];
+    parser->cur_poc = get_frame_poc(cur, parser->cur_fields);
+
+    /* Picture numbers are relative to the current frame_num */
+    for (i = 0; i < ARRAY_ELEMS(parser->dpb); i++) {
+        frame = &parser->dpb[i];
+        frame->frame_num_wrap = get_frame_num_wrap(parser, frame->frame_num, hdr->frame_num);
+    }
+
+    fill_picture_info(parser, picture);
+    picture->frame_idx          = cur->frame_idx;
+    picture->frame_num          = hdr->frame_num;
+    picture->field_order_cnt[0] = cur->field_order_cnt[0];
+    picture->field_order_cnt[1] = cur->field_order_cnt[1];
+
+    for (i = 0, n = 0; i < ARRAY_ELEMS(parser->dpb) && n < 16; i++) {
+        frame = &parser->dpb[i];
+        if (!(frame->short_ref | frame->long_ref) || frame->frame_idx < 0)
+            continue;
+        set_reference_picture(&picture->ReferenceFrames[n++], frame,
+                              frame->short_ref | frame->long_ref, frame->long_ref != 0);
+    }
+    picture->num_reference_frames = n;
+}
+
+static int
+add_slice(H264Parser *parser, H264Picture *picture, const H264SliceHeader *hdr,
+          size_t offset, unsigned int size)
+{
+    H264SliceInfo *slice;
+
+    parser->slices = fast_realloc(parser->slices, &parser->slices_size,
+                                  (picture->slice_count + 1) * sizeof(*slice));
+    if (!parser->slices)
+        return -1;
+
+    slice = &parser->slices[picture->slice_count++];
+    *slice = hdr->info;
+    slice->slice_data_offset = offset;
+    slice->slice_data_size   = size;
+    build_ref_lists(parser, hdr, slice);
+    return 0;
+}
+
+/* Marks references and updates the POC state after the picture */
+static void end_picture(H264Parser *parser, H264Picture *picture)
+{
+    const H264SliceHeader * const hdr = &parser->first_slice;
+    H264Frame * const cur = &parser->cur_frame;
+    H264Frame *frame;
+    int poc;
+
+    mark_reference_picture(parser);
+
+    if (parser->has_mmco5) {
+        /* The picture is now frame_num 0, with POCs relative to itself */
+        poc   = get_frame_poc(cur, parser->cur_fields);
+        frame = find_frame(parser, cur->frame_idx);
+        if (frame) {
+            frame->frame_num = 0;
+            frame->field_order_cnt[0] -= poc;
+            frame->field_order_cnt[1] -= poc;
+        }
+        cur->frame_num = 0;
+        cur->field_order_cnt[0] -= poc;
+        cur->field_order_cnt[1] -= poc;
+        parser->prev_poc_msb          = 0;
+        parser->prev_poc_lsb          = (parser->cur_fields == BOTTOM_FIELD ? 0 :
+                                         cur->field_order_cnt[0]);
+        parser->prev_frame_num_offset = 0;
+        parser->prev_frame_num        = 0;
+        parser->prev_ref_frame_num    = 0;
+    }
+    else {
+        if (hdr->nal_ref_idc) {
+            parser->prev_poc_msb       = parser->poc_msb;
+            parser->prev_poc_lsb       = hdr->pic_order_cnt_lsb;
+            parser->prev_ref_frame_num = hdr->frame_num;
+        }
+        parser->prev_frame_num_offset = parser->frame_num_offset;
+        parser->prev_frame_num        = hdr->frame_num;
+    }
+
+    /* A first field pairs with the next picture, if it's the other field */
+    parser->first_field = (hdr->field_pic_flag && !parser->is_second_field ?
+                           parser->cur_fields : 0);
+
+    picture->slices = parser->slices;
+}
+
+/* Locates the NAL unit at the current position, without consuming it.
+   Returns 1 if there is one, 0 at the end of the stream, or -1 on error */
+static int
+peek_nal_unit(H264Parser *parser, size_t *poffset, unsigned int *psize)
+{
+    const uint8_t * const buf = parser->buf;
+    size_t pos, end;
+    unsigned int i, size;
+    MP4Sample sample;
+
+    if (!parser->mp4) {
+        for (;; parser->pos = parser->next_pos) {
+            pos = startcode_find(buf, parser->pos, parser->size);
+            if (pos + 3 >= parser->size)
+                return 0;
+            end = startcode_find(buf, pos + 3, parser->size);
+            parser->pos      = pos;
+            parser->next_pos = end;
+
+            /* Skip trailing_zero_8bits */
+            for (pos += 3; end > pos && buf[end - 1] == 0; end--)
+                ;
+            if (end > pos)
+                break;
+        }
+        *poffset = pos;
+        *psize   = end - pos;
+        return 1;
+    }
+
+    for (;; parser->pos = parser->next_pos) {
+        while (parser->pos >= parser->sample_end) {
+            if (parser->sample >= mp4_get_track_info(parser->mp4)->num_samples)
+                return 0;
+            if (mp4_get_sample(parser->mp4, parser->sample++, &sample) < 0)
+                return -1;
+            parser->pos        = sample.data - buf;
+            parser->sample_end = parser->pos + sample.size;
+        }
+
+        pos = parser->pos;
+        if (parser->sample_end - pos < parser->nal_length_size)
+            return -1;
+        for (size = 0, i = 0; i < parser->nal_length_size; i++)
+            size = (size << 8) | buf[pos++];
+        if (size > parser->sample_end - pos)
+            return -1;
+        parser->next_pos = pos + size;
+        if (size > 0)
+            break;
+    }
+    *poffset = pos;
+    *psize   = size;
+    return 1;
+}
+
+/* Parses the SPS and PPS of the avcC record of an MP4 file */
+static int parse_avcc(H264Parser *parser)
+{
+    const MP4TrackInfo * const track = mp4_get_track_info(parser->mp4);
+    const uint8_t *ptr, *end;
+    unsigned int i, n, type, size;
+
+    if (track->codec != MP4_FOURCC('a','v','c','1') || track->config_size < 6)
+        return -1;
+
+    ptr = track->config;
+    end = track->config + track->config_size;
+    parser->nal_length_size = (ptr[4] & 3) + 1;
+    n = ptr[5] & 0x1f;                  // number of SPS entries
+    ptr += 6;
+
+    for (type = NAL_SPS; type <= NAL_PPS; type++) {
+        if (type == NAL_PPS) {
+            if (ptr >= end)
+                return -1;
+            n = *ptr++;                 // number of PPS entries
+        }
+        for (i = 0; i < n; i++) {
+            if (end - ptr < 2)
+                return -1;
+            size = (ptr[0] << 8) | ptr[1];
+            ptr += 2;
+            if (size == 0 || size > (unsigned int)(end - ptr))
+                return -1;
+            if (parse_parameter_set(parser, ptr, size) < 0)
+                return -1;
+            ptr += size;
+        }
+    }
+    return 0;
+}
+
+H264Parser *h264_parser_new(const uint8_t *buf, size_t size)
+{
+    H264Parser *parser;
+
+    parser = calloc(1, sizeof(*parser));
+    if (!parser)
+        return NULL;
+
+    parser->buf  = buf;
+    parser->size = size;
+    parser->max_long_term_frame_idx = -1;
+
+    /* MP4 files keep parameter sets in the track configuration */
+    if (size >= 8 && memcmp(buf + 4, "ftyp", 4) == 0) {
+        parser->mp4 = mp4_open_memory(buf, size);
+        if (!parser->mp4 || parse_avcc(parser) < 0) {
+            D(bug("no H.264 track in MP4 file\n"));
+            h264_parser_destroy(parser);
+            return NULL;
+        }
+    }
+    return parser;
+}
+
+void h264_parser_destroy(H264Parser *parser)
+{
+    unsigned int i;
+
+    if (!parser)
+        return;
+
+    for (i = 0; i < MAX_SPS_COUNT; i++)
+        free(parser->sps[i]);
+    for (i = 0; i < MAX_PPS_COUNT; i++)
+        free(parser->pps[i]);
+    mp4_close(parser->mp4);
+    free(parser->rbsp);
+    free(parser->slices);
+    free(parser);
+}
+
+int h264_parser_get_picture(H264Parser *parser, H264Picture *picture)
+{
+    H264SliceHeader hdr;
+    size_t offset;
+    unsigned int size, nal_unit_type;
+    int ret, in_picture = 0;
+
+    input_release(parser->buf + parser->pos);
+
+    memset(picture, 0, sizeof(*picture));
+
+    while ((ret = peek_nal_unit(parser, &offset, &size)) > 0) {
+        nal_unit_type = parser->buf[offset] & 0x1f;
+
+        switch (nal_unit_type) {
+        case NAL_SLICE:
+        case NAL_IDR_SLICE:
+            if (parse_slice_header(parser, &hdr, parser->buf + offset, size) < 0)
+                return -1;
+            if (hdr.redundant_pic_cnt > 0)
+                break;
+            if (in_picture && is_new_picture(&parser->first_slice, &hdr))
+                goto end;
+            if (!in_picture) {
+                begin_picture(parser, picture, &hdr);
+                in_picture = 1;
+            }
+            if (add_slice(parser, picture, &hdr, offset, size) < 0)
+                return -1;
+            break;
+        case NAL_SEI:
+        case NAL_SPS:
+        case NAL_PPS:
+        case NAL_AU_DELIMITER:
+        case NAL_END_OF_SEQUENCE:
+        case NAL_END_OF_STREAM:
+            /* These end the access unit of the current picture */
+            if (in_picture)
+                goto end;
+            if (parse_parameter_set(parser, parser->buf + offset, size) < 0)
+                return -1;
+            break;
+        default:
+            if (in_picture && nal_unit_type >= NAL_PREFIX && nal_unit_type <= NAL_RESERVED_18)
+                goto end;
+            break;
+        }
+        parser->pos = parser->next_pos;
+    }
+    if (ret < 0)
+        return -1;
+
+end:
+    if (!in_picture)
+        return 0;
+
+    end_picture(parser, picture);
+    return 1;
+}
+
+/* Parses the first picture of the video data, only once */
+static const H264Picture *get_picture(void)
+{
+    static H264Parser *parser;
+    static H264Picture picture;
+    const uint8_t *data;
+    size_t size;
+
+    if (!parser) {
+        h264_get_video_data(&data, &size);
+        parser = h264_parser_new(data, size);
+        if (!parser || h264_parser_get_picture(parser, &picture) != 1) {
+            D(bug("failed to parse the first H.264 picture\n"));
+            memset(&picture, 0, sizeof(picture));
+        }
+    }
+    return &picture;
+}
+
+void h264_get_video_data(const uint8_t **data, size_t *size)
+{
+    if (input_get_data(data, size))
+        return;
     *data = h264_clip;
     *size = sizeof(h264_clip);
 }
 
 void h264_get_picture_info(H264PictureInfo *pic_info)
 {
-    memcpy(pic_info, &h264_pic_info, sizeof(*pic_info));
+    memcpy(pic_info, &get_picture()->pic_info, sizeof(*pic_info));
 }
 
 void h264_get_iq_matrix(H264IQMatrix *iq_matrix)
 {
-    memcpy(iq_matrix, &h264_iq_matrix, sizeof(*iq_matrix));
+    memcpy(iq_matrix, &get_picture()->iq_matrix, sizeof(*iq_matrix));
 }
 
 void h264_get_slice_info(H264SliceInfo *slice_info)
 {
-    memcpy(slice_info, &h264_slice_info, sizeof(*slice_info));
+    const H264Picture * const picture = get_picture();
+
+    if (picture->slice_count > 0)
+        memcpy(slice_info, &picture->slices[0], sizeof(*slice_info));
+    else
+        memset(slice_info, 0, sizeof(*slice_info));
 }
 
 void h264_get_slice_data(const uint8_t **data, unsigned int *size)
 {
-    *data = &h264_clip[H264_CLIP_SLICE_OFFSET];
-    *size = H264_CLIP_SLICE_SIZE;
+    const H264Picture * const picture = get_picture();
+    size_t video_data_size;
+
+    h264_get_video_data(data, &video_data_size);
+    *size = 0;
+    if (picture->slice_count > 0) {
+        *data += picture->slices[0].slice_data_offset;
+        *size  = picture->slices[0].slice_data_size;
+    }
 }
@@ -24,6 +24,14 @@
 typedef struct _H264PictureInfo H264PictureInfo;
 typedef struct _H264IQMatrix    H264IQMatrix;
 typedef struct _H264SliceInfo   H264SliceInfo;
+typedef struct _H264ReferencePicture H264ReferencePicture;
+typedef struct _H264Picture     H264Picture;
+typedef struct _H264Parser      H264Parser;
+
+// H264ReferencePicture flags
+#define H264_PICTURE_TOP_FIELD          0x01
+#define H264_PICTURE_BOTTOM_FIELD       0x02
+#define H264_PICTURE_LONG_TERM          0x04
 
 struct _H264PictureInfo {
     unsigned char       profile_idc;
@@ -76,12 +84,25 @@ struct _H264PictureInfo {
     } pic_fields;
 };
 
+// A reference frame, or a reference field if only one of the field flags
+// is set. Frames are identified by their decoding order number, which is
+// -1 for frames inferred from gaps in frame_num, or for missing entries
+struct _H264ReferencePicture {
+    int                 frame_idx;
+    unsigned int        frame_num;      // or LongTermFrameIdx
+    int                 field_order_cnt[2];
+    unsigned int        flags;
+};
+
+// Scaling lists are in zig-zag scan order, as in the bitstream
 struct _H264IQMatrix {
     unsigned char       ScalingList4x4[6][16];
     unsigned char       ScalingList8x8[2][64];
 };
 
 struct _H264SliceInfo {
+    unsigned int        slice_data_size;
+    size_t              slice_data_offset;
     unsigned short      macroblock_offset;
     unsigned short      first_mb_in_slice;
     unsigned char       slice_type;
@@ -107,9 +128,38 @@ struct _H264SliceInfo {
     unsigned char       chroma_weight_l1_flag;
     short               chroma_weight_l1[32][2];
     short               chroma_offset_l1[32][2];
+    H264ReferencePicture RefPicList0[32];
+    H264ReferencePicture RefPicList1[32];
+};
+
+// A picture, or a field, with slices in decoding order. Slice data
+// starts at the NAL unit header and macroblock_offset counts its bits,
+// including emulation prevention bytes
+struct _H264Picture {
+    H264PictureInfo     pic_info;
+    H264IQMatrix        iq_matrix;
+    H264SliceInfo      *slices;         // offsets are relative to the stream
+    unsigned int        slice_count;
+    unsigned int        frame_idx;      // decoding order of the frame
+    unsigned int        frame_num;
+    int                 field_order_cnt[2];
+    H264ReferencePicture ReferenceFrames[16];
+    unsigned int        num_reference_frames;
 };
 
-void h264_get_video_data(const uint8_t **data, unsigned int *size);
+// Creates a parser over the SIZE bytes of an Annex-B stream or an MP4
+// file in BUF, which must outlive the parser
+H264Parser *h264_parser_new(const uint8_t *buf, size_t size);
+void h264_parser_destroy(H264Parser *parser);
+
+// Parses the next picture. Returns 1 if PICTURE was filled in, 0 at the
+// end of the stream, or -1 on error. PICTURE->slices remains valid until
+// the next call
+int h264_parser_get_picture(H264Parser *parser, H264Picture *picture);
+
+void h264_get_video_data(const uint8_t **data, size_t *size);
+
+// Accessors to the first picture of the video data
 void h264_get_picture_info(H264PictureInfo *pic_info);
 void h264_get_iq_matrix(H264IQMatrix *iq_matrix);
 void h264_get_slice_info(H264SliceInfo *slice_info);
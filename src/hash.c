@@ -0,0 +1,342 @@
+/*
+ *  hash.c - Checksums for decoded frames verification
+ *
+ *  hwdecode-demos (C) 2009-2010 Splitted-Desktop Systems
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "sysdeps.h"
+#include "hash.h"
+#include "cpu.h"
+
+#define DEBUG 1
+#include "debug.h"
+
+#if USE_SIMD_X86
+#include <immintrin.h>
+#define TARGET(isa) __attribute__((__target__(isa)))
+#endif
+
+#if defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+#endif
+
+static inline uint32_t load_le32(const uint8_t *p)
+{
+    return ((uint32_t)p[0]       | ((uint32_t)p[1] << 8) |
+            ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24));
+}
+
+static inline uint64_t load_le64(const uint8_t *p)
+{
+    return (uint64_t)load_le32(p) | ((uint64_t)load_le32(p + 4) << 32);
+}
+
+static inline uint64_t rotl64(uint64_t x, unsigned int r)
+{
+    return (x << r) | (x >> (64 - r));
+}
+
+/* ------------------------------------------------------------------------ */
+/* --- CRC-32C                                                          --- */
+/* ------------------------------------------------------------------------ */
+
+/* Reflected Castagnoli polynomial */
+#define CRC32C_POLY 0x82f63b78
+
+typedef uint32_t (*crc32c_func)(uint32_t crc, const uint8_t *data,
+                                unsigned int size);
+
+static uint32_t crc32c_table[8][256];
+
+static void crc32c_init_table(void)
+{
+    unsigned int i, j;
+    uint32_t crc;
+
+    for (i = 0; i < 256; i++) {
+        crc = i;
+        for (j = 0; j < 8; j++)
+            crc = (crc >> 1) ^ (CRC32C_POLY & -(crc & 1));
+        crc32c_table[0][i] = crc;
+    }
+
+    /* Tables for slicing-by-8, i.e. CRC of I followed by N zero bytes */
+    for (i = 0; i < 256; i++) {
+        crc = crc32c_table[0][i];
+        for (j = 1; j < 8; j++) {
+            crc = (crc >> 8) ^ crc32c_table[0][crc & 0xff];
+            crc32c_table[j][i] = crc;
+        }
+    }
+}
+
+static uint32_t crc32c_c(uint32_t crc, const uint8_t *data, unsigned int size)
+{
+    const uint32_t (* const t)[256] = crc32c_table;
+
+    for (; size >= 8; size -= 8, data += 8) {
+        crc ^= load_le32(data);
+        crc = (t[7][crc & 0xff]         ^ t[6][(crc >> 8) & 0xff] ^
+               t[5][(crc >> 16) & 0xff] ^ t[4][crc >> 24]         ^
+               t[3][data[4]] ^ t[2][data[5]] ^ t[1][data[6]] ^ t[0][data[7]]);
+    }
+    for (; size > 0; size--)
+        crc = (crc >> 8) ^ t[0][(crc ^ *data++) & 0xff];
+    return crc;
+}
+
+#if USE_SIMD_X86
+TARGET("sse4.2")
+static uint32_t crc32c_sse4_2(uint32_t crc, const uint8_t *data, unsigned int size)
+{
+    for (; size > 0 && ((uintptr_t)data & 7); size--)
+        crc = _mm_crc32_u8(crc, *data++);
+#ifdef __x86_64__
+    {
+        uint64_t crc64 = crc;
+        uint64_t v;
+        for (; size >= 8; size -= 8, data += 8) {
+            memcpy(&v, data, sizeof(v));
+            crc64 = _mm_crc32_u64(crc64, v);
+        }
+        crc = crc64;
+    }
+#else
+    for (; size >= 4; size -= 4, data += 4)
+        crc = _mm_crc32_u32(crc, load_le32(data));
+#endif
+    for (; size > 0; size--)
+        crc = _mm_crc32_u8(crc, *data++);
+    return crc;
+}
+#endif
+
+#if defined(__ARM_FEATURE_CRC32)
+static uint32_t crc32c_armv8(uint32_t crc, const uint8_t *data, unsigned int size)
+{
+    uint64_t v;
+
+    for (; size > 0 && ((uintptr_t)data & 7); size--)
+        crc = __crc32cb(crc, *data++);
+    for (; size >= 8; size -= 8, data += 8) {
+        memcpy(&v, data, sizeof(v));
+        crc = __crc32cd(crc, v);
+    }
+    for (; size > 0; size--)
+        crc = __crc32cb(crc, *data++);
+    return crc;
+}
+#endif
+
+static crc32c_func crc32c_update = crc32c_c;
+
+/* Select the best CRC-32C kernel for the host CPU, again if its features
+   were masked since */
+static void hash_init_kernels(void)
+{
+    static int initialized = 0;
+    static unsigned int selected_features;
+    const unsigned int features = cpu_get_features();
+    const char *crc32c_isa = "c";
+
+    if (initialized && features == selected_features)
+        return;
+    if (!initialized)
+        crc32c_init_table();
+    initialized = 1;
+    selected_features = features;
+
+    crc32c_update = crc32c_c;
+#if USE_SIMD_X86
+    if (features & CPU_FEATURE_SSE4_2) {
+        crc32c_update = crc32c_sse4_2;
+        crc32c_isa    = "sse4.2";
+    }
+#endif
+#if defined(__ARM_FEATURE_CRC32)
+    crc32c_update = crc32c_armv8;
+    crc32c_isa    = "armv8";
+#endif
+    D(bug("using %s kernel for CRC-32C\n", crc32c_isa));
+}
+
+/* ------------------------------------------------------------------------ */
+/* --- xxHash64                                                         --- */
+/* ------------------------------------------------------------------------ */
+
+#define XXH_PRIME64_1 0x9e3779b185ebca87ULL
+#define XXH_PRIME64_2 0xc2b2ae3d27d4eb4fULL
+#define XXH_PRIME64_3 0x165667b19e3779f9ULL
+#define XXH_PRIME64_4 0x85ebca77c2b2ae63ULL
+#define XXH_PRIME64_5 0x27d4eb2f165667c5ULL
+
+static inline uint64_t xxh64_round(uint64_t acc, uint64_t input)
+{
+    acc += input * XXH_PRIME64_2;
+    acc  = rotl64(acc, 31);
+    return acc * XXH_PRIME64_1;
+}
+
+static inline uint64_t xxh64_merge_round(uint64_t acc, uint64_t val)
+{
+    acc ^= xxh64_round(0, val);
+    return acc * XXH_PRIME64_1 + XXH_PRIME64_4;
+}
+
+/* Consumes 32-byte stripes, returns the number of bytes processed */
+static unsigned int
+xxh64_stripes(uint64_t v[4], const uint8_t *data, unsigned int size)
+{
+    uint64_t v1 = v[0], v2 = v[1], v3 = v[2], v4 = v[3];
+    unsigned int n;
+
+    for (n = 0; n + 32 <= size; n += 32, data += 32) {
+        v1 = xxh64_round(v1, load_le64(data +  0));
+        v2 = xxh64_round(v2, load_le64(data +  8));
+        v3 = xxh64_round(v3, load_le64(data + 16));
+        v4 = xxh64_round(v4, load_le64(data + 24));
+    }
+    v[0] = v1; v[1] = v2; v[2] = v3; v[3] = v4;
+    return n;
+}
+
+static void xxh64_update(HashContext *ctx, const uint8_t *data, unsigned int size)
+{
+    unsigned int n;
+
+    ctx->length += size;
+
+    if (ctx->buffer_len > 0) {
+        n = MIN(size, sizeof(ctx->buffer) - ctx->buffer_len);
+        memcpy(ctx->buffer + ctx->buffer_len, data, n);
+        ctx->buffer_len += n;
+        data += n;
+        size -= n;
+        if (ctx->buffer_len < sizeof(ctx->buffer))
+            return;
+        xxh64_stripes(ctx->state, ctx->buffer, sizeof(ctx->buffer));
+        ctx->buffer_len = 0;
+    }
+
+    n = xxh64_stripes(ctx->state, data, size);
+    memcpy(ctx->buffer, data + n, size - n);
+    ctx->buffer_len = size - n;
+}
+
+static uint64_t xxh64_final(HashContext *ctx)
+{
+    const uint64_t * const v = ctx->state;
+    const uint8_t *p = ctx->buffer;
+    unsigned int n = ctx->buffer_len;
+    uint64_t h;
+
+    if (ctx->length >= 32) {
+        h = rotl64(v[0], 1) + rotl64(v[1], 7) + rotl64(v[2], 12) + rotl64(v[3], 18);
+        h = xxh64_merge_round(h, v[0]);
+        h = xxh64_merge_round(h, v[1]);
+        h = xxh64_merge_round(h, v[2]);
+        h = xxh64_merge_round(h, v[3]);
+    }
+    else
+        h = XXH_PRIME64_5;
+    h += ctx->length;
+
+    for (; n >= 8; n -= 8, p += 8) {
+        h ^= xxh64_round(0, load_le64(p));
+        h  = rotl64(h, 27) * XXH_PRIME64_1 + XXH_PRIME64_4;
+    }
+    if (n >= 4) {
+        h ^= (uint64_t)load_le32(p) * XXH_PRIME64_1;
+        h  = rotl64(h, 23) * XXH_PRIME64_2 + XXH_PRIME64_3;
+        n -= 4;
+        p += 4;
+    }
+    for (; n > 0; n--, p++) {
+        h ^= *p * XXH_PRIME64_5;
+        h  = rotl64(h, 11) * XXH_PRIME64_1;
+    }
+
+    h ^= h >> 33;
+    h *= XXH_PRIME64_2;
+    h ^= h >> 29;
+    h *= XXH_PRIME64_3;
+    h ^= h >> 32;
+    return h;
+}
+
+/* ------------------------------------------------------------------------ */
+/* --- Interface                                                        --- */
+/* ------------------------------------------------------------------------ */
+
+void hash_init(HashContext *ctx, enum HashType type)
+{
+    hash_init_kernels();
+
+    memset(ctx, 0, sizeof(*ctx));
+    ctx->type = type;
+
+    switch (type) {
+    case HASH_CRC32C:
+        ctx->state[0] = 0xffffffff;
+        break;
+    case HASH_XXH64:
+        ctx->state[0] = XXH_PRIME64_1 + XXH_PRIME64_2;
+        ctx->state[1] = XXH_PRIME64_2;
+        ctx->state[2] = 0;
+        ctx->state[3] = -XXH_PRIME64_1;
+        break;
+    default:
+        break;
+    }
+}
+
+void hash_update(HashContext *ctx, const void *data, unsigned int size)
+{
+    switch (ctx->type) {
+    case HASH_CRC32C:
+        ctx->state[0] = crc32c_update(ctx->state[0], data, size);
+        break;
+    case HASH_XXH64:
+        xxh64_update(ctx, data, size);
+        break;
+    default:
+        break;
+    }
+}
+
+uint64_t hash_final(HashContext *ctx)
+{
+    switch (ctx->type) {
+    case HASH_CRC32C:
+        return (uint32_t)~ctx->state[0];
+    case HASH_XXH64:
+        return xxh64_final(ctx);
+    default:
+        break;
+    }
+    return 0;
+}
+
+unsigned int hash_get_digits(enum HashType type)
+{
+    switch (type) {
+    case HASH_CRC32C:   return 8;
+    case HASH_XXH64:    return 16;
+    default:            break;
+    }
+    return 0;
+}
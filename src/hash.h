@@ -0,0 +1,54 @@
+/*
+ *  hash.h - Checksums for decoded frames verification
+ *
+ *  hwdecode-demos (C) 2009-2010 Splitted-Desktop Systems
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef HASH_H
+#define HASH_H
+
+#include <stdint.h>
+
+enum HashType {
+    HASH_NONE = 0,
+    HASH_CRC32C,                // CRC-32C (Castagnoli), 32-bit
+    HASH_XXH64                  // xxHash64 with a zero seed, 64-bit
+};
+
+typedef struct _HashContext HashContext;
+
+struct _HashContext {
+    enum HashType       type;
+    uint64_t            state[4];
+    uint8_t             buffer[32];
+    unsigned int        buffer_len;
+    uint64_t            length;
+};
+
+// Starts a new checksum of TYPE
+void hash_init(HashContext *ctx, enum HashType type);
+
+// Appends SIZE bytes of DATA to the checksum
+void hash_update(HashContext *ctx, const void *data, unsigned int size);
+
+// Returns the checksum of all the data appended so far
+uint64_t hash_final(HashContext *ctx);
+
+// Returns the number of hexadecimal digits of a checksum of TYPE
+unsigned int hash_get_digits(enum HashType type);
+
+#endif /* HASH_H */
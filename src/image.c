@@ -20,11 +20,15 @@
 
 #include "sysdeps.h"
 #include "image.h"
+#include "image_simd.h"
+#include "thread_pool.h"
+#include "cpu.h"
 #include "utils.h"
 #include "common.h"
 #include <stdlib.h>
 #include <time.h>
 #include <math.h>
+#include <sys/mman.h>
 
 #if HAVE_AVUTIL
 # ifdef HAVE_LIBAVUTIL_PIXFMT_H
@@ -54,73 +58,407 @@
 #undef  FOURCC
 #define FOURCC IMAGE_FOURCC
 
-Image *image_create(unsigned int width, unsigned int height, uint32_t format)
+/* Planes start on a cache line boundary and pitches are padded to a
+   multiple of the cache line size, so that SIMD kernels never split a
+   cache line and threads working on different rows never share one */
+#define IMAGE_ALIGN             64
+#define IMAGE_ALIGN_SIZE(x)     (((x) + IMAGE_ALIGN - 1) & ~(IMAGE_ALIGN - 1))
+
+/* Images larger than a huge page may be backed by huge pages (--hugepages) */
+#define IMAGE_HUGE_PAGE_SIZE    (2U * 1024 * 1024)
+
+/* Destroyed images are kept around for reuse by image_create() */
+#define IMAGE_POOL_SIZE         8
+#define IMAGE_POOL_MAX_BYTES    (128U * 1024 * 1024)
+
+enum {
+    IMAGE_ALLOC_MALLOC = 1,
+    IMAGE_ALLOC_MMAP,
+};
+
+typedef struct _ImagePrivate ImagePrivate;
+
+struct _ImagePrivate {
+    Image               base;
+    uint32_t            format;
+    unsigned int        width;
+    unsigned int        height;
+    uint8_t            *data;
+    unsigned int        data_size;
+    unsigned int        alloc_size;
+    unsigned int        alloc_type;
+    uint64_t            last_use;
+};
+
+static struct {
+    ImagePrivate       *entries[IMAGE_POOL_SIZE];
+    uint64_t            tick;
+    unsigned int        hits;
+    unsigned int        misses;
+    uint64_t            live_bytes;
+    uint64_t            cached_bytes;
+    uint64_t            peak_bytes;
+} g_image_pool;
+
+static int
+image_init_layout(
+    Image       *img,
+    unsigned int width,
+    unsigned int height,
+    uint32_t     format
+)
 {
-    unsigned int i, width2, height2, size2, size;
-    Image *img = NULL;
-
-    img = calloc(1, sizeof(*img));
-    if (!img)
-        goto error;
+    unsigned int width2, height2;
 
+    memset(img, 0, sizeof(*img));
     img->format         = format;
     img->width          = width;
     img->height         = height;
-    size                = width * height;
     width2              = (width  + 1) / 2;
     height2             = (height + 1) / 2;
-    size2               = width2 * height2;
     switch (format) {
     case IMAGE_ARGB:
     case IMAGE_BGRA:
     case IMAGE_RGBA:
     case IMAGE_ABGR:
-        img->pitches[0] = width * 4;
+    case IMAGE_AYUV:
+        img->num_planes = 1;
+        img->pitches[0] = IMAGE_ALIGN_SIZE(width * 4);
+        img->offsets[0] = 0;
+        img->data_size  = img->pitches[0] * height;
         break;
     case IMAGE_NV12:
         img->num_planes = 2;
-        img->pitches[0] = width;
+        img->pitches[0] = IMAGE_ALIGN_SIZE(width);
         img->offsets[0] = 0;
-        img->pitches[1] = width;
-        img->offsets[1] = size;
-        img->data_size  = size + 2 * size2;
+        img->pitches[1] = IMAGE_ALIGN_SIZE(width2 * 2);
+        img->offsets[1] = img->pitches[0] * height;
+        img->data_size  = img->offsets[1] + img->pitches[1] * height2;
         break;
     case IMAGE_YV12:
     case IMAGE_IYUV:
     case IMAGE_I420:
         img->num_planes = 3;
-        img->pitches[0] = width;
+        img->pitches[0] = IMAGE_ALIGN_SIZE(width);
         img->offsets[0] = 0;
-        img->pitches[1] = width2;
-        img->offsets[1] = size;
-        img->pitches[2] = width2;
-        img->offsets[2] = size + size2;
-        img->data_size  = size + 2 * size2;
+        img->pitches[1] = IMAGE_ALIGN_SIZE(width2);
+        img->offsets[1] = img->pitches[0] * height;
+        img->pitches[2] = img->pitches[1];
+        img->offsets[2] = img->offsets[1] + img->pitches[1] * height2;
+        img->data_size  = img->offsets[2] + img->pitches[2] * height2;
         break;
     default:
-        goto error;
-    }
-    if (IS_RGB_IMAGE_FORMAT(format)) {
-        img->num_planes = 1;
-        img->offsets[0] = 0;
-        img->data_size  = img->pitches[0] * height;
+        return -1;
     }
     if (!img->data_size)
-        goto error;
+        return -1;
+    return 0;
+}
 
-    img->data = malloc(img->data_size);
-    if (!img->data)
-        goto error;
+static void image_update_peak_bytes(void)
+{
+    const uint64_t total_bytes =
+        g_image_pool.live_bytes + g_image_pool.cached_bytes;
 
-    for (i = 0; i < img->num_planes; i++)
-        img->pixels[i] = img->data + img->offsets[i];
-    return img;
+    if (g_image_pool.peak_bytes < total_bytes)
+        g_image_pool.peak_bytes = total_bytes;
+}
+
+static int image_alloc_data(ImagePrivate *priv)
+{
+    void *data = NULL;
+
+#ifdef MAP_ANONYMOUS
+    if (priv->data_size >= IMAGE_HUGE_PAGE_SIZE &&
+        common_get_context()->use_hugepages) {
+        const unsigned int alloc_size =
+            (priv->data_size + IMAGE_HUGE_PAGE_SIZE - 1) &
+            ~(IMAGE_HUGE_PAGE_SIZE - 1);
+
+#ifdef MAP_HUGETLB
+        data = mmap(NULL, alloc_size, PROT_READ|PROT_WRITE,
+                    MAP_PRIVATE|MAP_ANONYMOUS|MAP_HUGETLB, -1, 0);
+        if (data == MAP_FAILED)
+            data = NULL;
+#endif
+        if (!data) {
+            /* No reserved huge pages, try transparent huge pages instead */
+            data = mmap(NULL, alloc_size, PROT_READ|PROT_WRITE,
+                        MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
+            if (data == MAP_FAILED)
+                data = NULL;
+#ifdef MADV_HUGEPAGE
+            else
+                madvise(data, alloc_size, MADV_HUGEPAGE);
+#endif
+        }
+        if (data) {
+            priv->data       = data;
+            priv->alloc_size = alloc_size;
+            priv->alloc_type = IMAGE_ALLOC_MMAP;
+            return 0;
+        }
+    }
+#endif
+
+    if (posix_memalign(&data, IMAGE_ALIGN, priv->data_size) != 0)
+        return -1;
+    priv->data       = data;
+    priv->alloc_size = priv->data_size;
+    priv->alloc_type = IMAGE_ALLOC_MALLOC;
+    return 0;
+}
+
+static void image_free(ImagePrivate *priv)
+{
+    switch (priv->alloc_type) {
+#ifdef MAP_ANONYMOUS
+    case IMAGE_ALLOC_MMAP:
+        munmap(priv->data, priv->alloc_size);
+        break;
+#endif
+    case IMAGE_ALLOC_MALLOC:
+        free(priv->data);
+        break;
+    }
+    free(priv);
+}
 
-error:
-    free(img);
+static ImagePrivate *
+image_pool_get(unsigned int width, unsigned int height, uint32_t format)
+{
+    ImagePrivate *priv;
+    unsigned int i;
+
+    for (i = 0; i < IMAGE_POOL_SIZE; i++) {
+        priv = g_image_pool.entries[i];
+        if (priv                   &&
+            priv->format == format &&
+            priv->width  == width  &&
+            priv->height == height) {
+            g_image_pool.entries[i] = NULL;
+            g_image_pool.cached_bytes -= priv->alloc_size;
+            g_image_pool.hits++;
+            return priv;
+        }
+    }
+    g_image_pool.misses++;
     return NULL;
 }
 
+/* Evicts the least recently used images until size more bytes fit */
+static int image_pool_make_room(unsigned int size)
+{
+    ImagePrivate *lru;
+    unsigned int i, lru_index = 0;
+
+    if (size > IMAGE_POOL_MAX_BYTES)
+        return -1;
+
+    for (;;) {
+        lru = NULL;
+        for (i = 0; i < IMAGE_POOL_SIZE; i++) {
+            ImagePrivate * const priv = g_image_pool.entries[i];
+            if (!priv) {
+                if (g_image_pool.cached_bytes + size <= IMAGE_POOL_MAX_BYTES)
+                    return i;
+                continue;
+            }
+            if (!lru || priv->last_use < lru->last_use) {
+                lru = priv;
+                lru_index = i;
+            }
+        }
+        if (!lru)
+            return -1;
+        g_image_pool.entries[lru_index] = NULL;
+        g_image_pool.cached_bytes -= lru->alloc_size;
+        image_free(lru);
+    }
+}
+
+static void image_pool_exit(void)
+{
+    unsigned int i;
+
+    D(bug("image pool: %u hits, %u misses, %llu bytes live, "
+          "%llu bytes cached, %llu bytes peak\n",
+          g_image_pool.hits, g_image_pool.misses,
+          (unsigned long long)g_image_pool.live_bytes,
+          (unsigned long long)g_image_pool.cached_bytes,
+          (unsigned long long)g_image_pool.peak_bytes));
+
+    for (i = 0; i < IMAGE_POOL_SIZE; i++) {
+        ImagePrivate * const priv = g_image_pool.entries[i];
+        if (priv) {
+            g_image_pool.entries[i] = NULL;
+            image_free(priv);
+        }
+    }
+    g_image_pool.cached_bytes = 0;
+}
+
+Image *image_create(unsigned int width, unsigned int height, uint32_t format)
+{
+    ImagePrivate *priv;
+    Image layout;
+    unsigned int i;
+
+    if (image_init_layout(&layout, width, height, format) < 0)
+        return NULL;
+
+    priv = image_pool_get(width, height, format);
+    if (!priv) {
+        priv = calloc(1, sizeof(*priv));
+        if (!priv)
+            return NULL;
+        priv->format    = format;
+        priv->width     = width;
+        priv->height    = height;
+        priv->data_size = layout.data_size;
+        if (image_alloc_data(priv) < 0) {
+            free(priv);
+            return NULL;
+        }
+    }
+    g_image_pool.live_bytes += priv->alloc_size;
+    image_update_peak_bytes();
+
+    /* Reset the layout, users may have changed it through a pooled image */
+    priv->base      = layout;
+    priv->base.data = priv->data;
+    for (i = 0; i < priv->base.num_planes; i++)
+        priv->base.pixels[i] = priv->data + priv->base.offsets[i];
+    return &priv->base;
+}
+
+/* Tile grid dimensions for dirty regions tracking */
+static inline unsigned int get_tiles_x(const Image *img)
+{
+    return (img->width + IMAGE_TILE_WIDTH - 1) / IMAGE_TILE_WIDTH;
+}
+
+static inline unsigned int get_tiles_y(const Image *img)
+{
+    return (img->height + IMAGE_TILE_HEIGHT - 1) / IMAGE_TILE_HEIGHT;
+}
+
+int image_track_dirty(Image *img)
+{
+    const unsigned int num_tiles = get_tiles_x(img) * get_tiles_y(img);
+
+    if (!img->dirty_tiles) {
+        img->dirty_tiles = malloc(num_tiles);
+        if (!img->dirty_tiles)
+            return -1;
+    }
+    memset(img->dirty_tiles, 1, num_tiles);
+    return 0;
+}
+
+void image_mark_dirty(Image *img, int x, int y, unsigned int width, unsigned int height)
+{
+    const unsigned int tiles_x = get_tiles_x(img);
+    unsigned int x0, y0, x1, y1, tx, ty;
+
+    if (!img->dirty_tiles)
+        return;
+
+    /* Clip to the image bounds */
+    x0 = MAX(x, 0);
+    y0 = MAX(y, 0);
+    x1 = MIN((int64_t)x + width,  (int64_t)img->width);
+    y1 = MIN((int64_t)y + height, (int64_t)img->height);
+    if ((int)x1 <= (int)x0 || (int)y1 <= (int)y0)
+        return;
+
+    for (ty = y0 / IMAGE_TILE_HEIGHT; ty <= (y1 - 1) / IMAGE_TILE_HEIGHT; ty++) {
+        for (tx = x0 / IMAGE_TILE_WIDTH; tx <= (x1 - 1) / IMAGE_TILE_WIDTH; tx++)
+            img->dirty_tiles[ty * tiles_x + tx] = 1;
+    }
+}
+
+void image_clear_dirty(Image *img)
+{
+    if (img->dirty_tiles)
+        memset(img->dirty_tiles, 0, get_tiles_x(img) * get_tiles_y(img));
+}
+
+int image_is_dirty(Image *img)
+{
+    const unsigned int num_tiles = get_tiles_x(img) * get_tiles_y(img);
+
+    if (!img->dirty_tiles)
+        return 1;
+    return memchr(img->dirty_tiles, 1, num_tiles) != NULL;
+}
+
+int image_get_dirty_rects(Image *img, Rectangle **prects)
+{
+    const unsigned int tiles_x = get_tiles_x(img);
+    const unsigned int tiles_y = get_tiles_y(img);
+    Rectangle *rects, *r;
+    unsigned int i, n, tx, ty, t0;
+
+    *prects = NULL;
+
+    if (!img->dirty_tiles) {
+        rects = malloc(sizeof(*rects));
+        if (!rects)
+            return -1;
+        rects->x      = 0;
+        rects->y      = 0;
+        rects->width  = img->width;
+        rects->height = img->height;
+        *prects = rects;
+        return 1;
+    }
+
+    /* There are at most (TILES_X + 1) / 2 runs of dirty tiles per row */
+    rects = malloc(tiles_y * ((tiles_x + 1) / 2) * sizeof(*rects));
+    if (!rects)
+        return -1;
+
+    for (n = 0, ty = 0; ty < tiles_y; ty++) {
+        const uint8_t * const tiles = img->dirty_tiles + ty * tiles_x;
+        const unsigned int cur_row = n;
+        const unsigned int y = ty * IMAGE_TILE_HEIGHT;
+        const unsigned int h = MIN(IMAGE_TILE_HEIGHT, img->height - y);
+
+        for (tx = 0; tx < tiles_x; tx++) {
+            if (!tiles[tx])
+                continue;
+            for (t0 = tx; tx < tiles_x && tiles[tx]; tx++)
+                ;
+
+            r = &rects[n];
+            r->x      = t0 * IMAGE_TILE_WIDTH;
+            r->y      = y;
+            r->width  = MIN(tx * IMAGE_TILE_WIDTH, img->width) - r->x;
+            r->height = h;
+
+            /* Extend a rectangle ending on the previous row of tiles
+               with the same span, if any */
+            for (i = 0; i < cur_row; i++) {
+                if (rects[i].x == r->x && rects[i].width == r->width &&
+                    rects[i].y + rects[i].height == y) {
+                    rects[i].height += h;
+                    break;
+                }
+            }
+            if (i == cur_row)
+                n++;
+        }
+    }
+
+    if (n == 0) {
+        free(rects);
+        return 0;
+    }
+    *prects = rects;
+    return n;
+}
+
 #if HAVE_CAIRO
 static const int PETAL_MIN = 5;
 static const int PETAL_VAR = 8;
@@ -226,17 +564,16 @@ static const unsigned int RECT_VAR = 50;
 
 static void draw_rectangle(Image *img, int x, int y, int w, int h, uint32_t c)
 {
-    uint32_t *pixels = (uint32_t *)(img->pixels[0] + y * img->pitches[0] + x * 4);
-    unsigned int i, j;
+    Rectangle rect;
 
-    if (x >= img->width || y >= img->height)
+    if (w <= 0 || h <= 0)
         return;
 
-    /* XXX: no need to optimize this */
-    for (j = 0; j < h && (y + j) < img->height; j++, pixels += img->width) {
-        for (i = 0; i < w && (x + i) < img->width; i++)
-            pixels[i] = c;
-    }
+    rect.x      = x;
+    rect.y      = y;
+    rect.width  = w;
+    rect.height = h;
+    image_fill_rects(img, &rect, 1, c);
 }
 
 void image_draw_rectangle(Image *img, int x, int y, int w, int h, uint32_t c)
@@ -263,6 +600,7 @@ static int image_generate_flowers(Image *img)
     cr = cairo_create(surface);
     cairo_set_operator(cr, CAIRO_OPERATOR_CLEAR);
     cairo_paint(cr);
+    image_mark_dirty(img, 0, 0, img->width, img->height);
     cairo_set_operator(cr, CAIRO_OPERATOR_OVER);
     for (i = 0; i < 10; i++) {
         x = gen_random_int_range(0, img->width - (PETAL_MIN + PETAL_VAR) * 2);
@@ -283,6 +621,7 @@ static int image_generate_rects(Image *img)
 
     /* Simply draw random rectangles */
     memset(img->data, 0, img->data_size);
+    image_mark_dirty(img, 0, 0, img->width, img->height);
     for (i = 0; i < 10; i++) {
         x = gen_random_int_range(0, img->width - (RECT_MIN + RECT_VAR));
         y = gen_random_int_range(0, img->height);
@@ -301,18 +640,188 @@ static int image_generate_rgb_rects(Image *img)
 
     /* Draw R/G/B rectangles */
     memset(img->data, 0, img->data_size);
+    image_mark_dirty(img, 0, 0, img->width, img->height);
     draw_rectangle(img, 0,   0, w/2, h/2, 0xffff0000);
     draw_rectangle(img, w/2, 0, w/2, h/2, 0xff00ff00);
     draw_rectangle(img, 0, h/2, w/2, h/2, 0xff0000ff);
     return 1;
 }
 
+/* Test patterns are a pure function of the seed, the frame index and
+   the pixel coordinates, so that they do not depend on the number of
+   threads generating them. Quadrants hold a moving gradient, a zone
+   plate, noise and text-like glyphs on a transparent background */
+#define PATTERN_BAND_HEIGHT     32
+#define PATTERN_COS_BITS        10
+#define PATTERN_CELL_WIDTH      8
+#define PATTERN_CELL_HEIGHT     12
+
+typedef struct {
+    Image              *img;
+    uint32_t            seed;
+    unsigned int        index;
+} PatternBands;
+
+static uint8_t g_pattern_cos[1 << PATTERN_COS_BITS];
+
+/* Integer hash with good avalanche, from Chris Wellons' hash-prospector */
+static inline uint32_t pattern_hash(uint32_t x)
+{
+    x ^= x >> 16;
+    x *= 0x7feb352d;
+    x ^= x >> 15;
+    x *= 0x846ca68b;
+    x ^= x >> 16;
+    return x;
+}
+
+static inline uint32_t
+pattern_hash3(uint32_t seed, uint32_t a, uint32_t b, uint32_t c)
+{
+    return pattern_hash(seed ^ pattern_hash(a ^ pattern_hash(b ^ pattern_hash(c))));
+}
+
+static void pattern_init(void)
+{
+    static int initialized = 0;
+    unsigned int i;
+
+    if (initialized)
+        return;
+    initialized = 1;
+
+    for (i = 0; i < ARRAY_ELEMS(g_pattern_cos); i++)
+        g_pattern_cos[i] = 127.5 + 127.5 * cos(2.0 * M_PI * i / ARRAY_ELEMS(g_pattern_cos));
+}
+
+static void
+pattern_gradient_row(uint32_t *d, unsigned int y, unsigned int w, unsigned int h,
+                     unsigned int t)
+{
+    const uint32_t step = (255U << 16) / MAX(w, 2);
+    const unsigned int g = y * 255 / MAX(h - 1, 1);
+    unsigned int x, r;
+
+    for (x = 0; x < w; x++) {
+        r = ((x * step) >> 16) + 4 * t;
+        d[x] = 0xff000000 | ((r & 0xff) << 16) | (g << 8) | ((8 * t + x + y) & 0xff);
+    }
+}
+
+static void
+pattern_zone_plate_row(uint32_t *d, unsigned int y, unsigned int w, unsigned int h,
+                       unsigned int t)
+{
+    /* The local frequency reaches the Nyquist limit at radius R */
+    const unsigned int R = MAX(MAX(w, h) / 2, 1);
+    const uint64_t k = ((uint64_t)1 << (PATTERN_COS_BITS + 22)) / (4 * R);
+    const int dy = (int)y - (int)h / 2;
+    unsigned int x, v;
+    int dx;
+
+    for (x = 0; x < w; x++) {
+        dx = (int)x - (int)w / 2;
+        v  = g_pattern_cos[((((uint64_t)(dx * dx + dy * dy) * k) >> 22) + 16 * t) &
+                           (ARRAY_ELEMS(g_pattern_cos) - 1)];
+        d[x] = 0xff000000 | (v * 0x010101);
+    }
+}
+
+static void
+pattern_noise_row(uint32_t *d, unsigned int y, unsigned int w, uint32_t seed,
+                  unsigned int t)
+{
+    const uint32_t row = pattern_hash3(seed, t, y, 0x6e6f6973);
+    unsigned int x;
+
+    for (x = 0; x < w; x++)
+        d[x] = 0xff000000 | (pattern_hash(row + x * 0x9e3779b9) & 0xffffff);
+}
+
+static void
+pattern_text_row(uint32_t *d, unsigned int y, unsigned int w, uint32_t seed,
+                 unsigned int t)
+{
+    /* Text scrolls up by 3 lines of pixels per frame */
+    const unsigned int ly = y + 3 * t;
+    const unsigned int cy = ly / PATTERN_CELL_HEIGHT;
+    const unsigned int gy = ly % PATTERN_CELL_HEIGHT;
+    unsigned int x, cx, gx;
+    uint32_t cell = 0, bits;
+
+    for (x = 0; x < w; x++) {
+        cx = x / PATTERN_CELL_WIDTH;
+        gx = x % PATTERN_CELL_WIDTH;
+        if (gx == 0)
+            cell = pattern_hash3(seed, t / 16, cx, cy);
+
+        /* 5x8 glyphs, one in eight cells is a space */
+        d[x] = 0;
+        if (gx < 1 || gx > 5 || gy < 2 || gy > 9 || (cell & 7) == 0)
+            continue;
+        bits = pattern_hash(cell ^ (gy - 2));
+        if (bits & (1U << (gx - 1)))
+            d[x] = 0xffffffff;
+    }
+}
+
+static void image_generate_pattern_band(void *data, unsigned int index)
+{
+    PatternBands * const bands = data;
+    Image * const img = bands->img;
+    const unsigned int w2 = img->width  / 2;
+    const unsigned int h2 = img->height / 2;
+    const unsigned int y0 = index * PATTERN_BAND_HEIGHT;
+    const unsigned int y1 = MIN(y0 + PATTERN_BAND_HEIGHT, img->height);
+    const unsigned int t = bands->index;
+    unsigned int y;
+
+    for (y = y0; y < y1; y++) {
+        uint32_t * const d = (uint32_t *)(img->pixels[0] + y * img->pitches[0]);
+
+        if (y < h2) {
+            pattern_gradient_row(d, y, w2, h2, t);
+            pattern_zone_plate_row(d + w2, y, img->width - w2, h2, t);
+        }
+        else {
+            pattern_noise_row(d, y - h2, w2, bands->seed, t);
+            pattern_text_row(d + w2, y - h2, img->width - w2, bands->seed, t);
+        }
+    }
+}
+
+static int image_generate_patterns(Image *img, unsigned int index)
+{
+    CommonContext * const common = common_get_context();
+    PatternBands bands;
+
+    pattern_init();
+
+    bands.img   = img;
+    bands.seed  = common->genimage_seed;
+    bands.index = index;
+    thread_pool_run(image_generate_pattern_band, &bands,
+                    (img->height + PATTERN_BAND_HEIGHT - 1) / PATTERN_BAND_HEIGHT);
+    image_mark_dirty(img, 0, 0, img->width, img->height);
+    return 1;
+}
+
 Image *image_generate(unsigned int width, unsigned int height)
+{
+    return image_generate_frame(width, height, 0);
+}
+
+Image *image_generate_frame(unsigned int width, unsigned int height, unsigned int index)
 {
     Image *img = image_create(width, height, IMAGE_RGB32);
     if (!img)
         return NULL;
 
+    if (image_track_dirty(img) < 0) {
+        image_destroy(img);
+        return NULL;
+    }
+
     int ok;
     const enum GenImageType genimage_type = common_get_context()->genimage_type;
     switch (genimage_type) {
@@ -328,6 +837,9 @@ Image *image_generate(unsigned int width, unsigned int height)
     case GENIMAGE_RGB_RECTS:
         ok = image_generate_rgb_rects(img);
         break;
+    case GENIMAGE_PATTERNS:
+        ok = image_generate_patterns(img, index);
+        break;
     default:
         ok = 0;
         break;
@@ -342,14 +854,24 @@ Image *image_generate(unsigned int width, unsigned int height)
 
 void image_destroy(Image *img)
 {
-    if (!img)
+    ImagePrivate * const priv = (ImagePrivate *)img;
+    int i;
+
+    if (!priv)
         return;
 
-    if (img->data) {
-        free(img->data);
-        img->data = NULL;
+    free(img->dirty_tiles);
+    img->dirty_tiles = NULL;
+
+    g_image_pool.live_bytes -= priv->alloc_size;
+    i = image_pool_make_room(priv->alloc_size);
+    if (i < 0) {
+        image_free(priv);
+        return;
     }
-    free(img);
+    priv->last_use = ++g_image_pool.tick;
+    g_image_pool.entries[i] = priv;
+    g_image_pool.cached_bytes += priv->alloc_size;
 }
 
 uint32_t image_rgba_format(
@@ -406,219 +928,522 @@ uint32_t image_rgba_format(
     return 0;
 }
 
-#if HAVE_SWSCALE
-static enum PixelFormat get_pixel_format(uint32_t fourcc)
+static int image_copy_NV12(
+    uint8_t     *src[MAX_IMAGE_PLANES],
+    int          src_stride[MAX_IMAGE_PLANES],
+    uint8_t     *dst[MAX_IMAGE_PLANES],
+    int          dst_stride[MAX_IMAGE_PLANES],
+    unsigned int width,
+    unsigned int height
+)
 {
-    switch (fourcc) {
-    case FOURCC('N','V','1','2'): return PIX_FMT_NV12;
-    case FOURCC('I','Y','U','V'): /* duplicate of */
-    case FOURCC('I','4','2','0'): return PIX_FMT_YUV420P;
-    case FOURCC('U','Y','V','Y'): return PIX_FMT_UYVY422;
-    case FOURCC('Y','U','Y','2'): /* duplicate of */
-    case FOURCC('Y','U','Y','V'): return PIX_FMT_YUYV422;
-    case IMAGE_ARGB: return PIX_FMT_ARGB;
-    case IMAGE_BGRA: return PIX_FMT_BGRA;
-    case IMAGE_RGBA: return PIX_FMT_RGBA;
-    case IMAGE_ABGR: return PIX_FMT_ABGR;
-    }
-    return PIX_FMT_NONE;
+    uint8_t *s, *d;
+    unsigned int y;
+
+    // Copy Y
+    s = src[0];
+    d = dst[0];
+    for (y = 0; y < height; y++, s += src_stride[0], d += dst_stride[0])
+        memcpy(d, s, width);
+
+    // Copy UV
+    s = src[1];
+    d = dst[1];
+    for (y = 0; y < (height + 1) / 2; y++, s += src_stride[1], d += dst_stride[1])
+        memcpy(d, s, 2 * ((width + 1) / 2));
+    return 0;
 }
-#endif
 
-#if HAVE_SWSCALE
-static int image_convert_libswscale(
-    uint8_t     *arg_src[MAX_IMAGE_PLANES],
-    int          arg_src_stride[MAX_IMAGE_PLANES],
-    unsigned int src_width,
-    unsigned int src_height,
-    uint32_t     src_fourcc,
-    uint8_t     *arg_dst[MAX_IMAGE_PLANES],
-    int          arg_dst_stride[MAX_IMAGE_PLANES],
-    unsigned int dst_width,
-    unsigned int dst_height,
-    uint32_t     dst_fourcc
+static int image_copy_RGB32(
+    uint8_t     *src,
+    unsigned int src_stride,
+    uint8_t     *dst,
+    unsigned int dst_stride,
+    unsigned int width,
+    unsigned int height
 )
 {
-    int error = -1;
-    struct SwsContext *sws = NULL;
-    enum PixelFormat src_pix_fmt, dst_pix_fmt;
-    uint8_t *src[MAX_IMAGE_PLANES];
-    uint8_t *dst[MAX_IMAGE_PLANES];
-    int src_stride[MAX_IMAGE_PLANES];
-    int dst_stride[MAX_IMAGE_PLANES];
-    uint8_t *tmp_src[MAX_IMAGE_PLANES] = { NULL, };
-    uint8_t *tmp_dst[MAX_IMAGE_PLANES] = { NULL, };
-    int tmp_src_stride[MAX_IMAGE_PLANES];
-    int tmp_dst_stride[MAX_IMAGE_PLANES];
-    int i, j, stride;
+    const unsigned int bytes_per_line = 4 * width;
+    unsigned int y;
 
-    /* XXX: libswscale does not support AYUV formats yet */
-    switch (src_fourcc) {
-    case IMAGE_AYUV:
-        src_pix_fmt = PIX_FMT_YUV444P;
-        for (i = 0; i < 3; i++) {
-            tmp_src[i] = malloc(src_width * src_height);
-            if (!tmp_src[i])
-                goto end;
-            tmp_src_stride[i] = src_width;
-            src[i] = tmp_src[i];
-            src_stride[i] = tmp_src_stride[i];
-        }
-        stride = arg_src_stride[0];
-        for (j = 0; j < src_height; j++) {
-            for (i = 0; i < src_width; i++) {
-                const int src_offset = j * arg_src_stride[0] + 4 * i;
-                const int dst_offset = j * src_width + i;
-#ifdef WORDS_BIGENDIAN
-                tmp_src[0][dst_offset] = arg_src[0][src_offset + 1];
-                tmp_src[1][dst_offset] = arg_src[0][src_offset + 2];
-                tmp_src[2][dst_offset] = arg_src[0][src_offset + 3];
-#else
-                tmp_src[0][dst_offset] = arg_src[0][src_offset + 2];
-                tmp_src[1][dst_offset] = arg_src[0][src_offset + 1];
-                tmp_src[2][dst_offset] = arg_src[0][src_offset + 0];
-#endif
-            }
+    for (y = 0; y < height; y++, src += src_stride, dst += dst_stride)
+        memcpy(dst, src, bytes_per_line);
+    return 0;
+}
+
+static void image_swizzle_RGB32_c(
+    const uint8_t *src,
+    unsigned int   src_stride,
+    uint8_t       *dst,
+    unsigned int   dst_stride,
+    unsigned int   width,
+    unsigned int   height,
+    const uint8_t  perm[4]
+)
+{
+    unsigned int x, y;
+
+    for (y = 0; y < height; y++, src += src_stride, dst += dst_stride)
+        for (x = 0; x < width; x++) {
+            dst[x*4 + 0] = src[x*4 + perm[0]];
+            dst[x*4 + 1] = src[x*4 + perm[1]];
+            dst[x*4 + 2] = src[x*4 + perm[2]];
+            dst[x*4 + 3] = src[x*4 + perm[3]];
         }
-        break;
-    case IMAGE_YV12:
-        src_pix_fmt = PIX_FMT_YUV420P;
-        src[0] = arg_src[0];
-        src_stride[0] = arg_src_stride[0];
-        src[1] = arg_src[2];
-        src_stride[1] = arg_src_stride[2];
-        src[2] = arg_src[1];
-        src_stride[2] = arg_src_stride[1];
-        break;
-    default:
-        src_pix_fmt = get_pixel_format(src_fourcc);
-        for (i = 0; i < MAX_IMAGE_PLANES; i++) {
-            src[i] = arg_src[i];
-            src_stride[i] = arg_src_stride[i];
-        }
-        break;
-    }
+}
 
-    /* XXX: libswscale does not support AYUV formats yet */
-    switch (dst_fourcc) {
-    case IMAGE_AYUV:
-        dst_pix_fmt = PIX_FMT_YUV444P;
-        for (i = 0; i < 3; i++) {
-            tmp_dst[i] = malloc(dst_width * dst_height);
-            if (!tmp_dst[i])
-                goto end;
-            tmp_dst_stride[i] = dst_width;
-            dst[i] = tmp_dst[i];
-            dst_stride[i] = tmp_dst_stride[i];
-        }
-        break;
-    case IMAGE_YV12:
-        dst_pix_fmt = PIX_FMT_YUV420P;
-        dst[0] = arg_dst[0];
-        dst_stride[0] = arg_dst_stride[0];
-        dst[1] = arg_dst[2];
-        dst_stride[1] = arg_dst_stride[2];
-        dst[2] = arg_dst[1];
-        dst_stride[2] = arg_dst_stride[1];
-        break;
-    default:
-        dst_pix_fmt = get_pixel_format(dst_fourcc);
-        for (i = 0; i < MAX_IMAGE_PLANES; i++) {
-            dst[i] = arg_dst[i];
-            dst_stride[i] = arg_dst_stride[i];
-        }
-        break;
+static image_swizzle_RGB32_func image_swizzle_RGB32 = image_swizzle_RGB32_c;
+
+static void image_YUV420_to_RGB32_c(
+    const uint8_t       *y_src,
+    unsigned int         y_stride,
+    const uint8_t       *u_src,
+    const uint8_t       *v_src,
+    unsigned int         uv_stride,
+    unsigned int         uv_step,
+    uint8_t             *dst,
+    unsigned int         dst_stride,
+    unsigned int         width,
+    unsigned int         height,
+    const ImageYUVCoefs *coefs,
+    const uint8_t        order[4]
+)
+{
+    unsigned int x, y;
+
+    for (y = 0; y < height; y++) {
+        const uint8_t * const up = u_src + (y / 2) * uv_stride;
+        const uint8_t * const vp = v_src + (y / 2) * uv_stride;
+        for (x = 0; x < width; x++)
+            image_YUV_to_RGB32_pixel(y_src[x],
+                                     up[(x/2) * uv_step],
+                                     vp[(x/2) * uv_step],
+                                     coefs, order, dst + 4 * x);
+        y_src += y_stride;
+        dst   += dst_stride;
     }
+}
 
-    if (src_pix_fmt == PIX_FMT_NONE || dst_pix_fmt == PIX_FMT_NONE)
-        goto end;
+static image_YUV420_to_RGB32_func image_YUV420_to_RGB32 = image_YUV420_to_RGB32_c;
+
+static void image_AYUV_to_YUV444P_c(
+    const uint8_t       *src,
+    unsigned int         src_stride,
+    uint8_t             *y_dst,
+    unsigned int         y_stride,
+    uint8_t             *u_dst,
+    uint8_t             *v_dst,
+    unsigned int         uv_stride,
+    unsigned int         width,
+    unsigned int         height,
+    const uint8_t        order[4]
+)
+{
+    uint8_t pos[4];
+    unsigned int x, y;
 
-    sws = sws_getContext(src_width, src_height, src_pix_fmt,
-                         dst_width, dst_height, dst_pix_fmt,
-                         SWS_BICUBIC, NULL, NULL, NULL);
-    if (!sws)
-        goto end;
+    image_invert_order(order, pos);
+    for (y = 0; y < height; y++) {
+        for (x = 0; x < width; x++) {
+            y_dst[x] = src[4 * x + pos[0]];
+            u_dst[x] = src[4 * x + pos[1]];
+            v_dst[x] = src[4 * x + pos[2]];
+        }
+        src   += src_stride;
+        y_dst += y_stride;
+        u_dst += uv_stride;
+        v_dst += uv_stride;
+    }
+}
 
-    sws_scale(sws, src, src_stride, 0, src_height, dst, dst_stride);
-    sws_freeContext(sws);
+static image_AYUV_to_YUV444P_func image_AYUV_to_YUV444P = image_AYUV_to_YUV444P_c;
+
+static void image_YUV444P_to_AYUV_c(
+    const uint8_t       *y_src,
+    unsigned int         y_stride,
+    const uint8_t       *u_src,
+    const uint8_t       *v_src,
+    unsigned int         uv_stride,
+    uint8_t             *dst,
+    unsigned int         dst_stride,
+    unsigned int         width,
+    unsigned int         height,
+    const uint8_t        order[4]
+)
+{
+    unsigned int x, y;
 
-    /* XXX: libswscale does not support AYUV formats yet */
-    switch (dst_fourcc) {
-    case IMAGE_AYUV:
-        stride = arg_dst_stride[0];
-        for (j = 0; j < dst_height; j++) {
-            for (i = 0; i < dst_width; i++) {
-                const int src_offset = j * dst_width + i;
-                const int dst_offset = j * arg_dst_stride[0] + 4 * i;
-#ifdef WORDS_BIGENDIAN
-                arg_dst[0][dst_offset + 0] = 0xff;
-                arg_dst[0][dst_offset + 1] = tmp_dst[0][src_offset];
-                arg_dst[0][dst_offset + 2] = tmp_dst[1][src_offset];
-                arg_dst[0][dst_offset + 3] = tmp_dst[2][src_offset];
-#else
-                arg_dst[0][dst_offset + 0] = tmp_dst[2][src_offset];
-                arg_dst[0][dst_offset + 1] = tmp_dst[1][src_offset];
-                arg_dst[0][dst_offset + 2] = tmp_dst[0][src_offset];
-                arg_dst[0][dst_offset + 3] = 0xff;
-#endif
-            }
+    for (y = 0; y < height; y++) {
+        for (x = 0; x < width; x++) {
+            const uint8_t yuva[4] = { y_src[x], u_src[x], v_src[x], 0xff };
+            dst[4 * x + 0] = yuva[order[0]];
+            dst[4 * x + 1] = yuva[order[1]];
+            dst[4 * x + 2] = yuva[order[2]];
+            dst[4 * x + 3] = yuva[order[3]];
         }
-        break;
+        y_src += y_stride;
+        u_src += uv_stride;
+        v_src += uv_stride;
+        dst   += dst_stride;
     }
+}
 
-    error = 0;
-end:
-    for (i = 0; i < MAX_IMAGE_PLANES; i++) {
-        free(tmp_src[i]);
-        free(tmp_dst[i]);
-    }
-    return error;
+static image_YUV444P_to_AYUV_func image_YUV444P_to_AYUV = image_YUV444P_to_AYUV_c;
+
+static void image_RGB32_to_AYUV_c(
+    const uint8_t       *src,
+    unsigned int         src_stride,
+    uint8_t             *dst,
+    unsigned int         dst_stride,
+    unsigned int         width,
+    unsigned int         height,
+    const ImageRGBCoefs *coefs,
+    const uint8_t        order[4]
+)
+{
+    unsigned int x, y;
+
+    for (y = 0; y < height; y++, src += src_stride, dst += dst_stride)
+        for (x = 0; x < width; x++)
+            image_RGB32_to_AYUV_pixel(src + 4 * x, coefs, order, dst + 4 * x);
 }
-#endif
 
-static int image_copy_NV12(
-    uint8_t     *src[MAX_IMAGE_PLANES],
-    int          src_stride[MAX_IMAGE_PLANES],
-    uint8_t     *dst[MAX_IMAGE_PLANES],
-    int          dst_stride[MAX_IMAGE_PLANES],
-    unsigned int width,
-    unsigned int height
+static image_RGB32_to_AYUV_func image_RGB32_to_AYUV = image_RGB32_to_AYUV_c;
+
+static void image_transpose_8_c(
+    const uint8_t *src,
+    int            src_stride,
+    uint8_t       *dst,
+    int            dst_stride,
+    unsigned int   width,
+    unsigned int   height
 )
 {
-    uint8_t *s, *d;
-    unsigned int y;
+    image_transpose_block(src, src_stride, dst, dst_stride, width, height, 1);
+}
 
-    // Copy Y
-    s = src[0];
-    d = dst[0];
-    for (y = 0; y < height; y++, s += src_stride[0], d += dst_stride[0])
-        memcpy(d, s, width);
+static image_transpose_func image_transpose_8 = image_transpose_8_c;
 
-    // Copy UV
-    s = src[1];
-    d = dst[1];
-    for (y = 0; y < height/2; y++, s += src_stride[1], d += dst_stride[1])
-        memcpy(d, s, width);
-    return 0;
+static void image_transpose_16_c(
+    const uint8_t *src,
+    int            src_stride,
+    uint8_t       *dst,
+    int            dst_stride,
+    unsigned int   width,
+    unsigned int   height
+)
+{
+    image_transpose_block(src, src_stride, dst, dst_stride, width, height, 2);
 }
 
-static int image_copy_RGB32(
-    uint8_t     *src,
-    unsigned int src_stride,
-    uint8_t     *dst,
-    unsigned int dst_stride,
-    unsigned int width,
-    unsigned int height
+static image_transpose_func image_transpose_16 = image_transpose_16_c;
+
+static void image_transpose_32_c(
+    const uint8_t *src,
+    int            src_stride,
+    uint8_t       *dst,
+    int            dst_stride,
+    unsigned int   width,
+    unsigned int   height
+)
+{
+    image_transpose_block(src, src_stride, dst, dst_stride, width, height, 4);
+}
+
+static image_transpose_func image_transpose_32 = image_transpose_32_c;
+
+static void image_mirror_c(
+    const uint8_t *src,
+    int            src_stride,
+    uint8_t       *dst,
+    int            dst_stride,
+    unsigned int   width,
+    unsigned int   height,
+    unsigned int   bpp
 )
 {
-    const unsigned int bytes_per_line = 4 * width;
     unsigned int y;
 
     for (y = 0; y < height; y++, src += src_stride, dst += dst_stride)
-        memcpy(dst, src, bytes_per_line);
+        image_mirror_row(src, dst, 0, width, bpp);
+}
+
+static image_mirror_func image_mirror = image_mirror_c;
+
+static void image_stream_load_c(
+    uint8_t       *dst,
+    const uint8_t *src,
+    unsigned int   size
+)
+{
+    memcpy(dst, src, size);
+}
+
+static image_stream_load_func image_stream_load = image_stream_load_c;
+
+static void image_blend_row_c(
+    uint8_t       *dst,
+    const uint8_t *src,
+    const uint8_t *k,
+    unsigned int   n
+)
+{
+    image_blend_row_tail(dst, src, k, 0, n);
+}
+
+static image_blend_row_func image_blend_row = image_blend_row_c;
+
+static void image_fill_rect_c(
+    uint8_t       *dst,
+    unsigned int   dst_stride,
+    unsigned int   width,
+    unsigned int   height,
+    uint32_t       value
+)
+{
+    unsigned int x, y;
+
+    for (y = 0; y < height; y++, dst += dst_stride) {
+        uint32_t * const d = (uint32_t *)dst;
+        for (x = 0; x < width; x++)
+            d[x] = value;
+    }
+}
+
+static image_fill_rect_func image_fill_rect = image_fill_rect_c;
+
+/* Override KERNEL with its ISA variant if the host CPU has FEATURE */
+#define USE_KERNEL(KERNEL, ISA, FEATURE) do {           \
+        if (features & (FEATURE)) {                     \
+            image_##KERNEL      = image_##KERNEL##_##ISA; \
+            KERNEL##_isa        = #ISA;                 \
+        }                                               \
+    } while (0)
+
+/* Restore the C version of KERNEL */
+#define USE_C_KERNEL(KERNEL) do {                       \
+        image_##KERNEL = image_##KERNEL##_c;            \
+    } while (0)
+
+/* Select the best kernels for the host CPU, again if its features were
+   masked since */
+static void image_init_kernels(void)
+{
+    static int initialized = 0;
+    static unsigned int selected_features;
+    const unsigned int features = cpu_get_features();
+    const char *swizzle_RGB32_isa = "c";
+    const char *YUV420_to_RGB32_isa = "c";
+    const char *AYUV_to_YUV444P_isa = "c";
+    const char *YUV444P_to_AYUV_isa = "c";
+    const char *RGB32_to_AYUV_isa = "c";
+    const char *transpose_8_isa = "c";
+    const char *transpose_16_isa = "c";
+    const char *transpose_32_isa = "c";
+    const char *mirror_isa = "c";
+    const char *stream_load_isa = "c";
+    const char *blend_row_isa = "c";
+    const char *fill_rect_isa = "c";
+
+    if (initialized && features == selected_features)
+        return;
+    initialized = 1;
+    selected_features = features;
+
+    D(bug("CPU features: %s\n", cpu_get_features_string()));
+    USE_C_KERNEL(swizzle_RGB32);
+    USE_C_KERNEL(YUV420_to_RGB32);
+    USE_C_KERNEL(AYUV_to_YUV444P);
+    USE_C_KERNEL(YUV444P_to_AYUV);
+    USE_C_KERNEL(RGB32_to_AYUV);
+    USE_C_KERNEL(transpose_8);
+    USE_C_KERNEL(transpose_16);
+    USE_C_KERNEL(transpose_32);
+    USE_C_KERNEL(mirror);
+    USE_C_KERNEL(stream_load);
+    USE_C_KERNEL(blend_row);
+    USE_C_KERNEL(fill_rect);
+
+    /* Kernels are listed from the least to the most preferred one */
+#if USE_SIMD_X86
+    USE_KERNEL(swizzle_RGB32, sse2,  CPU_FEATURE_SSE2);
+    USE_KERNEL(swizzle_RGB32, ssse3, CPU_FEATURE_SSSE3);
+    USE_KERNEL(swizzle_RGB32, avx2,  CPU_FEATURE_AVX2);
+    USE_KERNEL(YUV420_to_RGB32, sse2, CPU_FEATURE_SSE2);
+    USE_KERNEL(YUV420_to_RGB32, avx2, CPU_FEATURE_AVX2);
+    USE_KERNEL(AYUV_to_YUV444P, ssse3, CPU_FEATURE_SSSE3);
+    USE_KERNEL(AYUV_to_YUV444P, avx2, CPU_FEATURE_AVX2);
+    USE_KERNEL(YUV444P_to_AYUV, sse2, CPU_FEATURE_SSE2);
+    USE_KERNEL(YUV444P_to_AYUV, avx2, CPU_FEATURE_AVX2);
+    USE_KERNEL(RGB32_to_AYUV, ssse3, CPU_FEATURE_SSSE3);
+    USE_KERNEL(RGB32_to_AYUV, avx2, CPU_FEATURE_AVX2);
+    USE_KERNEL(transpose_8, sse2, CPU_FEATURE_SSE2);
+    USE_KERNEL(transpose_16, sse2, CPU_FEATURE_SSE2);
+    USE_KERNEL(transpose_32, sse2, CPU_FEATURE_SSE2);
+    USE_KERNEL(transpose_32, avx2, CPU_FEATURE_AVX2);
+    USE_KERNEL(mirror, ssse3, CPU_FEATURE_SSSE3);
+    USE_KERNEL(stream_load, sse4_1, CPU_FEATURE_SSE4_1);
+    USE_KERNEL(blend_row, sse2, CPU_FEATURE_SSE2);
+    USE_KERNEL(blend_row, avx2, CPU_FEATURE_AVX2);
+    USE_KERNEL(fill_rect, sse2, CPU_FEATURE_SSE2);
+    USE_KERNEL(fill_rect, avx2, CPU_FEATURE_AVX2);
+#endif
+#if USE_SIMD_NEON
+    USE_KERNEL(swizzle_RGB32, neon,  CPU_FEATURE_NEON);
+    USE_KERNEL(YUV420_to_RGB32, neon, CPU_FEATURE_NEON);
+    USE_KERNEL(AYUV_to_YUV444P, neon, CPU_FEATURE_NEON);
+    USE_KERNEL(YUV444P_to_AYUV, neon, CPU_FEATURE_NEON);
+    USE_KERNEL(RGB32_to_AYUV, neon, CPU_FEATURE_NEON);
+    USE_KERNEL(transpose_8, neon, CPU_FEATURE_NEON);
+    USE_KERNEL(transpose_16, neon, CPU_FEATURE_NEON);
+    USE_KERNEL(transpose_32, neon, CPU_FEATURE_NEON);
+    USE_KERNEL(mirror, neon, CPU_FEATURE_NEON);
+    USE_KERNEL(blend_row, neon, CPU_FEATURE_NEON);
+    USE_KERNEL(fill_rect, neon, CPU_FEATURE_NEON);
+#endif
+    D(bug("using %s kernel for RGB32 swizzles\n", swizzle_RGB32_isa));
+    D(bug("using %s kernel for YUV 4:2:0 to RGB32 conversions\n",
+          YUV420_to_RGB32_isa));
+    D(bug("using %s kernel for AYUV unpacking\n", AYUV_to_YUV444P_isa));
+    D(bug("using %s kernel for AYUV packing\n", YUV444P_to_AYUV_isa));
+    D(bug("using %s kernel for RGB32 to AYUV conversions\n", RGB32_to_AYUV_isa));
+    D(bug("using %s/%s/%s kernels for 8/16/32-bit transposes\n",
+          transpose_8_isa, transpose_16_isa, transpose_32_isa));
+    D(bug("using %s kernel for mirroring\n", mirror_isa));
+    D(bug("using %s kernel for uncached memory reads\n", stream_load_isa));
+    D(bug("using %s kernel for alpha blending\n", blend_row_isa));
+    D(bug("using %s kernel for rectangle fills\n", fill_rect_isa));
+}
+
+/* Fills of images at least that large use non-temporal stores, smaller
+   ones are likely read back from the caches soon */
+#define FILL_STREAM_MIN_BYTES   (1024 * 1024)
+
+typedef struct {
+    unsigned int        x0, y0, x1, y1;
+} FillBox;
+
+static int fill_box_compare_y(const void *a, const void *b)
+{
+    const FillBox * const ba = a;
+    const FillBox * const bb = b;
+
+    return (ba->y0 > bb->y0) - (ba->y0 < bb->y0);
+}
+
+static int fill_box_compare_x(const void *a, const void *b)
+{
+    const FillBox * const ba = a;
+    const FillBox * const bb = b;
+
+    return (ba->x0 > bb->x0) - (ba->x0 < bb->x0);
+}
+
+static int uint_compare(const void *a, const void *b)
+{
+    const unsigned int ua = *(const unsigned int *)a;
+    const unsigned int ub = *(const unsigned int *)b;
+
+    return (ua > ub) - (ua < ub);
+}
+
+int image_fill_rects(
+    Image           *img,
+    const Rectangle *rects,
+    unsigned int     n_rects,
+    uint32_t         value
+)
+{
+    image_fill_rect_func fill;
+    FillBox *boxes, *active, *spans;
+    unsigned int *edges;
+    unsigned int i, j, n, n_edges, n_active, n_spans, next;
+    int64_t x0, y0, x1, y1;
+
+    if (!IS_RGB_IMAGE_FORMAT(img->format) && img->format != IMAGE_AYUV)
+        return -1;
+    if (n_rects == 0)
+        return 0;
+
+    image_init_kernels();
+    fill = image_fill_rect_c;
+    if ((uint64_t)img->height * img->pitches[0] >= FILL_STREAM_MIN_BYTES)
+        fill = image_fill_rect;
+
+    /* Boxes, the active ones and the spans of the current band, then the
+       band edges */
+    boxes = malloc(3 * n_rects * sizeof(*boxes) + 2 * n_rects * sizeof(*edges));
+    if (!boxes)
+        return -1;
+    active = boxes + n_rects;
+    spans  = active + n_rects;
+    edges  = (unsigned int *)(spans + n_rects);
+
+    /* Clip rectangles to the image */
+    for (i = 0, n = 0; i < n_rects; i++) {
+        x0 = MAX(rects[i].x, 0);
+        y0 = MAX(rects[i].y, 0);
+        x1 = MIN((int64_t)rects[i].x + rects[i].width,  (int64_t)img->width);
+        y1 = MIN((int64_t)rects[i].y + rects[i].height, (int64_t)img->height);
+        if (x0 >= x1 || y0 >= y1)
+            continue;
+        boxes[n].x0 = x0;
+        boxes[n].y0 = y0;
+        boxes[n].x1 = x1;
+        boxes[n].y1 = y1;
+        edges[2 * n]     = y0;
+        edges[2 * n + 1] = y1;
+        n++;
+    }
+    qsort(boxes, n, sizeof(*boxes), fill_box_compare_y);
+    qsort(edges, 2 * n, sizeof(*edges), uint_compare);
+
+    /* Sweep horizontal bands where the set of covering boxes does not
+       change, and fill the union of their spans once per band */
+    for (i = 0, n_edges = 0; i < 2 * n; i++) {
+        if (n_edges == 0 || edges[i] != edges[n_edges - 1])
+            edges[n_edges++] = edges[i];
+    }
+
+    for (i = 0, n_active = 0, next = 0; i + 1 < n_edges; i++) {
+        const unsigned int band_y0 = edges[i];
+        const unsigned int band_y1 = edges[i + 1];
+
+        for (j = 0; j < n_active; ) {
+            if (active[j].y1 <= band_y0)
+                active[j] = active[--n_active];
+            else
+                j++;
+        }
+        while (next < n && boxes[next].y0 <= band_y0)
+            active[n_active++] = boxes[next++];
+        if (n_active == 0)
+            continue;
+
+        memcpy(spans, active, n_active * sizeof(*spans));
+        qsort(spans, n_active, sizeof(*spans), fill_box_compare_x);
+        for (j = 1, n_spans = 1; j < n_active; j++) {
+            FillBox * const span = &spans[n_spans - 1];
+            if (spans[j].x0 <= span->x1)
+                span->x1 = MAX(span->x1, spans[j].x1);
+            else
+                spans[n_spans++] = spans[j];
+        }
+
+        for (j = 0; j < n_spans; j++) {
+            fill(img->pixels[0] + band_y0 * img->pitches[0] + spans[j].x0 * 4,
+                 img->pitches[0], spans[j].x1 - spans[j].x0,
+                 band_y1 - band_y0, value);
+            image_mark_dirty(img, spans[j].x0, band_y0,
+                             spans[j].x1 - spans[j].x0, band_y1 - band_y0);
+        }
+    }
+    free(boxes);
     return 0;
 }
 
+#undef USE_KERNEL
+
 static inline int image_convert_RGB32(
     uint8_t     *src,
     unsigned int src_stride,
@@ -632,24 +1457,22 @@ static inline int image_convert_RGB32(
     unsigned int aidx
 )
 {
-    unsigned int x, y;
+    uint8_t perm[4];
 
-    for (y = 0; y < height; y++, src += src_stride, dst += dst_stride)
-        for (x = 0; x < width; x++) {
 #ifdef WORDS_BIGENDIAN
-            /* ARGB */
-            dst[x*4 + ridx] = src[x*4 + 1];
-            dst[x*4 + gidx] = src[x*4 + 2];
-            dst[x*4 + bidx] = src[x*4 + 3];
-            dst[x*4 + aidx] = src[x*4 + 0];
+    /* ARGB */
+    perm[ridx] = 1;
+    perm[gidx] = 2;
+    perm[bidx] = 3;
+    perm[aidx] = 0;
 #else
-            /* BGRA */
-            dst[x*4 + ridx] = src[x*4 + 2];
-            dst[x*4 + gidx] = src[x*4 + 1];
-            dst[x*4 + bidx] = src[x*4 + 0];
-            dst[x*4 + aidx] = src[x*4 + 3];
+    /* BGRA */
+    perm[ridx] = 2;
+    perm[gidx] = 1;
+    perm[bidx] = 0;
+    perm[aidx] = 3;
 #endif
-        }
+    image_swizzle_RGB32(src, src_stride, dst, dst_stride, width, height, perm);
     return 0;
 }
 
@@ -721,132 +1544,1827 @@ static int image_convert_RGB32_to_ABGR(
     );
 }
 
-static int image_convert_1(
-    uint8_t     *arg_src[MAX_IMAGE_PLANES],
-    int          arg_src_stride[MAX_IMAGE_PLANES],
-    unsigned int src_width,
-    unsigned int src_height,
-    uint32_t     src_fourcc,
-    uint8_t     *arg_dst[MAX_IMAGE_PLANES],
-    int          arg_dst_stride[MAX_IMAGE_PLANES],
-    unsigned int dst_width,
-    unsigned int dst_height,
-    uint32_t     dst_fourcc
-)
+/* Component (Y, U, V, A) held in each byte of an AYUV pixel */
+static const uint8_t ayuv_order[4] =
+#ifdef WORDS_BIGENDIAN
+    { 3, 0, 1, 2 };
+#else
+    { 2, 1, 0, 3 };
+#endif
+
+/* Fills in the component (R, G, B, A) held in each byte of an RGB32 pixel */
+static int get_RGB32_order(uint32_t fourcc, uint8_t order[4])
 {
-    if (src_fourcc == dst_fourcc &&
-        src_width  == dst_width  &&
-        src_height == dst_height) {
-        switch (src_fourcc) {
-        case IMAGE_NV12:
-            return image_copy_NV12(
-                arg_src, arg_src_stride,
-                arg_dst, arg_dst_stride,
-                src_width, src_height
-            );
-        case IMAGE_ARGB:
-        case IMAGE_BGRA:
-        case IMAGE_RGBA:
-        case IMAGE_ABGR:
-            return image_copy_RGB32(
-                arg_src[0], arg_src_stride[0],
-                arg_dst[0], arg_dst_stride[0],
-                src_width, src_height
-            );
-        }
+    switch (fourcc) {
+    case IMAGE_ARGB: order[0] = 3; order[1] = 0; order[2] = 1; order[3] = 2; break;
+    case IMAGE_BGRA: order[0] = 2; order[1] = 1; order[2] = 0; order[3] = 3; break;
+    case IMAGE_RGBA: order[0] = 0; order[1] = 1; order[2] = 2; order[3] = 3; break;
+    case IMAGE_ABGR: order[0] = 3; order[1] = 2; order[2] = 1; order[3] = 0; break;
+    default:
+        return -1;
     }
+    return 0;
+}
 
-    /* libswscale < 0.10.0 has bugs in ARGB -> RGBA conversion */
-    if (src_fourcc == IMAGE_RGB32 &&
-        src_width  == dst_width   &&
-        src_height == dst_height) {
-        switch (dst_fourcc) {
-        case IMAGE_ARGB:
-            return image_convert_RGB32_to_ARGB(
-                arg_src[0], arg_src_stride[0],
-                arg_dst[0], arg_dst_stride[0],
-                src_width, src_height
-            );
-        case IMAGE_BGRA:
-            return image_convert_RGB32_to_BGRA(
-                arg_src[0], arg_src_stride[0],
-                arg_dst[0], arg_dst_stride[0],
-                src_width, src_height
-            );
-        case IMAGE_RGBA:
-            return image_convert_RGB32_to_RGBA(
-                arg_src[0], arg_src_stride[0],
-                arg_dst[0], arg_dst_stride[0],
-                src_width, src_height
-            );
-        case IMAGE_ABGR:
-            return image_convert_RGB32_to_ABGR(
-                arg_src[0], arg_src_stride[0],
-                arg_dst[0], arg_dst_stride[0],
-                src_width, src_height
-            );
-        }
-    }
+/* Returns the luma weights of R and B for the selected color standard */
+static void get_color_matrix(double *kr, double *kb)
+{
+    switch (common_get_context()->color_matrix) {
+    case COLOR_MATRIX_BT709:
+        *kr = 0.2126;
+        *kb = 0.0722;
+        break;
+    default:
+        *kr = 0.299;
+        *kb = 0.114;
+        break;
+    }
+}
+
+/* Fills in the fixed-point coefficients for the selected color standard */
+static void image_get_YUV_coefs(ImageYUVCoefs *coefs)
+{
+    const CommonContext * const common = common_get_context();
+    const double scale = 1 << IMAGE_YUV_COEF_BITS;
+    double kr, kb, kg, y_scale, c_scale;
+
+    get_color_matrix(&kr, &kb);
+    kg = 1.0 - kr - kb;
+
+    if (common->color_range == COLOR_RANGE_FULL) {
+        coefs->y_offset = 0;
+        y_scale = 1.0;
+        c_scale = 1.0;
+    }
+    else {
+        coefs->y_offset = 16;
+        y_scale = 255.0 / 219.0;
+        c_scale = 255.0 / 224.0;
+    }
+
+    coefs->y_coef  = (int)(y_scale * scale + 0.5);
+    coefs->rv_coef = (int)(2.0 * (1.0 - kr) * c_scale * scale + 0.5);
+    coefs->gu_coef = (int)(2.0 * kb * (1.0 - kb) / kg * c_scale * scale + 0.5);
+    coefs->gv_coef = (int)(2.0 * kr * (1.0 - kr) / kg * c_scale * scale + 0.5);
+    coefs->bu_coef = (int)(2.0 * (1.0 - kb) * c_scale * scale + 0.5);
+}
+
+/* Fills in the fixed-point coefficients for converting RGB32 pixels,
+   whose bytes hold the components given by order[], to YUV */
+static void image_get_RGB_coefs(ImageRGBCoefs *coefs, const uint8_t order[4])
+{
+    const CommonContext * const common = common_get_context();
+    const double scale = 1 << IMAGE_RGB_COEF_BITS;
+    double kr, kb, y_scale, c_scale;
+    int y[3], u[3], v[3], y_sum;
+    unsigned int i;
+
+    get_color_matrix(&kr, &kb);
+
+    if (common->color_range == COLOR_RANGE_FULL) {
+        coefs->y_offset = 0;
+        y_scale = 1.0;
+        c_scale = 1.0;
+    }
+    else {
+        coefs->y_offset = 16;
+        y_scale = 219.0 / 255.0;
+        c_scale = 224.0 / 255.0;
+    }
+
+#define ROUND(x) ((int)floor((x) * scale + 0.5))
+    y[0] =  ROUND(kr * y_scale);
+    y[2] =  ROUND(kb * y_scale);
+    y_sum = ROUND(y_scale);
+    u[0] = -ROUND(kr / (2.0 * (1.0 - kb)) * c_scale);
+    u[2] =  ROUND(0.5 * c_scale);
+    v[0] =  ROUND(0.5 * c_scale);
+    v[2] = -ROUND(kb / (2.0 * (1.0 - kr)) * c_scale);
+#undef ROUND
+
+    /* Make grays map to neutral chroma and white to the nominal peak */
+    y[1] = y_sum - y[0] - y[2];
+    u[1] = -u[0] - u[2];
+    v[1] = -v[0] - v[2];
+
+    coefs->a_index = 0;
+    for (i = 0; i < 4; i++) {
+        const unsigned int c = order[i];
+        coefs->y_coefs[i] = c < 3 ? y[c] : 0;
+        coefs->u_coefs[i] = c < 3 ? u[c] : 0;
+        coefs->v_coefs[i] = c < 3 ? v[c] : 0;
+        if (c == 3)
+            coefs->a_index = i;
+    }
+}
+
+static int image_convert_YUV420_to_RGB32(
+    uint8_t     *src[MAX_IMAGE_PLANES],
+    int          src_stride[MAX_IMAGE_PLANES],
+    uint32_t     src_fourcc,
+    uint8_t     *dst,
+    unsigned int dst_stride,
+    uint32_t     dst_fourcc,
+    unsigned int width,
+    unsigned int height
+)
+{
+    ImageYUVCoefs coefs;
+    const uint8_t *u_src, *v_src;
+    unsigned int uv_stride, uv_step;
+    uint8_t order[4];
+
+    switch (src_fourcc) {
+    case IMAGE_NV12:
+        u_src     = src[1];
+        v_src     = src[1] + 1;
+        uv_stride = src_stride[1];
+        uv_step   = 2;
+        break;
+    case IMAGE_YV12:
+        u_src     = src[2];
+        v_src     = src[1];
+        uv_stride = src_stride[1];
+        uv_step   = 1;
+        break;
+    case IMAGE_IYUV:
+    case IMAGE_I420:
+        u_src     = src[1];
+        v_src     = src[2];
+        uv_stride = src_stride[1];
+        uv_step   = 1;
+        break;
+    default:
+        return -1;
+    }
+
+    if (get_RGB32_order(dst_fourcc, order) < 0)
+        return -1;
+
+    image_get_YUV_coefs(&coefs);
+    image_YUV420_to_RGB32(
+        src[0], src_stride[0],
+        u_src, v_src, uv_stride, uv_step,
+        dst, dst_stride,
+        width, height,
+        &coefs, order
+    );
+    return 0;
+}
+
+static int image_convert_RGB32_to_AYUV(
+    uint8_t     *src,
+    unsigned int src_stride,
+    uint32_t     src_fourcc,
+    uint8_t     *dst,
+    unsigned int dst_stride,
+    unsigned int width,
+    unsigned int height
+)
+{
+    ImageRGBCoefs coefs;
+    uint8_t order[4];
+
+    if (get_RGB32_order(src_fourcc, order) < 0)
+        return -1;
+
+    image_get_RGB_coefs(&coefs, order);
+    image_RGB32_to_AYUV(
+        src, src_stride,
+        dst, dst_stride,
+        width, height,
+        &coefs, ayuv_order
+    );
+    return 0;
+}
+
+static int image_convert_AYUV_to_RGB32(
+    uint8_t     *src,
+    unsigned int src_stride,
+    uint8_t     *dst,
+    unsigned int dst_stride,
+    uint32_t     dst_fourcc,
+    unsigned int width,
+    unsigned int height
+)
+{
+    ImageYUVCoefs coefs;
+    uint8_t order[4], pos[4];
+    unsigned int x, y;
+
+    if (get_RGB32_order(dst_fourcc, order) < 0)
+        return -1;
+
+    image_get_YUV_coefs(&coefs);
+    image_invert_order(ayuv_order, pos);
+    for (y = 0; y < height; y++, src += src_stride, dst += dst_stride) {
+        for (x = 0; x < width; x++) {
+            const uint8_t * const s = src + 4 * x;
+            image_YUV_to_RGB32_pixel(s[pos[0]], s[pos[1]], s[pos[2]],
+                                     &coefs, order, dst + 4 * x);
+        }
+    }
+    return 0;
+}
+
+static int image_convert_NV12_to_AYUV(
+    uint8_t     *src[MAX_IMAGE_PLANES],
+    int          src_stride[MAX_IMAGE_PLANES],
+    uint8_t     *dst,
+    unsigned int dst_stride,
+    unsigned int width,
+    unsigned int height
+)
+{
+    uint8_t *u, *v;
+    unsigned int x, y;
+
+    u = scratch_get(2 * width);
+    if (!u)
+        return -1;
+    v = u + width;
+
+    /* Expand each chroma row once and pack it with two luma rows */
+    for (y = 0; y < height; y += 2) {
+        const uint8_t * const uv = src[1] + (y / 2) * src_stride[1];
+        for (x = 0; x < width; x++) {
+            u[x] = uv[x & ~1];
+            v[x] = uv[x | 1];
+        }
+        image_YUV444P_to_AYUV(
+            src[0] + y * src_stride[0], src_stride[0],
+            u, v, 0,
+            dst + y * dst_stride, dst_stride,
+            width, MIN(2, height - y),
+            ayuv_order
+        );
+    }
+    return 0;
+}
+
+static int image_convert_AYUV_to_NV12(
+    uint8_t     *src,
+    unsigned int src_stride,
+    uint8_t     *dst[MAX_IMAGE_PLANES],
+    int          dst_stride[MAX_IMAGE_PLANES],
+    unsigned int width,
+    unsigned int height
+)
+{
+    uint8_t *u, *v;
+    unsigned int x, y;
+
+    u = scratch_get(4 * width);
+    if (!u)
+        return -1;
+    v = u + 2 * width;
+
+    /* Unpack two rows, luma straight into place, then average 2x2
+       chroma blocks */
+    for (y = 0; y < height; y += 2) {
+        const unsigned int rows = MIN(2, height - y);
+        uint8_t * const uv = dst[1] + (y / 2) * dst_stride[1];
+
+        image_AYUV_to_YUV444P(
+            src + y * src_stride, src_stride,
+            dst[0] + y * dst_stride[0], dst_stride[0],
+            u, v, width,
+            width, rows,
+            ayuv_order
+        );
+        if (rows == 1) {
+            memcpy(u + width, u, width);
+            memcpy(v + width, v, width);
+        }
+        for (x = 0; x < width; x += 2) {
+            const unsigned int x1 = MIN(x + 1, width - 1);
+            uv[x + 0] = (u[x] + u[x1] + u[width + x] + u[width + x1] + 2) >> 2;
+            uv[x + 1] = (v[x] + v[x1] + v[width + x] + v[width + x1] + 2) >> 2;
+        }
+    }
+    return 0;
+}
+
+#if HAVE_SWSCALE
+static enum PixelFormat get_pixel_format(uint32_t fourcc)
+{
+    switch (fourcc) {
+    case FOURCC('N','V','1','2'): return PIX_FMT_NV12;
+    case FOURCC('I','Y','U','V'): /* duplicate of */
+    case FOURCC('I','4','2','0'): return PIX_FMT_YUV420P;
+    case FOURCC('U','Y','V','Y'): return PIX_FMT_UYVY422;
+    case FOURCC('Y','U','Y','2'): /* duplicate of */
+    case FOURCC('Y','U','Y','V'): return PIX_FMT_YUYV422;
+    case IMAGE_ARGB: return PIX_FMT_ARGB;
+    case IMAGE_BGRA: return PIX_FMT_BGRA;
+    case IMAGE_RGBA: return PIX_FMT_RGBA;
+    case IMAGE_ABGR: return PIX_FMT_ABGR;
+    }
+    return PIX_FMT_NONE;
+}
+#endif
+
+#if HAVE_SWSCALE
+/* Small LRU cache of SwsContext objects, so that steady-state
+   conversions don't rebuild the filter tables for every frame */
+#define SWS_CACHE_SIZE 4
+
+typedef struct _SwsCacheEntry SwsCacheEntry;
+
+struct _SwsCacheEntry {
+    struct SwsContext  *sws;
+    unsigned int        src_width;
+    unsigned int        src_height;
+    enum PixelFormat    src_pix_fmt;
+    unsigned int        dst_width;
+    unsigned int        dst_height;
+    enum PixelFormat    dst_pix_fmt;
+    int                 flags;
+    uint64_t            last_use;
+};
+
+static struct {
+    SwsCacheEntry       entries[SWS_CACHE_SIZE];
+    uint64_t            tick;
+    unsigned int        hits;
+    unsigned int        misses;
+    uint64_t            build_time;
+} g_sws_cache;
+
+static struct SwsContext *
+sws_cache_get(
+    unsigned int        src_width,
+    unsigned int        src_height,
+    enum PixelFormat    src_pix_fmt,
+    unsigned int        dst_width,
+    unsigned int        dst_height,
+    enum PixelFormat    dst_pix_fmt,
+    int                 flags
+)
+{
+    SwsCacheEntry *e, *lru = NULL;
+    uint64_t start;
+    unsigned int i;
+
+    for (i = 0; i < SWS_CACHE_SIZE; i++) {
+        e = &g_sws_cache.entries[i];
+        if (e->sws                         &&
+            e->src_width   == src_width    &&
+            e->src_height  == src_height   &&
+            e->src_pix_fmt == src_pix_fmt  &&
+            e->dst_width   == dst_width    &&
+            e->dst_height  == dst_height   &&
+            e->dst_pix_fmt == dst_pix_fmt  &&
+            e->flags       == flags) {
+            e->last_use = ++g_sws_cache.tick;
+            g_sws_cache.hits++;
+            return e->sws;
+        }
+        if (!lru || !e->sws || (lru->sws && e->last_use < lru->last_use))
+            lru = e;
+    }
+
+    if (lru->sws) {
+        sws_freeContext(lru->sws);
+        lru->sws = NULL;
+    }
+
+    start = get_ticks_usec();
+    lru->sws = sws_getContext(src_width, src_height, src_pix_fmt,
+                              dst_width, dst_height, dst_pix_fmt,
+                              flags, NULL, NULL, NULL);
+    if (!lru->sws)
+        return NULL;
+    g_sws_cache.build_time += get_ticks_usec() - start;
+    g_sws_cache.misses++;
+
+    lru->src_width   = src_width;
+    lru->src_height  = src_height;
+    lru->src_pix_fmt = src_pix_fmt;
+    lru->dst_width   = dst_width;
+    lru->dst_height  = dst_height;
+    lru->dst_pix_fmt = dst_pix_fmt;
+    lru->flags       = flags;
+    lru->last_use    = ++g_sws_cache.tick;
+    D(bug("swscale cache miss: %ux%u -> %ux%u (%u hits, %u misses, %llu usec)\n",
+          src_width, src_height, dst_width, dst_height,
+          g_sws_cache.hits, g_sws_cache.misses,
+          (unsigned long long)g_sws_cache.build_time));
+    return lru->sws;
+}
+
+static void sws_cache_exit(void)
+{
+    unsigned int i;
+
+    D(bug("swscale cache: %u hits, %u misses, %llu usec spent in sws_getContext()\n",
+          g_sws_cache.hits, g_sws_cache.misses,
+          (unsigned long long)g_sws_cache.build_time));
+
+    for (i = 0; i < SWS_CACHE_SIZE; i++) {
+        SwsCacheEntry * const e = &g_sws_cache.entries[i];
+        if (e->sws) {
+            sws_freeContext(e->sws);
+            e->sws = NULL;
+        }
+    }
+}
+
+static int image_convert_libswscale(
+    uint8_t     *arg_src[MAX_IMAGE_PLANES],
+    int          arg_src_stride[MAX_IMAGE_PLANES],
+    unsigned int src_width,
+    unsigned int src_height,
+    uint32_t     src_fourcc,
+    uint8_t     *arg_dst[MAX_IMAGE_PLANES],
+    int          arg_dst_stride[MAX_IMAGE_PLANES],
+    unsigned int dst_width,
+    unsigned int dst_height,
+    uint32_t     dst_fourcc
+)
+{
+    int error = -1;
+    struct SwsContext *sws = NULL;
+    enum PixelFormat src_pix_fmt, dst_pix_fmt;
+    uint8_t *src[MAX_IMAGE_PLANES];
+    uint8_t *dst[MAX_IMAGE_PLANES];
+    int src_stride[MAX_IMAGE_PLANES];
+    int dst_stride[MAX_IMAGE_PLANES];
+    unsigned int tmp_size = 0;
+    uint8_t *tmp = NULL;
+    int i;
+
+    /* XXX: libswscale does not support AYUV formats yet, so they go
+       through YUV444P planes allocated from the scratch buffer */
+    if (src_fourcc == IMAGE_AYUV)
+        tmp_size += 3 * src_width * src_height;
+    if (dst_fourcc == IMAGE_AYUV)
+        tmp_size += 3 * dst_width * dst_height;
+    if (tmp_size > 0) {
+        tmp = scratch_get(tmp_size);
+        if (!tmp)
+            goto end;
+    }
+
+    switch (src_fourcc) {
+    case IMAGE_AYUV:
+        src_pix_fmt = PIX_FMT_YUV444P;
+        for (i = 0; i < 3; i++) {
+            src[i] = tmp;
+            src_stride[i] = src_width;
+            tmp += src_width * src_height;
+        }
+        image_AYUV_to_YUV444P(
+            arg_src[0], arg_src_stride[0],
+            src[0], src_stride[0],
+            src[1], src[2], src_stride[1],
+            src_width, src_height,
+            ayuv_order
+        );
+        break;
+    case IMAGE_YV12:
+        src_pix_fmt = PIX_FMT_YUV420P;
+        src[0] = arg_src[0];
+        src_stride[0] = arg_src_stride[0];
+        src[1] = arg_src[2];
+        src_stride[1] = arg_src_stride[2];
+        src[2] = arg_src[1];
+        src_stride[2] = arg_src_stride[1];
+        break;
+    default:
+        src_pix_fmt = get_pixel_format(src_fourcc);
+        for (i = 0; i < MAX_IMAGE_PLANES; i++) {
+            src[i] = arg_src[i];
+            src_stride[i] = arg_src_stride[i];
+        }
+        break;
+    }
+
+    switch (dst_fourcc) {
+    case IMAGE_AYUV:
+        dst_pix_fmt = PIX_FMT_YUV444P;
+        for (i = 0; i < 3; i++) {
+            dst[i] = tmp;
+            dst_stride[i] = dst_width;
+            tmp += dst_width * dst_height;
+        }
+        break;
+    case IMAGE_YV12:
+        dst_pix_fmt = PIX_FMT_YUV420P;
+        dst[0] = arg_dst[0];
+        dst_stride[0] = arg_dst_stride[0];
+        dst[1] = arg_dst[2];
+        dst_stride[1] = arg_dst_stride[2];
+        dst[2] = arg_dst[1];
+        dst_stride[2] = arg_dst_stride[1];
+        break;
+    default:
+        dst_pix_fmt = get_pixel_format(dst_fourcc);
+        for (i = 0; i < MAX_IMAGE_PLANES; i++) {
+            dst[i] = arg_dst[i];
+            dst_stride[i] = arg_dst_stride[i];
+        }
+        break;
+    }
+
+    if (src_pix_fmt == PIX_FMT_NONE || dst_pix_fmt == PIX_FMT_NONE)
+        goto end;
+
+    sws = sws_cache_get(src_width, src_height, src_pix_fmt,
+                        dst_width, dst_height, dst_pix_fmt,
+                        SWS_BICUBIC);
+    if (!sws)
+        goto end;
+
+    sws_scale(sws, src, src_stride, 0, src_height, dst, dst_stride);
+
+    if (dst_fourcc == IMAGE_AYUV)
+        image_YUV444P_to_AYUV(
+            dst[0], dst_stride[0],
+            dst[1], dst[2], dst_stride[1],
+            arg_dst[0], arg_dst_stride[0],
+            dst_width, dst_height,
+            ayuv_order
+        );
+
+    error = 0;
+end:
+    return error;
+}
+#endif
+
+static int image_convert_1(
+    uint8_t     *arg_src[MAX_IMAGE_PLANES],
+    int          arg_src_stride[MAX_IMAGE_PLANES],
+    unsigned int src_width,
+    unsigned int src_height,
+    uint32_t     src_fourcc,
+    uint8_t     *arg_dst[MAX_IMAGE_PLANES],
+    int          arg_dst_stride[MAX_IMAGE_PLANES],
+    unsigned int dst_width,
+    unsigned int dst_height,
+    uint32_t     dst_fourcc
+)
+{
+    if (src_fourcc == dst_fourcc &&
+        src_width  == dst_width  &&
+        src_height == dst_height) {
+        switch (src_fourcc) {
+        case IMAGE_NV12:
+            return image_copy_NV12(
+                arg_src, arg_src_stride,
+                arg_dst, arg_dst_stride,
+                src_width, src_height
+            );
+        case IMAGE_ARGB:
+        case IMAGE_BGRA:
+        case IMAGE_RGBA:
+        case IMAGE_ABGR:
+            return image_copy_RGB32(
+                arg_src[0], arg_src_stride[0],
+                arg_dst[0], arg_dst_stride[0],
+                src_width, src_height
+            );
+        }
+    }
+
+    /* libswscale < 0.10.0 has bugs in ARGB -> RGBA conversion */
+    if (src_fourcc == IMAGE_RGB32 &&
+        src_width  == dst_width   &&
+        src_height == dst_height) {
+        switch (dst_fourcc) {
+        case IMAGE_ARGB:
+            return image_convert_RGB32_to_ARGB(
+                arg_src[0], arg_src_stride[0],
+                arg_dst[0], arg_dst_stride[0],
+                src_width, src_height
+            );
+        case IMAGE_BGRA:
+            return image_convert_RGB32_to_BGRA(
+                arg_src[0], arg_src_stride[0],
+                arg_dst[0], arg_dst_stride[0],
+                src_width, src_height
+            );
+        case IMAGE_RGBA:
+            return image_convert_RGB32_to_RGBA(
+                arg_src[0], arg_src_stride[0],
+                arg_dst[0], arg_dst_stride[0],
+                src_width, src_height
+            );
+        case IMAGE_ABGR:
+            return image_convert_RGB32_to_ABGR(
+                arg_src[0], arg_src_stride[0],
+                arg_dst[0], arg_dst_stride[0],
+                src_width, src_height
+            );
+        }
+    }
+
+    if (src_width  == dst_width &&
+        src_height == dst_height) {
+        if (dst_fourcc == IMAGE_AYUV) {
+            if (IS_RGB_IMAGE_FORMAT(src_fourcc))
+                return image_convert_RGB32_to_AYUV(
+                    arg_src[0], arg_src_stride[0], src_fourcc,
+                    arg_dst[0], arg_dst_stride[0],
+                    src_width, src_height
+                );
+            if (src_fourcc == IMAGE_NV12)
+                return image_convert_NV12_to_AYUV(
+                    arg_src, arg_src_stride,
+                    arg_dst[0], arg_dst_stride[0],
+                    src_width, src_height
+                );
+        }
+        if (src_fourcc == IMAGE_AYUV) {
+            if (IS_RGB_IMAGE_FORMAT(dst_fourcc))
+                return image_convert_AYUV_to_RGB32(
+                    arg_src[0], arg_src_stride[0],
+                    arg_dst[0], arg_dst_stride[0], dst_fourcc,
+                    src_width, src_height
+                );
+            if (dst_fourcc == IMAGE_NV12)
+                return image_convert_AYUV_to_NV12(
+                    arg_src[0], arg_src_stride[0],
+                    arg_dst, arg_dst_stride,
+                    src_width, src_height
+                );
+        }
+    }
+
+    if (IS_RGB_IMAGE_FORMAT(dst_fourcc) &&
+        src_width  == dst_width         &&
+        src_height == dst_height) {
+        switch (src_fourcc) {
+        case IMAGE_NV12:
+        case IMAGE_YV12:
+        case IMAGE_IYUV:
+        case IMAGE_I420:
+            return image_convert_YUV420_to_RGB32(
+                arg_src, arg_src_stride, src_fourcc,
+                arg_dst[0], arg_dst_stride[0], dst_fourcc,
+                src_width, src_height
+            );
+        }
+    }
+
+#if HAVE_SWSCALE
+    return image_convert_libswscale(
+        arg_src, arg_src_stride,
+        src_width, src_height, src_fourcc,
+        arg_dst, arg_dst_stride,
+        dst_width, dst_height, dst_fourcc
+    );
+#endif
+    return -1;
+}
+
+static inline int
+image_get_parts(
+    Image   *img,
+    uint8_t *pixels[MAX_IMAGE_PLANES],
+    int      stride[MAX_IMAGE_PLANES]
+)
+{
+    unsigned int i;
+
+    if (img->data && img->data_size) {
+        /* Genuine image created with image_create() */
+        for (i = 0; i < img->num_planes; i++) {
+            pixels[i] = img->data + img->offsets[i];
+            stride[i] = img->pitches[i];
+        }
+    }
+    else {
+        /* Image is probably "bound" from another structure */
+        for (i = 0; i < img->num_planes; i++) {
+            pixels[i] = img->pixels[i];
+            stride[i] = img->pitches[i];
+        }
+    }
+
+    for (; i < MAX_IMAGE_PLANES; i++) {
+        pixels[i] = NULL;
+        stride[i] = 0;
+    }
+    return 0;
+}
+
+int image_view(
+    Image       *view,
+    Image       *parent,
+    unsigned int x,
+    unsigned int y,
+    unsigned int width,
+    unsigned int height
+)
+{
+    uint8_t *pixels[MAX_IMAGE_PLANES];
+    int stride[MAX_IMAGE_PLANES];
+    unsigned int i, bpp[MAX_IMAGE_PLANES], x_shift, y_shift;
+
+    if (x > parent->width  || width  > parent->width  - x ||
+        y > parent->height || height > parent->height - y ||
+        !width || !height)
+        return -1;
+
+    /* Subsampled formats need the rectangle to start on a chroma sample */
+    switch (parent->format) {
+    case IMAGE_ARGB:
+    case IMAGE_BGRA:
+    case IMAGE_RGBA:
+    case IMAGE_ABGR:
+    case IMAGE_AYUV:
+        bpp[0] = 4;
+        x_shift = y_shift = 0;
+        break;
+    case IMAGE_UYVY:
+    case IMAGE_YUY2:
+    case IMAGE_YUYV:
+        if (x & 1)
+            return -1;
+        bpp[0] = 2;
+        x_shift = y_shift = 0;
+        break;
+    case IMAGE_NV12:
+        if ((x | y) & 1)
+            return -1;
+        bpp[0] = 1;
+        bpp[1] = 2;
+        x_shift = y_shift = 1;
+        break;
+    case IMAGE_YV12:
+    case IMAGE_IYUV:
+    case IMAGE_I420:
+        if ((x | y) & 1)
+            return -1;
+        bpp[0] = bpp[1] = bpp[2] = 1;
+        x_shift = y_shift = 1;
+        break;
+    default:
+        return -1;
+    }
+
+    if (image_get_parts(parent, pixels, stride) < 0)
+        return -1;
+
+    memset(view, 0, sizeof(*view));
+    view->format     = parent->format;
+    view->flags      = parent->flags;
+    view->width      = width;
+    view->height     = height;
+    view->num_planes = parent->num_planes;
+    for (i = 0; i < view->num_planes; i++) {
+        const unsigned int px = i > 0 ? x >> x_shift : x;
+        const unsigned int py = i > 0 ? y >> y_shift : y;
+        view->pixels[i]  = pixels[i] + py * stride[i] + px * bpp[i];
+        view->pitches[i] = stride[i];
+    }
+    return 0;
+}
+
+/* Returns TRUE if image_convert_1() has a native path for a same-size
+   conversion, i.e. one that works on independent rows */
+static int image_has_native_path(uint32_t src_fourcc, uint32_t dst_fourcc)
+{
+    if (src_fourcc == dst_fourcc)
+        return src_fourcc == IMAGE_NV12 || IS_RGB_IMAGE_FORMAT(src_fourcc);
+
+    if (IS_RGB_IMAGE_FORMAT(dst_fourcc)) {
+        switch (src_fourcc) {
+        case IMAGE_RGB32:
+        case IMAGE_AYUV:
+        case IMAGE_NV12:
+        case IMAGE_YV12:
+        case IMAGE_IYUV:
+        case IMAGE_I420:
+            return 1;
+        }
+        return 0;
+    }
+    if (dst_fourcc == IMAGE_AYUV)
+        return IS_RGB_IMAGE_FORMAT(src_fourcc) || src_fourcc == IMAGE_NV12;
+    if (dst_fourcc == IMAGE_NV12)
+        return src_fourcc == IMAGE_AYUV;
+    return 0;
+}
+
+/* Returns the row of PLANE holding the samples of image row Y */
+static inline unsigned int
+get_plane_row(uint32_t fourcc, unsigned int plane, unsigned int y)
+{
+    switch (fourcc) {
+    case IMAGE_NV12:
+    case IMAGE_YV12:
+    case IMAGE_IYUV:
+    case IMAGE_I420:
+        return plane > 0 ? y / 2 : y;
+    }
+    return y;
+}
+
+/* Returns the number of PLANE samples covering N image rows or columns */
+static inline unsigned int
+get_plane_size(uint32_t fourcc, unsigned int plane, unsigned int n)
+{
+    return get_plane_row(fourcc, plane, n - 1) + 1;
+}
+
+/* Returns the size in bytes of a row of PLANE, or 0 if there is none */
+static unsigned int
+get_plane_row_bytes(uint32_t fourcc, unsigned int plane, unsigned int width)
+{
+    switch (fourcc) {
+    case IMAGE_ARGB:
+    case IMAGE_BGRA:
+    case IMAGE_RGBA:
+    case IMAGE_ABGR:
+    case IMAGE_AYUV:
+        return plane == 0 ? 4 * width : 0;
+    case IMAGE_UYVY:
+    case IMAGE_YUY2:
+    case IMAGE_YUYV:
+        return plane == 0 ? 4 * ((width + 1) / 2) : 0;
+    case IMAGE_NV12:
+        return plane < 2 ? (plane == 0 ? width : 2 * ((width + 1) / 2)) : 0;
+    case IMAGE_YV12:
+    case IMAGE_IYUV:
+    case IMAGE_I420:
+        return plane < 3 ? get_plane_size(fourcc, plane, width) : 0;
+    }
+    return 0;
+}
+
+/* Reads from uncached memory go through a cached bounce buffer: streaming
+   loads fill it a chunk at a time, then regular copies drain it */
+#define STREAM_BOUNCE_SIZE      4096
+
+static void
+image_copy_uncached(Image *dst_img, Image *src_img)
+{
+    uint8_t bounce[STREAM_BOUNCE_SIZE] __attribute__((__aligned__(64)));
+    uint8_t *src[MAX_IMAGE_PLANES], *dst[MAX_IMAGE_PLANES];
+    int src_stride[MAX_IMAGE_PLANES], dst_stride[MAX_IMAGE_PLANES];
+    unsigned int i, x, y, n, row_bytes, height;
+
+    image_get_parts(src_img, src, src_stride);
+    image_get_parts(dst_img, dst, dst_stride);
+
+    for (i = 0; (row_bytes = get_plane_row_bytes(src_img->format, i,
+                                                 src_img->width)) != 0; i++) {
+        height = get_plane_size(src_img->format, i, src_img->height);
+        for (y = 0; y < height; y++) {
+            for (x = 0; x < row_bytes; x += n) {
+                n = MIN(row_bytes - x, STREAM_BOUNCE_SIZE);
+                image_stream_load(bounce, src[i] + x, n);
+                memcpy(dst[i] + x, bounce, n);
+            }
+            src[i] += src_stride[i];
+            dst[i] += dst_stride[i];
+        }
+    }
+}
+
+/* Returns a cached copy of an uncached image, or NULL if the image is
+   better read directly, e.g. if streaming loads are not available */
+static Image *image_get_cached_copy(Image *img)
+{
+    Image *cached_img;
+
+    if (!(img->flags & IMAGE_FLAG_UNCACHED) ||
+        image_stream_load == image_stream_load_c)
+        return NULL;
+
+    cached_img = image_create(img->width, img->height, img->format);
+    if (cached_img)
+        image_copy_uncached(cached_img, img);
+    return cached_img;
+}
+
+int image_hash(Image *img, enum HashType type, uint64_t hashes[MAX_IMAGE_PLANES])
+{
+    uint8_t bounce[STREAM_BOUNCE_SIZE] __attribute__((__aligned__(64)));
+    uint8_t *src[MAX_IMAGE_PLANES];
+    int src_stride[MAX_IMAGE_PLANES];
+    unsigned int i, x, y, n, row_bytes, height;
+    HashContext ctx;
+    int use_stream_load;
+
+    image_init_kernels();
+
+    if (!get_plane_row_bytes(img->format, 0, img->width))
+        return -1;
+
+    /* Hash uncached memory out of the bounce buffer, a chunk at a time */
+    use_stream_load = ((img->flags & IMAGE_FLAG_UNCACHED) &&
+                       image_stream_load != image_stream_load_c);
+
+    image_get_parts(img, src, src_stride);
+
+    for (i = 0; (row_bytes = get_plane_row_bytes(img->format, i,
+                                                 img->width)) != 0; i++) {
+        hash_init(&ctx, type);
+        height = get_plane_size(img->format, i, img->height);
+        for (y = 0; y < height; y++, src[i] += src_stride[i]) {
+            if (!use_stream_load) {
+                hash_update(&ctx, src[i], row_bytes);
+                continue;
+            }
+            for (x = 0; x < row_bytes; x += n) {
+                n = MIN(row_bytes - x, STREAM_BOUNCE_SIZE);
+                image_stream_load(bounce, src[i] + x, n);
+                hash_update(&ctx, bounce, n);
+            }
+        }
+        hashes[i] = hash_final(&ctx);
+    }
+    return i;
+}
+
+/* Conversions are split into bands of at least MIN_BAND_HEIGHT rows,
+   only for images larger than MIN_PARALLEL_PIXELS */
+#define MIN_BAND_HEIGHT         16
+#define MIN_PARALLEL_PIXELS     (256 * 256)
+#define MAX_BANDS               128
+
+typedef struct _ConvertBands ConvertBands;
+
+struct _ConvertBands {
+    uint8_t            *src[MAX_IMAGE_PLANES];
+    int                 src_stride[MAX_IMAGE_PLANES];
+    uint32_t            src_fourcc;
+    uint8_t            *dst[MAX_IMAGE_PLANES];
+    int                 dst_stride[MAX_IMAGE_PLANES];
+    uint32_t            dst_fourcc;
+    unsigned int        width;
+    unsigned int        height;
+    unsigned int        band_height;
+    int                 status[MAX_BANDS];
+};
+
+static void image_convert_band(void *data, unsigned int index)
+{
+    ConvertBands * const bands = data;
+    const unsigned int y = index * bands->band_height;
+    const unsigned int height = MIN(bands->band_height, bands->height - y);
+    uint8_t *src[MAX_IMAGE_PLANES];
+    uint8_t *dst[MAX_IMAGE_PLANES];
+    unsigned int i;
+
+    for (i = 0; i < MAX_IMAGE_PLANES; i++) {
+        src[i] = bands->src[i];
+        if (src[i])
+            src[i] += get_plane_row(bands->src_fourcc, i, y) * bands->src_stride[i];
+        dst[i] = bands->dst[i];
+        if (dst[i])
+            dst[i] += get_plane_row(bands->dst_fourcc, i, y) * bands->dst_stride[i];
+    }
 
-#if HAVE_SWSCALE
-    return image_convert_libswscale(
-        arg_src, arg_src_stride,
-        src_width, src_height, src_fourcc,
-        arg_dst, arg_dst_stride,
-        dst_width, dst_height, dst_fourcc
+    bands->status[index] = image_convert_1(
+        src, bands->src_stride,
+        bands->width, height, bands->src_fourcc,
+        dst, bands->dst_stride,
+        bands->width, height, bands->dst_fourcc
     );
-#endif
-    return -1;
 }
 
-static inline int
-image_get_parts(
-    Image   *img,
-    uint8_t *pixels[MAX_IMAGE_PLANES],
-    int      stride[MAX_IMAGE_PLANES]
+/* Splits a same-size conversion into bands run by the thread pool.
+   Bands start on even rows so that 4:2:0 chroma rows are not shared */
+static int image_convert_parallel(
+    uint8_t     *src[MAX_IMAGE_PLANES],
+    int          src_stride[MAX_IMAGE_PLANES],
+    uint32_t     src_fourcc,
+    uint8_t     *dst[MAX_IMAGE_PLANES],
+    int          dst_stride[MAX_IMAGE_PLANES],
+    uint32_t     dst_fourcc,
+    unsigned int width,
+    unsigned int height
 )
 {
-    unsigned int i;
+    ConvertBands bands;
+    unsigned int i, num_bands;
 
-    if (img->data && img->data_size) {
-        /* Genuine image created with image_create() */
-        for (i = 0; i < img->num_planes; i++) {
-            pixels[i] = img->data + img->offsets[i];
-            stride[i] = img->pitches[i];
+    /* Twice as many bands as threads helps balancing the load */
+    num_bands = MIN(2 * thread_pool_get_size(), MAX_BANDS);
+    num_bands = MIN(num_bands, height / MIN_BAND_HEIGHT);
+    if (num_bands < 2)
+        return image_convert_1(src, src_stride, width, height, src_fourcc,
+                               dst, dst_stride, width, height, dst_fourcc);
+
+    for (i = 0; i < MAX_IMAGE_PLANES; i++) {
+        bands.src[i]        = src[i];
+        bands.src_stride[i] = src_stride[i];
+        bands.dst[i]        = dst[i];
+        bands.dst_stride[i] = dst_stride[i];
+    }
+    bands.src_fourcc  = src_fourcc;
+    bands.dst_fourcc  = dst_fourcc;
+    bands.width       = width;
+    bands.height      = height;
+    bands.band_height = (((height + num_bands - 1) / num_bands) + 1) & ~1U;
+    num_bands = (height + bands.band_height - 1) / bands.band_height;
+
+    thread_pool_run(image_convert_band, &bands, num_bands);
+
+    for (i = 0; i < num_bands; i++) {
+        if (bands.status[i] < 0)
+            return -1;
+    }
+    return 0;
+}
+
+/* Returns the size in bytes of the PLANE samples moved around by
+   rotations, or 0 if FOURCC images cannot be rotated directly */
+static unsigned int get_rotate_bpp(uint32_t fourcc, unsigned int plane)
+{
+    switch (fourcc) {
+    case IMAGE_ARGB:
+    case IMAGE_BGRA:
+    case IMAGE_RGBA:
+    case IMAGE_ABGR:
+    case IMAGE_AYUV:
+        return plane == 0 ? 4 : 0;
+    case IMAGE_NV12:
+        return plane < 2 ? plane + 1 : 0;
+    }
+    return 0;
+}
+
+/* Returns TRUE if image_rotate() can write DST_FOURCC images directly */
+static int image_can_rotate(uint32_t src_fourcc, uint32_t dst_fourcc)
+{
+    if (!get_rotate_bpp(dst_fourcc, 0))
+        return 0;
+    return src_fourcc == dst_fourcc ||
+        image_has_native_path(src_fourcc, dst_fourcc);
+}
+
+/* Rotates a WxH plane of bpp-byte samples into the area starting at
+   dst, which is HxW for 90 and 270 degree rotations */
+static void
+image_rotate_plane(
+    const uint8_t     *src,
+    int                src_stride,
+    uint8_t           *dst,
+    int                dst_stride,
+    unsigned int       width,
+    unsigned int       height,
+    unsigned int       bpp,
+    enum ImageRotation rotation
+)
+{
+    image_transpose_func transpose;
+
+    switch (bpp) {
+    case 1:  transpose = image_transpose_8;  break;
+    case 2:  transpose = image_transpose_16; break;
+    default: transpose = image_transpose_32; break;
+    }
+
+    switch (rotation) {
+    case IMAGE_ROTATION_90:
+        transpose(src + (ptrdiff_t)(height - 1) * src_stride, -src_stride,
+                  dst, dst_stride, width, height);
+        break;
+    case IMAGE_ROTATION_180:
+        image_mirror(src, src_stride,
+                     dst + (ptrdiff_t)(height - 1) * dst_stride, -dst_stride,
+                     width, height, bpp);
+        break;
+    case IMAGE_ROTATION_270:
+        transpose(src, src_stride,
+                  dst + (ptrdiff_t)(width - 1) * dst_stride, -dst_stride,
+                  width, height);
+        break;
+    default:
+        break;
+    }
+}
+
+/* Rotations work on strips of source rows that fit in the cache. Each
+   strip is converted to the destination format first, if needed, then
+   rotated so that every destination row it touches receives at least
+   ROTATE_STRIP_BYTES bytes */
+#define ROTATE_STRIP_BYTES      64
+
+typedef struct _RotateStrips RotateStrips;
+
+struct _RotateStrips {
+    uint8_t            *src[MAX_IMAGE_PLANES];
+    int                 src_stride[MAX_IMAGE_PLANES];
+    uint32_t            src_fourcc;
+    uint8_t            *dst[MAX_IMAGE_PLANES];
+    int                 dst_stride[MAX_IMAGE_PLANES];
+    uint32_t            dst_fourcc;
+    unsigned int        width;
+    unsigned int        height;
+    enum ImageRotation  rotation;
+    unsigned int        strip_height;
+    unsigned int        strips_per_job;
+    Image               strip_layout;
+    uint8_t            *strip_buffers;
+    int                 status[MAX_BANDS];
+};
+
+/* Strip buffers of the converting rotations, one per job */
+static uint8_t     *g_rotate_buffer;
+static unsigned int g_rotate_buffer_size;
+
+static int image_rotate_strip(RotateStrips *r, unsigned int index, unsigned int y)
+{
+    const unsigned int height = MIN(r->strip_height, r->height - y);
+    uint8_t *src[MAX_IMAGE_PLANES], *strip[MAX_IMAGE_PLANES];
+    int strip_stride[MAX_IMAGE_PLANES];
+    unsigned int i, bpp, pw, ph, py, ps;
+    uint8_t *dst;
+
+    for (i = 0; i < MAX_IMAGE_PLANES; i++) {
+        src[i] = r->src[i];
+        if (src[i])
+            src[i] += get_plane_row(r->src_fourcc, i, y) * r->src_stride[i];
+        strip[i]        = src[i];
+        strip_stride[i] = r->src_stride[i];
+    }
+
+    if (r->src_fourcc != r->dst_fourcc) {
+        const Image * const layout = &r->strip_layout;
+        uint8_t * const buffer = r->strip_buffers + index * layout->data_size;
+
+        for (i = 0; i < MAX_IMAGE_PLANES; i++) {
+            strip[i]        = i < layout->num_planes ? buffer + layout->offsets[i] : NULL;
+            strip_stride[i] = layout->pitches[i];
         }
+        if (image_convert_1(src, r->src_stride,
+                            r->width, height, r->src_fourcc,
+                            strip, strip_stride,
+                            r->width, height, r->dst_fourcc) < 0)
+            return -1;
     }
-    else {
-        /* Image is probably "bound" from another structure */
-        for (i = 0; i < img->num_planes; i++) {
-            pixels[i] = img->pixels[i];
-            stride[i] = img->pitches[i];
+
+    for (i = 0; (bpp = get_rotate_bpp(r->dst_fourcc, i)) != 0; i++) {
+        pw = get_plane_size(r->dst_fourcc, i, r->width);
+        ph = get_plane_size(r->dst_fourcc, i, r->height);
+        py = get_plane_row(r->dst_fourcc, i, y);
+        ps = get_plane_row(r->dst_fourcc, i, y + height - 1) - py + 1;
+
+        dst = r->dst[i];
+        switch (r->rotation) {
+        case IMAGE_ROTATION_90:
+            dst += (ph - py - ps) * bpp;
+            break;
+        case IMAGE_ROTATION_180:
+            dst += (ph - py - ps) * r->dst_stride[i];
+            break;
+        case IMAGE_ROTATION_270:
+            dst += py * bpp;
+            break;
+        default:
+            break;
         }
+        image_rotate_plane(strip[i], strip_stride[i], dst, r->dst_stride[i],
+                           pw, ps, bpp, r->rotation);
     }
+    return 0;
+}
 
-    for (; i < MAX_IMAGE_PLANES; i++) {
-        pixels[i] = NULL;
-        stride[i] = 0;
+static void image_rotate_job(void *data, unsigned int index)
+{
+    RotateStrips * const r = data;
+    const unsigned int y_end = MIN((index + 1) * r->strips_per_job * r->strip_height,
+                                   r->height);
+    unsigned int y;
+
+    r->status[index] = 0;
+    for (y = index * r->strips_per_job * r->strip_height; y < y_end;
+         y += r->strip_height) {
+        if (image_rotate_strip(r, index, y) < 0) {
+            r->status[index] = -1;
+            break;
+        }
+    }
+}
+
+/* Rotates and converts src_img into dst_img, whose size is the rotated
+   source size, in one pass. image_can_rotate() must be TRUE */
+static int
+image_rotate(Image *dst_img, Image *src_img, enum ImageRotation rotation)
+{
+    RotateStrips r;
+    unsigned int i, num_strips, num_jobs;
+
+    if (image_get_parts(src_img, r.src, r.src_stride) < 0)
+        return -1;
+    if (image_get_parts(dst_img, r.dst, r.dst_stride) < 0)
+        return -1;
+
+    r.src_fourcc   = src_img->format;
+    r.dst_fourcc   = dst_img->format;
+    r.width        = src_img->width;
+    r.height       = src_img->height;
+    r.rotation     = rotation;
+    r.strip_height = ROTATE_STRIP_BYTES / get_rotate_bpp(r.dst_fourcc, 0);
+
+    /* Twice as many jobs as threads helps balancing the load */
+    num_strips = (r.height + r.strip_height - 1) / r.strip_height;
+    num_jobs   = MIN(2 * thread_pool_get_size(), MAX_BANDS);
+    if (thread_pool_get_size() < 2 ||
+        r.width * r.height < MIN_PARALLEL_PIXELS)
+        num_jobs = 1;
+    num_jobs = MIN(num_jobs, num_strips);
+    r.strips_per_job = (num_strips + num_jobs - 1) / num_jobs;
+    num_jobs = (num_strips + r.strips_per_job - 1) / r.strips_per_job;
+
+    r.strip_buffers = NULL;
+    if (r.src_fourcc != r.dst_fourcc) {
+        if (image_init_layout(&r.strip_layout, r.width, r.strip_height,
+                              r.dst_fourcc) < 0)
+            return -1;
+        g_rotate_buffer = fast_realloc(g_rotate_buffer, &g_rotate_buffer_size,
+                                       num_jobs * r.strip_layout.data_size);
+        if (!g_rotate_buffer)
+            return -1;
+        r.strip_buffers = g_rotate_buffer;
+    }
+
+    if (num_jobs > 1)
+        thread_pool_run(image_rotate_job, &r, num_jobs);
+    else
+        image_rotate_job(&r, 0);
+
+    for (i = 0; i < num_jobs; i++) {
+        if (r.status[i] < 0)
+            return -1;
+    }
+    return 0;
+}
+
+int image_convert_rotate(
+    Image             *dst_img,
+    Image             *src_img,
+    enum ImageRotation rotation
+)
+{
+    Image *tmp_img = NULL, *rot_img = NULL, *cached_img;
+    unsigned int width, height;
+    uint32_t format;
+    int error = -1;
+
+    if (rotation == IMAGE_ROTATION_0)
+        return image_convert(dst_img, src_img);
+
+    D(bug("convert %s:%ux%u to %s:%ux%u, rotated by %u degrees\n",
+          string_of_FOURCC(src_img->format), src_img->width, src_img->height,
+          string_of_FOURCC(dst_img->format), dst_img->width, dst_img->height,
+          90 * rotation));
+
+    image_init_kernels();
+
+    cached_img = image_get_cached_copy(src_img);
+    if (cached_img) {
+        error = image_convert_rotate(dst_img, cached_img, rotation);
+        image_destroy(cached_img);
+        return error;
+    }
+
+    width  = src_img->width;
+    height = src_img->height;
+    if (rotation != IMAGE_ROTATION_180) {
+        width  = src_img->height;
+        height = src_img->width;
+    }
+
+    if (dst_img->width == width && dst_img->height == height &&
+        image_can_rotate(src_img->format, dst_img->format))
+        return image_rotate(dst_img, src_img, rotation);
+
+    /* Otherwise, rotate through an intermediate image that image_convert()
+       scales and converts to the destination format afterwards */
+    format = dst_img->format;
+    if (!get_rotate_bpp(format, 0))
+        format = IMAGE_NV12;
+
+    if (!image_can_rotate(src_img->format, format)) {
+        tmp_img = image_create(src_img->width, src_img->height, format);
+        if (!tmp_img)
+            goto end;
+        if (image_convert(tmp_img, src_img) < 0)
+            goto end;
+        src_img = tmp_img;
+    }
+
+    rot_img = image_create(width, height, format);
+    if (!rot_img)
+        goto end;
+    if (image_rotate(rot_img, src_img, rotation) < 0)
+        goto end;
+    if (image_convert(dst_img, rot_img) < 0)
+        goto end;
+    error = 0;
+end:
+    image_destroy(rot_img);
+    image_destroy(tmp_img);
+    return error;
+}
+
+/* Overlays are split into tiles aligned on the destination image. Fully
+   transparent tiles are skipped, so sparse overlays are cheap to blend */
+#define BLEND_TILE_WIDTH        64
+#define BLEND_TILE_HEIGHT       16
+
+/* Region of a destination plane covered by the overlay, along with the
+   premultiplied overlay values and the destination weights for it */
+typedef struct _BlendPlane BlendPlane;
+
+struct _BlendPlane {
+    unsigned int        hshift;         /* log2 of horizontal subsampling */
+    unsigned int        vshift;         /* log2 of vertical subsampling */
+    unsigned int        bps;            /* bytes per sample */
+    unsigned int        x0, x1;         /* covered bytes of each row */
+    unsigned int        y0, y1;         /* covered rows */
+    uint8_t            *src;
+    uint8_t            *k;
+};
+
+typedef struct _BlendOverlay BlendOverlay;
+
+struct _BlendOverlay {
+    BlendPlane          planes[MAX_IMAGE_PLANES];
+    unsigned int        num_planes;
+    unsigned int        u_plane;        /* 0 for NV12 and RGB32 */
+    unsigned int        v_plane;
+    unsigned int        x0, y0, x1, y1; /* target rectangle */
+    unsigned int        tx0, ty0;       /* first tile */
+    unsigned int        tiles_x;
+    unsigned int        tiles_y;
+    uint8_t            *tiles;          /* non-zero if the tile is visible */
+};
+
+static void
+blend_plane_init(
+    BlendPlane  *plane,
+    unsigned int hshift,
+    unsigned int vshift,
+    unsigned int bps
+)
+{
+    plane->hshift = hshift;
+    plane->vshift = vshift;
+    plane->bps    = bps;
+}
+
+/* Fills in the planes layout of the overlay, for the destination format */
+static int blend_overlay_init_planes(BlendOverlay *ovl, uint32_t fourcc)
+{
+    ovl->u_plane = 0;
+    ovl->v_plane = 0;
+
+    switch (fourcc) {
+    case IMAGE_NV12:
+        ovl->num_planes = 2;
+        blend_plane_init(&ovl->planes[0], 0, 0, 1);
+        blend_plane_init(&ovl->planes[1], 1, 1, 2);
+        break;
+    case IMAGE_YV12:
+    case IMAGE_IYUV:
+    case IMAGE_I420:
+        ovl->num_planes = 3;
+        ovl->u_plane    = fourcc == IMAGE_YV12 ? 2 : 1;
+        ovl->v_plane    = fourcc == IMAGE_YV12 ? 1 : 2;
+        blend_plane_init(&ovl->planes[0], 0, 0, 1);
+        blend_plane_init(&ovl->planes[1], 1, 1, 1);
+        blend_plane_init(&ovl->planes[2], 1, 1, 1);
+        break;
+    default:
+        if (!IS_RGB_IMAGE_FORMAT(fourcc))
+            return -1;
+        ovl->num_planes = 1;
+        blend_plane_init(&ovl->planes[0], 0, 0, 4);
+        break;
     }
     return 0;
 }
 
+/* Returns the bytes [*pb0, *pb1) of PLANE covering pixels [x0, x1) */
+static inline void
+blend_plane_get_span(
+    const BlendPlane *plane,
+    unsigned int      x0,
+    unsigned int      x1,
+    unsigned int     *pb0,
+    unsigned int     *pb1
+)
+{
+    const unsigned int round = (1U << plane->hshift) - 1;
+
+    *pb0 = (x0 >> plane->hshift) * plane->bps;
+    *pb1 = ((x1 + round) >> plane->hshift) * plane->bps;
+}
+
+static inline unsigned int blend_scale(unsigned int i, unsigned int n, unsigned int m)
+{
+    /* Nearest sample of the source for target sample i, n to m samples */
+    return (unsigned int)(((2 * (uint64_t)i + 1) * n) / (2 * m));
+}
+
+static void blend_overlay_free(BlendOverlay *ovl)
+{
+    unsigned int i;
+
+    for (i = 0; i < ovl->num_planes; i++)
+        free(ovl->planes[i].src);
+    free(ovl->tiles);
+}
+
+/* Finds the next run [*pt0, *pt1) of visible tiles, starting from tile T */
+static inline int
+blend_next_run(
+    const uint8_t *tiles,
+    unsigned int   num_tiles,
+    unsigned int   t,
+    unsigned int  *pt0,
+    unsigned int  *pt1
+)
+{
+    while (t < num_tiles && !tiles[t])
+        t++;
+    if (t == num_tiles)
+        return 0;
+
+    *pt0 = t;
+    while (t < num_tiles && tiles[t])
+        t++;
+    *pt1 = t;
+    return 1;
+}
+
+/* Resamples the overlay to the target rectangle and premultiplies it by
+   its alpha. Only the tiles with visible pixels are processed */
+static int
+blend_overlay_init(
+    BlendOverlay    *ovl,
+    uint32_t         dst_fourcc,
+    Image           *src_img,
+    const Rectangle *src_rect,
+    const Rectangle *dst_rect,
+    unsigned int     alpha
+)
+{
+    const unsigned int sw = src_rect->width, sh = src_rect->height;
+    const unsigned int dw = dst_rect->width, dh = dst_rect->height;
+    const int is_yuv = dst_fourcc == IMAGE_NV12 || ovl->num_planes == 3;
+    uint8_t *src[MAX_IMAGE_PLANES], *row_buf = NULL, *comp_buf, *s;
+    int src_stride[MAX_IMAGE_PLANES];
+    uint32_t *acc = NULL, *a;
+    unsigned int *xmap = NULL;
+    unsigned int i, x, y, t, t0, t1, x0, x1, src_a_pos, a_pos, cw, ch, cx0, cy0;
+    uint8_t src_order[4], src_pos[4], dst_order[4], perm[4];
+    ImageRGBCoefs coefs;
+    int error = -1;
+
+    static const uint8_t yuva_order[4] = { 0, 1, 2, 3 };
+
+    ovl->x0 = dst_rect->x;
+    ovl->y0 = dst_rect->y;
+    ovl->x1 = dst_rect->x + dw;
+    ovl->y1 = dst_rect->y + dh;
+
+    for (i = 0; i < ovl->num_planes; i++) {
+        BlendPlane * const plane = &ovl->planes[i];
+        const unsigned int round = (1U << plane->vshift) - 1;
+        unsigned int size;
+
+        blend_plane_get_span(plane, ovl->x0, ovl->x1, &plane->x0, &plane->x1);
+        plane->y0 = ovl->y0 >> plane->vshift;
+        plane->y1 = (ovl->y1 + round) >> plane->vshift;
+
+        size = (plane->x1 - plane->x0) * (plane->y1 - plane->y0);
+        plane->src = malloc(2 * size);
+        if (!plane->src)
+            goto end;
+        plane->k = plane->src + size;
+    }
+
+    ovl->tx0     = ovl->x0 / BLEND_TILE_WIDTH;
+    ovl->ty0     = ovl->y0 / BLEND_TILE_HEIGHT;
+    ovl->tiles_x = (ovl->x1 - 1) / BLEND_TILE_WIDTH  - ovl->tx0 + 1;
+    ovl->tiles_y = (ovl->y1 - 1) / BLEND_TILE_HEIGHT - ovl->ty0 + 1;
+    ovl->tiles   = calloc(ovl->tiles_x, ovl->tiles_y);
+    if (!ovl->tiles)
+        goto end;
+
+    if (get_RGB32_order(src_img->format, src_order) < 0)
+        goto end;
+    image_invert_order(src_order, src_pos);
+    src_a_pos = src_pos[3];
+
+    /* Pixels are converted to Y, U, V, A for YUV formats, or to the
+       destination byte order */
+    if (is_yuv) {
+        image_get_RGB_coefs(&coefs, src_order);
+        a_pos = 3;
+    }
+    else {
+        if (get_RGB32_order(dst_fourcc, dst_order) < 0)
+            goto end;
+        for (i = 0; i < 4; i++)
+            perm[i] = src_pos[dst_order[i]];
+        image_invert_order(dst_order, src_pos);
+        a_pos = src_pos[3];
+    }
+
+    if (image_get_parts(src_img, src, src_stride) < 0)
+        goto end;
+    s = src[0] + src_rect->y * src_stride[0] + 4 * src_rect->x;
+
+    xmap    = malloc(dw * sizeof(*xmap));
+    row_buf = malloc(2 * 4 * dw);
+    if (!xmap || !row_buf)
+        goto end;
+    comp_buf = row_buf + 4 * dw;
+
+    for (x = 0; x < dw; x++)
+        xmap[x] = 4 * blend_scale(x, sw, dw);
+
+    /* Find the visible tiles first, looking at the alpha channel only */
+    for (y = 0; y < dh; y++) {
+        const uint8_t * const row = s + blend_scale(y, sh, dh) * src_stride[0];
+        uint8_t * const tiles = ovl->tiles +
+            ((ovl->y0 + y) / BLEND_TILE_HEIGHT - ovl->ty0) * ovl->tiles_x;
+
+        for (t = 0; t < ovl->tiles_x; t++) {
+            if (tiles[t])
+                continue;
+            x0 = MAX(ovl->x0, (ovl->tx0 + t) * BLEND_TILE_WIDTH) - ovl->x0;
+            x1 = MIN(ovl->x1, (ovl->tx0 + t + 1) * BLEND_TILE_WIDTH) - ovl->x0;
+            for (x = x0; x < x1; x++) {
+                if (image_div255(row[xmap[x] + src_a_pos] * alpha)) {
+                    tiles[t] = 1;
+                    break;
+                }
+            }
+        }
+    }
+
+    /* Chroma sums of u * a, v * a and a over each 2x2 block */
+    cx0 = ovl->x0 >> 1;
+    cy0 = ovl->y0 >> 1;
+    cw  = ((ovl->x1 + 1) >> 1) - cx0;
+    ch  = ((ovl->y1 + 1) >> 1) - cy0;
+    if (is_yuv) {
+        acc = calloc(3 * cw * ch, sizeof(*acc));
+        if (!acc)
+            goto end;
+    }
+
+    for (y = 0; y < dh; y++) {
+        BlendPlane * const plane = &ovl->planes[0];
+        const unsigned int stride = plane->x1 - plane->x0;
+        const unsigned int fy = ovl->y0 + y;
+        const uint8_t * const row = s + blend_scale(y, sh, dh) * src_stride[0];
+        const uint8_t * const tiles = ovl->tiles +
+            (fy / BLEND_TILE_HEIGHT - ovl->ty0) * ovl->tiles_x;
+        uint8_t * const d = plane->src + y * stride;
+        uint8_t * const k = plane->k   + y * stride;
+
+        for (t = 0; blend_next_run(tiles, ovl->tiles_x, t, &t0, &t1); t = t1) {
+            x0 = MAX(ovl->x0, (ovl->tx0 + t0) * BLEND_TILE_WIDTH) - ovl->x0;
+            x1 = MIN(ovl->x1, (ovl->tx0 + t1) * BLEND_TILE_WIDTH) - ovl->x0;
+
+            /* Gather the source pixels, then convert them at once */
+            for (x = x0; x < x1; x++)
+                memcpy(row_buf + 4 * (x - x0), row + xmap[x], 4);
+            if (is_yuv)
+                image_RGB32_to_AYUV(row_buf, 4 * dw, comp_buf, 4 * dw,
+                                    x1 - x0, 1, &coefs, yuva_order);
+            else
+                image_swizzle_RGB32(row_buf, 4 * dw, comp_buf, 4 * dw,
+                                    x1 - x0, 1, perm);
+
+            for (x = x0; x < x1; x++) {
+                const uint8_t * const p = comp_buf + 4 * (x - x0);
+                const unsigned int fx = ovl->x0 + x;
+                const unsigned int pa = image_div255(p[a_pos] * alpha);
+
+                if (!is_yuv) {
+                    for (i = 0; i < 4; i++) {
+                        d[4 * x + i] = i == a_pos ? pa : image_div255(p[i] * pa);
+                        k[4 * x + i] = 255 - pa;
+                    }
+                    continue;
+                }
+
+                d[x] = image_div255(p[0] * pa);
+                k[x] = 255 - pa;
+
+                a = acc + 3 * (((fy >> 1) - cy0) * cw + (fx >> 1) - cx0);
+                a[0] += p[1] * pa;
+                a[1] += p[2] * pa;
+                a[2] += pa;
+            }
+        }
+    }
+
+    /* Average chroma over 2x2 blocks, uncovered pixels being transparent */
+    for (y = 0; is_yuv && y < ch; y++) {
+        const uint8_t * const tiles = ovl->tiles +
+            ((2 * (cy0 + y)) / BLEND_TILE_HEIGHT - ovl->ty0) * ovl->tiles_x;
+
+        for (t = 0; blend_next_run(tiles, ovl->tiles_x, t, &t0, &t1); t = t1) {
+            x0 = MAX(ovl->x0, (ovl->tx0 + t0) * BLEND_TILE_WIDTH) >> 1;
+            x1 = (MIN(ovl->x1, (ovl->tx0 + t1) * BLEND_TILE_WIDTH) + 1) >> 1;
+
+            for (x = x0 - cx0; x < x1 - cx0; x++) {
+                unsigned int pu, pv, k;
+
+                a = acc + 3 * (y * cw + x);
+                pu = (a[0] + 510) / 1020;
+                pv = (a[1] + 510) / 1020;
+                k  = 255 - ((a[2] + 2) >> 2);
+
+                if (ovl->u_plane) {
+                    BlendPlane * const u = &ovl->planes[ovl->u_plane];
+                    BlendPlane * const v = &ovl->planes[ovl->v_plane];
+                    const unsigned int ofs = y * (u->x1 - u->x0) + x;
+                    u->src[ofs] = pu;
+                    u->k[ofs]   = k;
+                    v->src[ofs] = pv;
+                    v->k[ofs]   = k;
+                }
+                else {
+                    BlendPlane * const uv = &ovl->planes[1];
+                    const unsigned int ofs = y * (uv->x1 - uv->x0) + 2 * x;
+                    uv->src[ofs]     = pu;
+                    uv->src[ofs + 1] = pv;
+                    uv->k[ofs]       = k;
+                    uv->k[ofs + 1]   = k;
+                }
+            }
+        }
+    }
+    error = 0;
+end:
+    free(acc);
+    free(xmap);
+    free(row_buf);
+    return error;
+}
+
+/* Blends the visible tiles of the overlay into plane I of the destination */
+static void
+blend_overlay_plane(
+    BlendOverlay *ovl,
+    unsigned int  i,
+    uint8_t      *dst,
+    int           dst_stride
+)
+{
+    const BlendPlane * const plane = &ovl->planes[i];
+    const unsigned int stride = plane->x1 - plane->x0;
+    unsigned int y, t, t0, t1, x0, x1, b0, b1;
+
+    for (y = plane->y0; y < plane->y1; y++) {
+        const unsigned int ty = ((y << plane->vshift) / BLEND_TILE_HEIGHT -
+                                 ovl->ty0);
+        const uint8_t * const tiles = ovl->tiles + ty * ovl->tiles_x;
+        const unsigned int ofs = (y - plane->y0) * stride;
+
+        /* Blend each run of visible tiles at once */
+        for (t = 0; blend_next_run(tiles, ovl->tiles_x, t, &t0, &t1); t = t1) {
+            x0 = MAX(ovl->x0, (ovl->tx0 + t0) * BLEND_TILE_WIDTH);
+            x1 = MIN(ovl->x1, (ovl->tx0 + t1) * BLEND_TILE_WIDTH);
+            blend_plane_get_span(plane, x0, x1, &b0, &b1);
+            b0 = MAX(b0, plane->x0);
+            b1 = MIN(b1, plane->x1);
+            image_blend_row(dst + y * dst_stride + b0,
+                            plane->src + ofs + (b0 - plane->x0),
+                            plane->k + ofs + (b0 - plane->x0),
+                            b1 - b0);
+        }
+    }
+}
+
+static inline int
+is_rect_inside(const Rectangle *r, Image *img)
+{
+    return (r->x >= 0 && r->y >= 0 && r->width > 0 && r->height > 0 &&
+            r->x + r->width  <= img->width &&
+            r->y + r->height <= img->height);
+}
+
+int image_blend(
+    Image           *dst_img,
+    Image           *src_img,
+    const Rectangle *src_rect,
+    const Rectangle *dst_rect,
+    unsigned int     alpha
+)
+{
+    BlendOverlay ovl;
+    Rectangle src_r, dst_r;
+    uint8_t *dst[MAX_IMAGE_PLANES];
+    int dst_stride[MAX_IMAGE_PLANES];
+    unsigned int i;
+    int error = -1;
+
+    image_init_kernels();
+
+    if (!src_rect) {
+        src_r.x      = 0;
+        src_r.y      = 0;
+        src_r.width  = src_img->width;
+        src_r.height = src_img->height;
+        src_rect     = &src_r;
+    }
+
+    if (!dst_rect) {
+        dst_r.x      = 0;
+        dst_r.y      = 0;
+        dst_r.width  = dst_img->width;
+        dst_r.height = dst_img->height;
+        dst_rect     = &dst_r;
+    }
+
+    if (!is_rect_inside(src_rect, src_img) || !is_rect_inside(dst_rect, dst_img))
+        return -1;
+
+    memset(&ovl, 0, sizeof(ovl));
+    if (blend_overlay_init_planes(&ovl, dst_img->format) < 0)
+        return -1;
+    if (blend_overlay_init(&ovl, dst_img->format, src_img,
+                           src_rect, dst_rect, MIN(alpha, 255)) < 0)
+        goto end;
+
+    if (image_get_parts(dst_img, dst, dst_stride) < 0)
+        goto end;
+    for (i = 0; i < ovl.num_planes; i++)
+        blend_overlay_plane(&ovl, i, dst[i], dst_stride[i]);
+    error = 0;
+end:
+    blend_overlay_free(&ovl);
+    return error;
+}
+
+void image_exit(void)
+{
+#if HAVE_SWSCALE
+    sws_cache_exit();
+#endif
+    scratch_release();
+    image_pool_exit();
+
+    free(g_rotate_buffer);
+    g_rotate_buffer = NULL;
+    g_rotate_buffer_size = 0;
+}
+
 int image_convert(Image *dst_img, Image *src_img)
 {
     uint8_t *src[MAX_IMAGE_PLANES];
     int src_stride[MAX_IMAGE_PLANES];
     uint8_t *dst[MAX_IMAGE_PLANES];
     int dst_stride[MAX_IMAGE_PLANES];
+    Image *cached_img;
+    int error;
 
     D(bug("convert %s:%ux%u to %s:%ux%u\n",
           string_of_FOURCC(src_img->format), src_img->width, src_img->height,
           string_of_FOURCC(dst_img->format), dst_img->width, dst_img->height));
 
+    image_init_kernels();
+
+    /* Uncached sources are read only once, with streaming loads */
+    if ((src_img->flags & IMAGE_FLAG_UNCACHED) &&
+        image_stream_load != image_stream_load_c) {
+        if (src_img->format == dst_img->format &&
+            src_img->width  == dst_img->width  &&
+            src_img->height == dst_img->height &&
+            get_plane_row_bytes(src_img->format, 0, src_img->width)) {
+            image_copy_uncached(dst_img, src_img);
+            return 0;
+        }
+        cached_img = image_get_cached_copy(src_img);
+        if (cached_img) {
+            error = image_convert(dst_img, cached_img);
+            image_destroy(cached_img);
+            return error;
+        }
+    }
+
     if (image_get_parts(src_img, src, src_stride) < 0)
         return -1;
 
     if (image_get_parts(dst_img, dst, dst_stride) < 0)
         return -1;
 
+    if (src_img->width  == dst_img->width  &&
+        src_img->height == dst_img->height &&
+        src_img->width * src_img->height >= MIN_PARALLEL_PIXELS &&
+        thread_pool_get_size() > 1 &&
+        image_has_native_path(src_img->format, dst_img->format))
+        return image_convert_parallel(src, src_stride, src_img->format,
+                                      dst, dst_stride, dst_img->format,
+                                      src_img->width, src_img->height);
+
     return image_convert_1(src,
                            src_stride,
                            src_img->width,
@@ -859,33 +3377,35 @@ int image_convert(Image *dst_img, Image *src_img)
                            dst_img->format);
 }
 
-int image_write(Image *img, FILE *fp)
+int image_convert_dirty(Image *dst_img, Image *src_img)
 {
-    unsigned int x, y, src_stride;
-    const uint32_t *src;
-    uint8_t rgb_pixel[3];
+    Image src_view, dst_view;
+    Rectangle *rects;
+    int i, n, error = -1;
 
-    D(bug("write %s:%ux%u\n",
-          string_of_FOURCC(img->format), img->width, img->height));
+    /* Scaled conversions touch more than the dirty tiles */
+    if (src_img->width  != dst_img->width ||
+        src_img->height != dst_img->height)
+        return image_convert(dst_img, src_img);
 
-    if (img->format != IMAGE_RGB32)
+    n = image_get_dirty_rects(src_img, &rects);
+    if (n < 0)
         return -1;
-
-    src = (uint32_t *)img->pixels[0];
-    src_stride = img->pitches[0] / 4;
-
-    /* PPM format */
-    fprintf(fp, "P6\n%u %u\n255\n", img->width, img->height);
-    for (y = 0; y < img->height; y++) {
-        for (x = 0; x < img->width; x++) {
-            const uint32_t color = src[x];
-            rgb_pixel[0] = color >> 16;
-            rgb_pixel[1] = color >> 8;
-            rgb_pixel[2] = color & 0xff;
-            if (fwrite(rgb_pixel, sizeof(rgb_pixel), 1, fp) != 1)
-                return -1;
-        }
-        src += src_stride;
+    D(bug("convert %d dirty region%s\n", n, n != 1 ? "s" : ""));
+
+    for (i = 0; i < n; i++) {
+        const Rectangle * const r = &rects[i];
+
+        /* Tiles start on even coordinates, so that views of subsampled
+           formats always work */
+        if (image_view(&src_view, src_img, r->x, r->y, r->width, r->height) < 0 ||
+            image_view(&dst_view, dst_img, r->x, r->y, r->width, r->height) < 0)
+            goto end;
+        if (image_convert(&dst_view, &src_view) < 0)
+            goto end;
     }
-    return 0;
+    error = 0;
+end:
+    free(rects);
+    return error;
 }
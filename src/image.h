@@ -23,6 +23,7 @@
 
 #include <stdint.h>
 #include "config.h"
+#include "hash.h"
 
 #define MAX_IMAGE_PLANES 3
 
@@ -67,6 +68,23 @@
 // Packed RGB 8:8:8, 32-bit, A B G R
 #define IMAGE_ABGR   IMAGE_FOURCC('A','B','G','R')
 
+// Pixels live in uncached memory, e.g. a write-combined mapping of a
+// video surface, and are read back with streaming loads
+#define IMAGE_FLAG_UNCACHED (1 << 0)
+
+typedef struct _Rectangle Rectangle;
+
+struct _Rectangle {
+    int                 x;
+    int                 y;
+    unsigned int        width;
+    unsigned int        height;
+};
+
+// Modified regions of an image are tracked in tiles of this size
+#define IMAGE_TILE_WIDTH    64
+#define IMAGE_TILE_HEIGHT   16
+
 typedef struct _Image Image;
 
 struct _Image {
@@ -79,17 +97,91 @@ struct _Image {
     uint8_t            *pixels[MAX_IMAGE_PLANES];
     unsigned int        offsets[MAX_IMAGE_PLANES];
     unsigned int        pitches[MAX_IMAGE_PLANES];
+    unsigned int        flags;
+    uint8_t            *dirty_tiles;
 };
 
+// Create an image with 64-byte aligned planes and cache-line padded pitches
 Image *image_create(unsigned int width, unsigned int height, uint32_t format);
+
+// Destroy an image, its buffer is recycled by the next matching image_create()
 void image_destroy(Image *img);
 
-// Generate a random image, in RGB32 format
+// Initialize VIEW to reference the (X,Y):WxH rectangle of PARENT, without
+// copying pixels. VIEW must not be destroyed and must not outlive PARENT
+int image_view(
+    Image       *view,
+    Image       *parent,
+    unsigned int x,
+    unsigned int y,
+    unsigned int width,
+    unsigned int height
+);
+
+// Track the modified tiles of IMG, which all start dirty
+int image_track_dirty(Image *img);
+
+// Mark the (X,Y):WxH rectangle of IMG as modified
+void image_mark_dirty(Image *img, int x, int y, unsigned int width, unsigned int height);
+
+// Mark all tiles of IMG as clean, e.g. once its contents were uploaded
+void image_clear_dirty(Image *img);
+
+// Check whether IMG has modified tiles. Untracked images are always dirty
+int image_is_dirty(Image *img);
+
+// Get the modified regions of IMG as a newly allocated array of rectangles,
+// aligned on tiles. Return the number of rectangles, or -1 on error
+int image_get_dirty_rects(Image *img, Rectangle **rects);
+
+// Generate a random image, in RGB32 format, with dirty tiles tracking
 Image *image_generate(unsigned int width, unsigned int height);
 
+// Generate frame INDEX of a sequence like image_generate(). Test patterns
+// only depend on the --genimage-seed value and INDEX
+Image *image_generate_frame(unsigned int width, unsigned int height, unsigned int index);
+
 // Convert images, applying scaling and color-space conversion, if required
 int image_convert(Image *dst_img, Image *src_img);
 
+// Convert images like image_convert(), though only the dirty tiles of
+// SRC_IMG. DST_IMG must already hold a conversion of its previous contents
+int image_convert_dirty(Image *dst_img, Image *src_img);
+
+// Clockwise rotations, in the same order as the --rotation values
+enum ImageRotation {
+    IMAGE_ROTATION_0 = 0,
+    IMAGE_ROTATION_90,
+    IMAGE_ROTATION_180,
+    IMAGE_ROTATION_270
+};
+
+// Convert images like image_convert(), rotating the source image first
+int image_convert_rotate(
+    Image             *dst_img,
+    Image             *src_img,
+    enum ImageRotation rotation
+);
+
+// Composite the SRC_RECT region of the RGB32 overlay SRC_IMG over the
+// DST_RECT region of DST_IMG, scaling it if needed. NULL rectangles mean
+// whole images. The overlay has straight alpha, further scaled by ALPHA
+// (0-255). DST_IMG can be NV12, YV12, I420/IYUV or RGB32
+int image_blend(
+    Image           *dst_img,
+    Image           *src_img,
+    const Rectangle *src_rect,
+    const Rectangle *dst_rect,
+    unsigned int     alpha
+);
+
+// Compute a checksum of the visible pixels of each plane, skipping pitch
+// padding. Returns the number of planes, or -1 for unsupported formats
+int image_hash(Image *img, enum HashType type, uint64_t hashes[MAX_IMAGE_PLANES]);
+
+// Release resources cached by image_convert() and the image pool
+void image_exit(void);
+
 uint32_t image_rgba_format(
     int          bits_per_pixel,
     int          is_msb_first,
@@ -101,7 +193,13 @@ uint32_t image_rgba_format(
 
 void image_draw_rectangle(Image *img, int x, int y, int w, int h, uint32_t c);
 
-// Write image to file (PPM format)
-int image_write(Image *img, FILE *fp);
+// Fill the union of N_RECTS rectangles of the 32-bit image IMG with VALUE,
+// writing each pixel once. Rectangles are clipped to the image
+int image_fill_rects(
+    Image           *img,
+    const Rectangle *rects,
+    unsigned int     n_rects,
+    uint32_t         value
+);
 
 #endif /* IMAGE_H */
@@ -0,0 +1,1610 @@
+/*
+ *  image_simd.c - SIMD optimized image kernels
+ *
+ *  hwdecode-demos (C) 2009-2010 Splitted-Desktop Systems
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "sysdeps.h"
+#include "image_simd.h"
+
+#if USE_SIMD_X86
+#include <immintrin.h>
+#define TARGET(isa) __attribute__((__target__(isa)))
+#endif
+
+#if USE_SIMD_NEON
+#include <arm_neon.h>
+#endif
+
+/* Scalar fallback for the remaining pixels of a row */
+static inline void
+swizzle_RGB32_row(
+    const uint8_t *src,
+    uint8_t       *dst,
+    unsigned int   width,
+    const uint8_t  perm[4]
+)
+{
+    unsigned int x;
+
+    for (x = 0; x < width; x++, src += 4, dst += 4) {
+        const uint8_t s[4] = { src[0], src[1], src[2], src[3] };
+        dst[0] = s[perm[0]];
+        dst[1] = s[perm[1]];
+        dst[2] = s[perm[2]];
+        dst[3] = s[perm[3]];
+    }
+}
+
+/* Scalar fallback for the remaining pixels of a row, starting at x */
+static inline void
+YUV420_to_RGB32_row(
+    const uint8_t       *y_src,
+    const uint8_t       *u_src,
+    const uint8_t       *v_src,
+    unsigned int         uv_step,
+    uint8_t             *dst,
+    unsigned int         x,
+    unsigned int         width,
+    const ImageYUVCoefs *coefs,
+    const uint8_t        order[4]
+)
+{
+    for (; x < width; x++)
+        image_YUV_to_RGB32_pixel(y_src[x],
+                                 u_src[(x/2) * uv_step],
+                                 v_src[(x/2) * uv_step],
+                                 coefs, order, dst + 4 * x);
+}
+
+static inline void
+AYUV_to_YUV444P_row(
+    const uint8_t       *src,
+    uint8_t             *y_dst,
+    uint8_t             *u_dst,
+    uint8_t             *v_dst,
+    unsigned int         x,
+    unsigned int         width,
+    const uint8_t        pos[4]
+)
+{
+    for (; x < width; x++) {
+        y_dst[x] = src[4 * x + pos[0]];
+        u_dst[x] = src[4 * x + pos[1]];
+        v_dst[x] = src[4 * x + pos[2]];
+    }
+}
+
+static inline void
+YUV444P_to_AYUV_row(
+    const uint8_t       *y_src,
+    const uint8_t       *u_src,
+    const uint8_t       *v_src,
+    uint8_t             *dst,
+    unsigned int         x,
+    unsigned int         width,
+    const uint8_t        order[4]
+)
+{
+    for (; x < width; x++) {
+        const uint8_t yuva[4] = { y_src[x], u_src[x], v_src[x], 0xff };
+        dst[4 * x + 0] = yuva[order[0]];
+        dst[4 * x + 1] = yuva[order[1]];
+        dst[4 * x + 2] = yuva[order[2]];
+        dst[4 * x + 3] = yuva[order[3]];
+    }
+}
+
+static inline void
+RGB32_to_AYUV_row(
+    const uint8_t       *src,
+    uint8_t             *dst,
+    unsigned int         x,
+    unsigned int         width,
+    const ImageRGBCoefs *coefs,
+    const uint8_t        order[4]
+)
+{
+    for (; x < width; x++)
+        image_RGB32_to_AYUV_pixel(src + 4 * x, coefs, order, dst + 4 * x);
+}
+
+/* Transposes what is left over by a kernel working on BLOCK x BLOCK
+   blocks: the right columns of all rows, then the bottom rows */
+static inline void
+transpose_edges(
+    const uint8_t *src,
+    int            src_stride,
+    uint8_t       *dst,
+    int            dst_stride,
+    unsigned int   width,
+    unsigned int   height,
+    unsigned int   bpp,
+    unsigned int   block
+)
+{
+    const unsigned int w = width  & ~(block - 1);
+    const unsigned int h = height & ~(block - 1);
+
+    image_transpose_block(src + w * bpp, src_stride,
+                          dst + (ptrdiff_t)w * dst_stride, dst_stride,
+                          width - w, height, bpp);
+    image_transpose_block(src + (ptrdiff_t)h * src_stride, src_stride,
+                          dst + h * bpp, dst_stride,
+                          w, height - h, bpp);
+}
+
+#if USE_SIMD_X86
+TARGET("sse2")
+void image_swizzle_RGB32_sse2(
+    const uint8_t *src,
+    unsigned int   src_stride,
+    uint8_t       *dst,
+    unsigned int   dst_stride,
+    unsigned int   width,
+    unsigned int   height,
+    const uint8_t  perm[4]
+)
+{
+    const __m128i mask = _mm_set1_epi32(0xff);
+    __m128i rshift[4], lshift[4];
+    unsigned int i, x, y;
+
+    /* Without pshufb, each destination byte is extracted with a
+       shift/mask pair and moved to its final position */
+    for (i = 0; i < 4; i++) {
+        rshift[i] = _mm_cvtsi32_si128(8 * perm[i]);
+        lshift[i] = _mm_cvtsi32_si128(8 * i);
+    }
+
+    for (y = 0; y < height; y++, src += src_stride, dst += dst_stride) {
+        for (x = 0; x + 4 <= width; x += 4) {
+            const __m128i v = _mm_loadu_si128((const __m128i *)(src + 4 * x));
+            __m128i r = _mm_setzero_si128();
+            for (i = 0; i < 4; i++) {
+                const __m128i t = _mm_and_si128(_mm_srl_epi32(v, rshift[i]), mask);
+                r = _mm_or_si128(r, _mm_sll_epi32(t, lshift[i]));
+            }
+            _mm_storeu_si128((__m128i *)(dst + 4 * x), r);
+        }
+        swizzle_RGB32_row(src + 4 * x, dst + 4 * x, width - x, perm);
+    }
+}
+
+TARGET("ssse3")
+void image_swizzle_RGB32_ssse3(
+    const uint8_t *src,
+    unsigned int   src_stride,
+    uint8_t       *dst,
+    unsigned int   dst_stride,
+    unsigned int   width,
+    unsigned int   height,
+    const uint8_t  perm[4]
+)
+{
+    uint8_t shuffle[16];
+    __m128i mask;
+    unsigned int i, x, y;
+
+    for (i = 0; i < 16; i++)
+        shuffle[i] = (i & ~3) + perm[i & 3];
+    mask = _mm_loadu_si128((const __m128i *)shuffle);
+
+    for (y = 0; y < height; y++, src += src_stride, dst += dst_stride) {
+        for (x = 0; x + 8 <= width; x += 8) {
+            const __m128i v0 = _mm_loadu_si128((const __m128i *)(src + 4 * x));
+            const __m128i v1 = _mm_loadu_si128((const __m128i *)(src + 4 * x + 16));
+            _mm_storeu_si128((__m128i *)(dst + 4 * x),      _mm_shuffle_epi8(v0, mask));
+            _mm_storeu_si128((__m128i *)(dst + 4 * x + 16), _mm_shuffle_epi8(v1, mask));
+        }
+        if (x + 4 <= width) {
+            const __m128i v = _mm_loadu_si128((const __m128i *)(src + 4 * x));
+            _mm_storeu_si128((__m128i *)(dst + 4 * x), _mm_shuffle_epi8(v, mask));
+            x += 4;
+        }
+        swizzle_RGB32_row(src + 4 * x, dst + 4 * x, width - x, perm);
+    }
+}
+
+TARGET("avx2")
+void image_swizzle_RGB32_avx2(
+    const uint8_t *src,
+    unsigned int   src_stride,
+    uint8_t       *dst,
+    unsigned int   dst_stride,
+    unsigned int   width,
+    unsigned int   height,
+    const uint8_t  perm[4]
+)
+{
+    uint8_t shuffle[32];
+    __m256i mask;
+    unsigned int i, x, y;
+
+    /* vpshufb works on each 128-bit lane independently */
+    for (i = 0; i < 32; i++)
+        shuffle[i] = ((i & 15) & ~3) + perm[i & 3];
+    mask = _mm256_loadu_si256((const __m256i *)shuffle);
+
+    for (y = 0; y < height; y++, src += src_stride, dst += dst_stride) {
+        for (x = 0; x + 16 <= width; x += 16) {
+            const __m256i v0 = _mm256_loadu_si256((const __m256i *)(src + 4 * x));
+            const __m256i v1 = _mm256_loadu_si256((const __m256i *)(src + 4 * x + 32));
+            _mm256_storeu_si256((__m256i *)(dst + 4 * x),      _mm256_shuffle_epi8(v0, mask));
+            _mm256_storeu_si256((__m256i *)(dst + 4 * x + 32), _mm256_shuffle_epi8(v1, mask));
+        }
+        if (x + 8 <= width) {
+            const __m256i v = _mm256_loadu_si256((const __m256i *)(src + 4 * x));
+            _mm256_storeu_si256((__m256i *)(dst + 4 * x), _mm256_shuffle_epi8(v, mask));
+            x += 8;
+        }
+        swizzle_RGB32_row(src + 4 * x, dst + 4 * x, width - x, perm);
+    }
+    _mm256_zeroupper();
+}
+
+/* Interleaves 16 pixels of 8-bit components p0..p3 into dst */
+TARGET("sse2")
+static inline void
+store_RGB32_sse2(uint8_t *dst, __m128i p0, __m128i p1, __m128i p2, __m128i p3)
+{
+    const __m128i t01l = _mm_unpacklo_epi8(p0, p1);
+    const __m128i t01h = _mm_unpackhi_epi8(p0, p1);
+    const __m128i t23l = _mm_unpacklo_epi8(p2, p3);
+    const __m128i t23h = _mm_unpackhi_epi8(p2, p3);
+
+    _mm_storeu_si128((__m128i *)(dst +  0), _mm_unpacklo_epi16(t01l, t23l));
+    _mm_storeu_si128((__m128i *)(dst + 16), _mm_unpackhi_epi16(t01l, t23l));
+    _mm_storeu_si128((__m128i *)(dst + 32), _mm_unpacklo_epi16(t01h, t23h));
+    _mm_storeu_si128((__m128i *)(dst + 48), _mm_unpackhi_epi16(t01h, t23h));
+}
+
+TARGET("sse2")
+void image_YUV420_to_RGB32_sse2(
+    const uint8_t       *y_src,
+    unsigned int         y_stride,
+    const uint8_t       *u_src,
+    const uint8_t       *v_src,
+    unsigned int         uv_stride,
+    unsigned int         uv_step,
+    uint8_t             *dst,
+    unsigned int         dst_stride,
+    unsigned int         width,
+    unsigned int         height,
+    const ImageYUVCoefs *coefs,
+    const uint8_t        order[4]
+)
+{
+    const __m128i zero     = _mm_setzero_si128();
+    const __m128i bias     = _mm_set1_epi16(128);
+    const __m128i uv_mask  = _mm_set1_epi16(0xff);
+    const __m128i y_offset = _mm_set1_epi16(coefs->y_offset);
+    const __m128i y_coef   = _mm_set1_epi16(coefs->y_coef);
+    const __m128i y_round  = _mm_set1_epi16(1 << (IMAGE_YUV_FRAC_BITS - 1));
+    const __m128i rv_coef  = _mm_set1_epi16(coefs->rv_coef);
+    const __m128i gu_coef  = _mm_set1_epi16(coefs->gu_coef);
+    const __m128i gv_coef  = _mm_set1_epi16(coefs->gv_coef);
+    const __m128i bu_coef  = _mm_set1_epi16(coefs->bu_coef);
+    const int is_nv12      = uv_step == 2 && v_src == u_src + 1;
+    const unsigned int simd_width = (uv_step == 1 || is_nv12) ? width : 0;
+    unsigned int x, y;
+
+    for (y = 0; y < height; y++) {
+        const uint8_t * const yp = y_src + y * y_stride;
+        const uint8_t * const up = u_src + (y / 2) * uv_stride;
+        const uint8_t * const vp = v_src + (y / 2) * uv_stride;
+        uint8_t * const dp = dst + y * dst_stride;
+
+        for (x = 0; x + 16 <= simd_width; x += 16) {
+            __m128i u, v, rv, guv, bu, yl, yh, y8, ch[4];
+
+            if (is_nv12) {
+                const __m128i uv = _mm_loadu_si128((const __m128i *)(up + x));
+                u = _mm_and_si128(uv, uv_mask);
+                v = _mm_srli_epi16(uv, 8);
+            }
+            else {
+                u = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)(up + x/2)), zero);
+                v = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)(vp + x/2)), zero);
+            }
+            u   = _mm_slli_epi16(_mm_sub_epi16(u, bias), IMAGE_YUV_INPUT_BITS);
+            v   = _mm_slli_epi16(_mm_sub_epi16(v, bias), IMAGE_YUV_INPUT_BITS);
+            rv  = _mm_mulhi_epi16(v, rv_coef);
+            guv = _mm_add_epi16(_mm_mulhi_epi16(u, gu_coef),
+                                _mm_mulhi_epi16(v, gv_coef));
+            bu  = _mm_mulhi_epi16(u, bu_coef);
+
+            y8 = _mm_loadu_si128((const __m128i *)(yp + x));
+            yl = _mm_sub_epi16(_mm_unpacklo_epi8(y8, zero), y_offset);
+            yl = _mm_slli_epi16(yl, IMAGE_YUV_INPUT_BITS);
+            yl = _mm_add_epi16(_mm_mulhi_epi16(yl, y_coef), y_round);
+            yh = _mm_sub_epi16(_mm_unpackhi_epi8(y8, zero), y_offset);
+            yh = _mm_slli_epi16(yh, IMAGE_YUV_INPUT_BITS);
+            yh = _mm_add_epi16(_mm_mulhi_epi16(yh, y_coef), y_round);
+
+            /* Each chroma term is shared by two horizontal pixels.
+               Saturation only occurs for values that clip to 255 */
+#define CHANNEL(OP, TERM)                                               \
+            _mm_packus_epi16(                                           \
+                _mm_srai_epi16(OP(yl, _mm_unpacklo_epi16(TERM, TERM)),  \
+                               IMAGE_YUV_FRAC_BITS),                    \
+                _mm_srai_epi16(OP(yh, _mm_unpackhi_epi16(TERM, TERM)),  \
+                               IMAGE_YUV_FRAC_BITS))
+            ch[0] = CHANNEL(_mm_adds_epi16, rv);
+            ch[1] = CHANNEL(_mm_subs_epi16, guv);
+            ch[2] = CHANNEL(_mm_adds_epi16, bu);
+            ch[3] = _mm_cmpeq_epi8(zero, zero);
+#undef CHANNEL
+            store_RGB32_sse2(dp + 4 * x,
+                             ch[order[0]], ch[order[1]],
+                             ch[order[2]], ch[order[3]]);
+        }
+        YUV420_to_RGB32_row(yp, up, vp, uv_step, dp, x, width, coefs, order);
+    }
+}
+
+TARGET("avx2")
+void image_YUV420_to_RGB32_avx2(
+    const uint8_t       *y_src,
+    unsigned int         y_stride,
+    const uint8_t       *u_src,
+    const uint8_t       *v_src,
+    unsigned int         uv_stride,
+    unsigned int         uv_step,
+    uint8_t             *dst,
+    unsigned int         dst_stride,
+    unsigned int         width,
+    unsigned int         height,
+    const ImageYUVCoefs *coefs,
+    const uint8_t        order[4]
+)
+{
+    const __m256i bias     = _mm256_set1_epi16(128);
+    const __m256i uv_mask  = _mm256_set1_epi16(0xff);
+    const __m256i y_offset = _mm256_set1_epi16(coefs->y_offset);
+    const __m256i y_coef   = _mm256_set1_epi16(coefs->y_coef);
+    const __m256i y_round  = _mm256_set1_epi16(1 << (IMAGE_YUV_FRAC_BITS - 1));
+    const __m256i rv_coef  = _mm256_set1_epi16(coefs->rv_coef);
+    const __m256i gu_coef  = _mm256_set1_epi16(coefs->gu_coef);
+    const __m256i gv_coef  = _mm256_set1_epi16(coefs->gv_coef);
+    const __m256i bu_coef  = _mm256_set1_epi16(coefs->bu_coef);
+    const int is_nv12      = uv_step == 2 && v_src == u_src + 1;
+    const unsigned int simd_width = (uv_step == 1 || is_nv12) ? width : 0;
+    unsigned int x, y;
+
+    for (y = 0; y < height; y++) {
+        const uint8_t * const yp = y_src + y * y_stride;
+        const uint8_t * const up = u_src + (y / 2) * uv_stride;
+        const uint8_t * const vp = v_src + (y / 2) * uv_stride;
+        uint8_t * const dp = dst + y * dst_stride;
+
+        for (x = 0; x + 32 <= simd_width; x += 32) {
+            __m256i u, v, rv, guv, bu, y0, y1, ch[4];
+            __m256i t01l, t01h, t23l, t23h, o0, o1, o2, o3;
+
+            if (is_nv12) {
+                const __m256i uv = _mm256_loadu_si256((const __m256i *)(up + x));
+                u = _mm256_and_si256(uv, uv_mask);
+                v = _mm256_srli_epi16(uv, 8);
+            }
+            else {
+                u = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)(up + x/2)));
+                v = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)(vp + x/2)));
+            }
+            u   = _mm256_slli_epi16(_mm256_sub_epi16(u, bias), IMAGE_YUV_INPUT_BITS);
+            v   = _mm256_slli_epi16(_mm256_sub_epi16(v, bias), IMAGE_YUV_INPUT_BITS);
+
+            /* Reorder 64-bit quads so that the in-lane unpacks below
+               yield chroma terms for pixels 0-15 and 16-31 */
+            rv  = _mm256_permute4x64_epi64(_mm256_mulhi_epi16(v, rv_coef), 0xd8);
+            guv = _mm256_permute4x64_epi64(
+                _mm256_add_epi16(_mm256_mulhi_epi16(u, gu_coef),
+                                 _mm256_mulhi_epi16(v, gv_coef)), 0xd8);
+            bu  = _mm256_permute4x64_epi64(_mm256_mulhi_epi16(u, bu_coef), 0xd8);
+
+            y0 = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)(yp + x)));
+            y0 = _mm256_slli_epi16(_mm256_sub_epi16(y0, y_offset), IMAGE_YUV_INPUT_BITS);
+            y0 = _mm256_add_epi16(_mm256_mulhi_epi16(y0, y_coef), y_round);
+            y1 = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)(yp + x + 16)));
+            y1 = _mm256_slli_epi16(_mm256_sub_epi16(y1, y_offset), IMAGE_YUV_INPUT_BITS);
+            y1 = _mm256_add_epi16(_mm256_mulhi_epi16(y1, y_coef), y_round);
+
+            /* Packed lanes hold pixels 0-7, 16-23 | 8-15, 24-31 */
+#define CHANNEL(OP, TERM)                                                       \
+            _mm256_packus_epi16(                                                \
+                _mm256_srai_epi16(OP(y0, _mm256_unpacklo_epi16(TERM, TERM)),    \
+                                  IMAGE_YUV_FRAC_BITS),                         \
+                _mm256_srai_epi16(OP(y1, _mm256_unpackhi_epi16(TERM, TERM)),    \
+                                  IMAGE_YUV_FRAC_BITS))
+            ch[0] = CHANNEL(_mm256_adds_epi16, rv);
+            ch[1] = CHANNEL(_mm256_subs_epi16, guv);
+            ch[2] = CHANNEL(_mm256_adds_epi16, bu);
+            ch[3] = _mm256_set1_epi8(-1);
+#undef CHANNEL
+
+            t01l = _mm256_unpacklo_epi8(ch[order[0]], ch[order[1]]);
+            t01h = _mm256_unpackhi_epi8(ch[order[0]], ch[order[1]]);
+            t23l = _mm256_unpacklo_epi8(ch[order[2]], ch[order[3]]);
+            t23h = _mm256_unpackhi_epi8(ch[order[2]], ch[order[3]]);
+            o0   = _mm256_unpacklo_epi16(t01l, t23l);
+            o1   = _mm256_unpackhi_epi16(t01l, t23l);
+            o2   = _mm256_unpacklo_epi16(t01h, t23h);
+            o3   = _mm256_unpackhi_epi16(t01h, t23h);
+            _mm256_storeu_si256((__m256i *)(dp + 4 * x),
+                                _mm256_permute2x128_si256(o0, o1, 0x20));
+            _mm256_storeu_si256((__m256i *)(dp + 4 * x + 32),
+                                _mm256_permute2x128_si256(o0, o1, 0x31));
+            _mm256_storeu_si256((__m256i *)(dp + 4 * x + 64),
+                                _mm256_permute2x128_si256(o2, o3, 0x20));
+            _mm256_storeu_si256((__m256i *)(dp + 4 * x + 96),
+                                _mm256_permute2x128_si256(o2, o3, 0x31));
+        }
+        YUV420_to_RGB32_row(yp, up, vp, uv_step, dp, x, width, coefs, order);
+    }
+    _mm256_zeroupper();
+}
+
+/* Interleaves 32 pixels of 8-bit components p0..p3 into dst */
+TARGET("avx2")
+static inline void
+store_RGB32_avx2(uint8_t *dst, __m256i p0, __m256i p1, __m256i p2, __m256i p3)
+{
+    const __m256i t01l = _mm256_unpacklo_epi8(p0, p1);
+    const __m256i t01h = _mm256_unpackhi_epi8(p0, p1);
+    const __m256i t23l = _mm256_unpacklo_epi8(p2, p3);
+    const __m256i t23h = _mm256_unpackhi_epi8(p2, p3);
+    const __m256i o0   = _mm256_unpacklo_epi16(t01l, t23l);
+    const __m256i o1   = _mm256_unpackhi_epi16(t01l, t23l);
+    const __m256i o2   = _mm256_unpacklo_epi16(t01h, t23h);
+    const __m256i o3   = _mm256_unpackhi_epi16(t01h, t23h);
+
+    _mm256_storeu_si256((__m256i *)(dst +  0), _mm256_permute2x128_si256(o0, o1, 0x20));
+    _mm256_storeu_si256((__m256i *)(dst + 32), _mm256_permute2x128_si256(o2, o3, 0x20));
+    _mm256_storeu_si256((__m256i *)(dst + 64), _mm256_permute2x128_si256(o0, o1, 0x31));
+    _mm256_storeu_si256((__m256i *)(dst + 96), _mm256_permute2x128_si256(o2, o3, 0x31));
+}
+
+TARGET("ssse3")
+void image_AYUV_to_YUV444P_ssse3(
+    const uint8_t       *src,
+    unsigned int         src_stride,
+    uint8_t             *y_dst,
+    unsigned int         y_stride,
+    uint8_t             *u_dst,
+    uint8_t             *v_dst,
+    unsigned int         uv_stride,
+    unsigned int         width,
+    unsigned int         height,
+    const uint8_t        order[4]
+)
+{
+    uint8_t pos[4], shuffle[16];
+    __m128i mask;
+    unsigned int i, x, y;
+
+    /* Gather the Y, U, V and A bytes of 4 pixels into separate dwords */
+    image_invert_order(order, pos);
+    for (i = 0; i < 16; i++)
+        shuffle[i] = 4 * (i & 3) + pos[i >> 2];
+    mask = _mm_loadu_si128((const __m128i *)shuffle);
+
+    for (y = 0; y < height; y++) {
+        for (x = 0; x + 16 <= width; x += 16) {
+            const uint8_t * const s = src + 4 * x;
+            const __m128i s0 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(s +  0)), mask);
+            const __m128i s1 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(s + 16)), mask);
+            const __m128i s2 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(s + 32)), mask);
+            const __m128i s3 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(s + 48)), mask);
+            const __m128i t0 = _mm_unpacklo_epi32(s0, s1);
+            const __m128i t1 = _mm_unpacklo_epi32(s2, s3);
+            const __m128i t2 = _mm_unpackhi_epi32(s0, s1);
+            const __m128i t3 = _mm_unpackhi_epi32(s2, s3);
+            _mm_storeu_si128((__m128i *)(y_dst + x), _mm_unpacklo_epi64(t0, t1));
+            _mm_storeu_si128((__m128i *)(u_dst + x), _mm_unpackhi_epi64(t0, t1));
+            _mm_storeu_si128((__m128i *)(v_dst + x), _mm_unpacklo_epi64(t2, t3));
+        }
+        AYUV_to_YUV444P_row(src, y_dst, u_dst, v_dst, x, width, pos);
+        src   += src_stride;
+        y_dst += y_stride;
+        u_dst += uv_stride;
+        v_dst += uv_stride;
+    }
+}
+
+TARGET("avx2")
+void image_AYUV_to_YUV444P_avx2(
+    const uint8_t       *src,
+    unsigned int         src_stride,
+    uint8_t             *y_dst,
+    unsigned int         y_stride,
+    uint8_t             *u_dst,
+    uint8_t             *v_dst,
+    unsigned int         uv_stride,
+    unsigned int         width,
+    unsigned int         height,
+    const uint8_t        order[4]
+)
+{
+    uint8_t pos[4], shuffle[32];
+    __m256i mask, perm;
+    unsigned int i, x, y;
+
+    image_invert_order(order, pos);
+    for (i = 0; i < 32; i++)
+        shuffle[i] = 4 * (i & 3) + pos[(i >> 2) & 3];
+    mask = _mm256_loadu_si256((const __m256i *)shuffle);
+
+    /* In-lane transposes leave pixels 0-3, 8-11, 16-19, 24-27 in the
+       low lane and 4-7, 12-15, 20-23, 28-31 in the high lane */
+    perm = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+
+    for (y = 0; y < height; y++) {
+        for (x = 0; x + 32 <= width; x += 32) {
+            const uint8_t * const s = src + 4 * x;
+            const __m256i s0 = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i *)(s +  0)), mask);
+            const __m256i s1 = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i *)(s + 32)), mask);
+            const __m256i s2 = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i *)(s + 64)), mask);
+            const __m256i s3 = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i *)(s + 96)), mask);
+            const __m256i t0 = _mm256_unpacklo_epi32(s0, s1);
+            const __m256i t1 = _mm256_unpacklo_epi32(s2, s3);
+            const __m256i t2 = _mm256_unpackhi_epi32(s0, s1);
+            const __m256i t3 = _mm256_unpackhi_epi32(s2, s3);
+            _mm256_storeu_si256((__m256i *)(y_dst + x),
+                _mm256_permutevar8x32_epi32(_mm256_unpacklo_epi64(t0, t1), perm));
+            _mm256_storeu_si256((__m256i *)(u_dst + x),
+                _mm256_permutevar8x32_epi32(_mm256_unpackhi_epi64(t0, t1), perm));
+            _mm256_storeu_si256((__m256i *)(v_dst + x),
+                _mm256_permutevar8x32_epi32(_mm256_unpacklo_epi64(t2, t3), perm));
+        }
+        AYUV_to_YUV444P_row(src, y_dst, u_dst, v_dst, x, width, pos);
+        src   += src_stride;
+        y_dst += y_stride;
+        u_dst += uv_stride;
+        v_dst += uv_stride;
+    }
+    _mm256_zeroupper();
+}
+
+TARGET("sse2")
+void image_YUV444P_to_AYUV_sse2(
+    const uint8_t       *y_src,
+    unsigned int         y_stride,
+    const uint8_t       *u_src,
+    const uint8_t       *v_src,
+    unsigned int         uv_stride,
+    uint8_t             *dst,
+    unsigned int         dst_stride,
+    unsigned int         width,
+    unsigned int         height,
+    const uint8_t        order[4]
+)
+{
+    unsigned int x, y;
+
+    for (y = 0; y < height; y++) {
+        for (x = 0; x + 16 <= width; x += 16) {
+            __m128i ch[4];
+            ch[0] = _mm_loadu_si128((const __m128i *)(y_src + x));
+            ch[1] = _mm_loadu_si128((const __m128i *)(u_src + x));
+            ch[2] = _mm_loadu_si128((const __m128i *)(v_src + x));
+            ch[3] = _mm_cmpeq_epi8(ch[0], ch[0]);
+            store_RGB32_sse2(dst + 4 * x,
+                             ch[order[0]], ch[order[1]],
+                             ch[order[2]], ch[order[3]]);
+        }
+        YUV444P_to_AYUV_row(y_src, u_src, v_src, dst, x, width, order);
+        y_src += y_stride;
+        u_src += uv_stride;
+        v_src += uv_stride;
+        dst   += dst_stride;
+    }
+}
+
+TARGET("avx2")
+void image_YUV444P_to_AYUV_avx2(
+    const uint8_t       *y_src,
+    unsigned int         y_stride,
+    const uint8_t       *u_src,
+    const uint8_t       *v_src,
+    unsigned int         uv_stride,
+    uint8_t             *dst,
+    unsigned int         dst_stride,
+    unsigned int         width,
+    unsigned int         height,
+    const uint8_t        order[4]
+)
+{
+    unsigned int x, y;
+
+    for (y = 0; y < height; y++) {
+        for (x = 0; x + 32 <= width; x += 32) {
+            __m256i ch[4];
+            ch[0] = _mm256_loadu_si256((const __m256i *)(y_src + x));
+            ch[1] = _mm256_loadu_si256((const __m256i *)(u_src + x));
+            ch[2] = _mm256_loadu_si256((const __m256i *)(v_src + x));
+            ch[3] = _mm256_set1_epi8(-1);
+            store_RGB32_avx2(dst + 4 * x,
+                             ch[order[0]], ch[order[1]],
+                             ch[order[2]], ch[order[3]]);
+        }
+        YUV444P_to_AYUV_row(y_src, u_src, v_src, dst, x, width, order);
+        y_src += y_stride;
+        u_src += uv_stride;
+        v_src += uv_stride;
+        dst   += dst_stride;
+    }
+    _mm256_zeroupper();
+}
+
+static inline int64_t pack_coefs(const int16_t coefs[4])
+{
+    int64_t v;
+
+    memcpy(&v, coefs, sizeof(v));
+    return v;
+}
+
+TARGET("ssse3")
+void image_RGB32_to_AYUV_ssse3(
+    const uint8_t       *src,
+    unsigned int         src_stride,
+    uint8_t             *dst,
+    unsigned int         dst_stride,
+    unsigned int         width,
+    unsigned int         height,
+    const ImageRGBCoefs *coefs,
+    const uint8_t        order[4]
+)
+{
+    const int round = 1 << (IMAGE_RGB_COEF_BITS - 1);
+    const __m128i y_coefs  = _mm_set1_epi64x(pack_coefs(coefs->y_coefs));
+    const __m128i u_coefs  = _mm_set1_epi64x(pack_coefs(coefs->u_coefs));
+    const __m128i v_coefs  = _mm_set1_epi64x(pack_coefs(coefs->v_coefs));
+    const __m128i y_bias   = _mm_set1_epi32(round + (coefs->y_offset << IMAGE_RGB_COEF_BITS));
+    const __m128i uv_bias  = _mm_set1_epi32(round + (128 << IMAGE_RGB_COEF_BITS));
+    const __m128i zero     = _mm_setzero_si128();
+    const __m128i a_mask   = _mm_set1_epi32(0xff);
+    const __m128i a_shift  = _mm_cvtsi32_si128(8 * coefs->a_index);
+    unsigned int x, y;
+
+    for (y = 0; y < height; y++, src += src_stride, dst += dst_stride) {
+        for (x = 0; x + 16 <= width; x += 16) {
+            const __m128i v0 = _mm_loadu_si128((const __m128i *)(src + 4 * x +  0));
+            const __m128i v1 = _mm_loadu_si128((const __m128i *)(src + 4 * x + 16));
+            const __m128i v2 = _mm_loadu_si128((const __m128i *)(src + 4 * x + 32));
+            const __m128i v3 = _mm_loadu_si128((const __m128i *)(src + 4 * x + 48));
+            __m128i ch[4];
+
+            /* Components are widened to 16 bits, and each pixel is the
+               sum of the two 32-bit pair products, in pixel order */
+#define DOT(C, S, B)                                                    \
+            _mm_srai_epi32(_mm_add_epi32(_mm_hadd_epi32(                \
+                _mm_madd_epi16(_mm_unpacklo_epi8(S, zero), C),          \
+                _mm_madd_epi16(_mm_unpackhi_epi8(S, zero), C)),         \
+                B), IMAGE_RGB_COEF_BITS)
+#define CHANNEL(C, B)                                                   \
+            _mm_packus_epi16(                                           \
+                _mm_packs_epi32(DOT(C, v0, B), DOT(C, v1, B)),          \
+                _mm_packs_epi32(DOT(C, v2, B), DOT(C, v3, B)))
+            ch[0] = CHANNEL(y_coefs, y_bias);
+            ch[1] = CHANNEL(u_coefs, uv_bias);
+            ch[2] = CHANNEL(v_coefs, uv_bias);
+#undef  CHANNEL
+#undef  DOT
+#define ALPHA(S) _mm_and_si128(_mm_srl_epi32(S, a_shift), a_mask)
+            ch[3] = _mm_packus_epi16(_mm_packs_epi32(ALPHA(v0), ALPHA(v1)),
+                                     _mm_packs_epi32(ALPHA(v2), ALPHA(v3)));
+#undef  ALPHA
+            store_RGB32_sse2(dst + 4 * x,
+                             ch[order[0]], ch[order[1]],
+                             ch[order[2]], ch[order[3]]);
+        }
+        RGB32_to_AYUV_row(src, dst, x, width, coefs, order);
+    }
+}
+
+TARGET("avx2")
+void image_RGB32_to_AYUV_avx2(
+    const uint8_t       *src,
+    unsigned int         src_stride,
+    uint8_t             *dst,
+    unsigned int         dst_stride,
+    unsigned int         width,
+    unsigned int         height,
+    const ImageRGBCoefs *coefs,
+    const uint8_t        order[4]
+)
+{
+    const int round = 1 << (IMAGE_RGB_COEF_BITS - 1);
+    const __m256i y_coefs  = _mm256_set1_epi64x(pack_coefs(coefs->y_coefs));
+    const __m256i u_coefs  = _mm256_set1_epi64x(pack_coefs(coefs->u_coefs));
+    const __m256i v_coefs  = _mm256_set1_epi64x(pack_coefs(coefs->v_coefs));
+    const __m256i y_bias   = _mm256_set1_epi32(round + (coefs->y_offset << IMAGE_RGB_COEF_BITS));
+    const __m256i uv_bias  = _mm256_set1_epi32(round + (128 << IMAGE_RGB_COEF_BITS));
+    const __m256i zero     = _mm256_setzero_si256();
+    const __m256i a_mask   = _mm256_set1_epi32(0xff);
+    const __m128i a_shift  = _mm_cvtsi32_si128(8 * coefs->a_index);
+    const __m256i perm     = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+    unsigned int x, y;
+
+    for (y = 0; y < height; y++, src += src_stride, dst += dst_stride) {
+        for (x = 0; x + 32 <= width; x += 32) {
+            const __m256i v0 = _mm256_loadu_si256((const __m256i *)(src + 4 * x +  0));
+            const __m256i v1 = _mm256_loadu_si256((const __m256i *)(src + 4 * x + 32));
+            const __m256i v2 = _mm256_loadu_si256((const __m256i *)(src + 4 * x + 64));
+            const __m256i v3 = _mm256_loadu_si256((const __m256i *)(src + 4 * x + 96));
+            __m256i ch[4];
+
+            /* In-lane horizontal adds and packs leave pixels 0-3, 8-11,
+               16-19, 24-27 in the low lane, hence the final permute */
+#define DOT(C, S, B)                                                    \
+            _mm256_srai_epi32(_mm256_add_epi32(_mm256_hadd_epi32(       \
+                _mm256_madd_epi16(_mm256_unpacklo_epi8(S, zero), C),    \
+                _mm256_madd_epi16(_mm256_unpackhi_epi8(S, zero), C)),   \
+                B), IMAGE_RGB_COEF_BITS)
+#define PACK(A, B) _mm256_permutevar8x32_epi32(_mm256_packus_epi16(A, B), perm)
+#define CHANNEL(C, B)                                                   \
+            PACK(_mm256_packs_epi32(DOT(C, v0, B), DOT(C, v1, B)),      \
+                 _mm256_packs_epi32(DOT(C, v2, B), DOT(C, v3, B)))
+            ch[0] = CHANNEL(y_coefs, y_bias);
+            ch[1] = CHANNEL(u_coefs, uv_bias);
+            ch[2] = CHANNEL(v_coefs, uv_bias);
+#undef  CHANNEL
+#undef  DOT
+#define ALPHA(S) _mm256_and_si256(_mm256_srl_epi32(S, a_shift), a_mask)
+            ch[3] = PACK(_mm256_packs_epi32(ALPHA(v0), ALPHA(v1)),
+                         _mm256_packs_epi32(ALPHA(v2), ALPHA(v3)));
+#undef  ALPHA
+#undef  PACK
+            store_RGB32_avx2(dst + 4 * x,
+                             ch[order[0]], ch[order[1]],
+                             ch[order[2]], ch[order[3]]);
+        }
+        RGB32_to_AYUV_row(src, dst, x, width, coefs, order);
+    }
+    _mm256_zeroupper();
+}
+
+/* 8x8 blocks, rows are loaded and stored as 64-bit halves */
+void TARGET("sse2")
+image_transpose_8_sse2(
+    const uint8_t *src,
+    int            src_stride,
+    uint8_t       *dst,
+    int            dst_stride,
+    unsigned int   width,
+    unsigned int   height
+)
+{
+    unsigned int i, x, y;
+
+    for (y = 0; y + 8 <= height; y += 8) {
+        const uint8_t * const s = src + (ptrdiff_t)y * src_stride;
+        for (x = 0; x + 8 <= width; x += 8) {
+            uint8_t * const d = dst + (ptrdiff_t)x * dst_stride + y;
+            __m128i r[8], a[4], b[4], c[4];
+
+            for (i = 0; i < 8; i++)
+                r[i] = _mm_loadl_epi64((const __m128i *)
+                                       (s + (ptrdiff_t)i * src_stride + x));
+            a[0] = _mm_unpacklo_epi8(r[0], r[1]);
+            a[1] = _mm_unpacklo_epi8(r[2], r[3]);
+            a[2] = _mm_unpacklo_epi8(r[4], r[5]);
+            a[3] = _mm_unpacklo_epi8(r[6], r[7]);
+            b[0] = _mm_unpacklo_epi16(a[0], a[1]);
+            b[1] = _mm_unpackhi_epi16(a[0], a[1]);
+            b[2] = _mm_unpacklo_epi16(a[2], a[3]);
+            b[3] = _mm_unpackhi_epi16(a[2], a[3]);
+            c[0] = _mm_unpacklo_epi32(b[0], b[2]);
+            c[1] = _mm_unpackhi_epi32(b[0], b[2]);
+            c[2] = _mm_unpacklo_epi32(b[1], b[3]);
+            c[3] = _mm_unpackhi_epi32(b[1], b[3]);
+            for (i = 0; i < 4; i++) {
+                _mm_storel_epi64((__m128i *)(d + (ptrdiff_t)(2*i) * dst_stride),
+                                 c[i]);
+                _mm_storel_epi64((__m128i *)(d + (ptrdiff_t)(2*i+1) * dst_stride),
+                                 _mm_srli_si128(c[i], 8));
+            }
+        }
+    }
+    transpose_edges(src, src_stride, dst, dst_stride, width, height, 1, 8);
+}
+
+/* 8x8 blocks of 16-bit elements */
+void TARGET("sse2")
+image_transpose_16_sse2(
+    const uint8_t *src,
+    int            src_stride,
+    uint8_t       *dst,
+    int            dst_stride,
+    unsigned int   width,
+    unsigned int   height
+)
+{
+    unsigned int i, x, y;
+
+    for (y = 0; y + 8 <= height; y += 8) {
+        const uint8_t * const s = src + (ptrdiff_t)y * src_stride;
+        for (x = 0; x + 8 <= width; x += 8) {
+            uint8_t * const d = dst + (ptrdiff_t)x * dst_stride + 2 * y;
+            __m128i r[8], a[8], b[8];
+
+            for (i = 0; i < 8; i++)
+                r[i] = _mm_loadu_si128((const __m128i *)
+                                       (s + (ptrdiff_t)i * src_stride + 2 * x));
+            for (i = 0; i < 4; i++) {
+                a[2*i]   = _mm_unpacklo_epi16(r[2*i], r[2*i+1]);
+                a[2*i+1] = _mm_unpackhi_epi16(r[2*i], r[2*i+1]);
+            }
+            b[0] = _mm_unpacklo_epi32(a[0], a[2]);
+            b[1] = _mm_unpackhi_epi32(a[0], a[2]);
+            b[2] = _mm_unpacklo_epi32(a[4], a[6]);
+            b[3] = _mm_unpackhi_epi32(a[4], a[6]);
+            b[4] = _mm_unpacklo_epi32(a[1], a[3]);
+            b[5] = _mm_unpackhi_epi32(a[1], a[3]);
+            b[6] = _mm_unpacklo_epi32(a[5], a[7]);
+            b[7] = _mm_unpackhi_epi32(a[5], a[7]);
+            for (i = 0; i < 2; i++) {
+                uint8_t * const d0 = d + (ptrdiff_t)(4*i) * dst_stride;
+                _mm_storeu_si128((__m128i *)d0,
+                                 _mm_unpacklo_epi64(b[4*i],   b[4*i+2]));
+                _mm_storeu_si128((__m128i *)(d0 + dst_stride),
+                                 _mm_unpackhi_epi64(b[4*i],   b[4*i+2]));
+                _mm_storeu_si128((__m128i *)(d0 + 2 * dst_stride),
+                                 _mm_unpacklo_epi64(b[4*i+1], b[4*i+3]));
+                _mm_storeu_si128((__m128i *)(d0 + 3 * dst_stride),
+                                 _mm_unpackhi_epi64(b[4*i+1], b[4*i+3]));
+            }
+        }
+    }
+    transpose_edges(src, src_stride, dst, dst_stride, width, height, 2, 8);
+}
+
+/* 4x4 blocks of 32-bit pixels */
+void TARGET("sse2")
+image_transpose_32_sse2(
+    const uint8_t *src,
+    int            src_stride,
+    uint8_t       *dst,
+    int            dst_stride,
+    unsigned int   width,
+    unsigned int   height
+)
+{
+    unsigned int i, x, y;
+
+    for (y = 0; y + 4 <= height; y += 4) {
+        const uint8_t * const s = src + (ptrdiff_t)y * src_stride;
+        for (x = 0; x + 4 <= width; x += 4) {
+            uint8_t * const d = dst + (ptrdiff_t)x * dst_stride + 4 * y;
+            __m128i r[4], a[4];
+
+            for (i = 0; i < 4; i++)
+                r[i] = _mm_loadu_si128((const __m128i *)
+                                       (s + (ptrdiff_t)i * src_stride + 4 * x));
+            a[0] = _mm_unpacklo_epi32(r[0], r[1]);
+            a[1] = _mm_unpacklo_epi32(r[2], r[3]);
+            a[2] = _mm_unpackhi_epi32(r[0], r[1]);
+            a[3] = _mm_unpackhi_epi32(r[2], r[3]);
+            _mm_storeu_si128((__m128i *)d, _mm_unpacklo_epi64(a[0], a[1]));
+            _mm_storeu_si128((__m128i *)(d + dst_stride),
+                             _mm_unpackhi_epi64(a[0], a[1]));
+            _mm_storeu_si128((__m128i *)(d + 2 * dst_stride),
+                             _mm_unpacklo_epi64(a[2], a[3]));
+            _mm_storeu_si128((__m128i *)(d + 3 * dst_stride),
+                             _mm_unpackhi_epi64(a[2], a[3]));
+        }
+    }
+    transpose_edges(src, src_stride, dst, dst_stride, width, height, 4, 4);
+}
+
+/* 8x8 blocks of 32-bit pixels, 128-bit lanes are exchanged last */
+void TARGET("avx2")
+image_transpose_32_avx2(
+    const uint8_t *src,
+    int            src_stride,
+    uint8_t       *dst,
+    int            dst_stride,
+    unsigned int   width,
+    unsigned int   height
+)
+{
+    unsigned int i, x, y;
+
+    for (y = 0; y + 8 <= height; y += 8) {
+        const uint8_t * const s = src + (ptrdiff_t)y * src_stride;
+        for (x = 0; x + 8 <= width; x += 8) {
+            uint8_t * const d = dst + (ptrdiff_t)x * dst_stride + 4 * y;
+            __m256i r[8], a[8], b[8];
+
+            for (i = 0; i < 8; i++)
+                r[i] = _mm256_loadu_si256((const __m256i *)
+                                          (s + (ptrdiff_t)i * src_stride + 4 * x));
+            for (i = 0; i < 4; i++) {
+                a[2*i]   = _mm256_unpacklo_epi32(r[2*i], r[2*i+1]);
+                a[2*i+1] = _mm256_unpackhi_epi32(r[2*i], r[2*i+1]);
+            }
+            for (i = 0; i < 2; i++) {
+                b[4*i]   = _mm256_unpacklo_epi64(a[4*i],   a[4*i+2]);
+                b[4*i+1] = _mm256_unpackhi_epi64(a[4*i],   a[4*i+2]);
+                b[4*i+2] = _mm256_unpacklo_epi64(a[4*i+1], a[4*i+3]);
+                b[4*i+3] = _mm256_unpackhi_epi64(a[4*i+1], a[4*i+3]);
+            }
+            for (i = 0; i < 4; i++) {
+                _mm256_storeu_si256((__m256i *)(d + (ptrdiff_t)i * dst_stride),
+                                    _mm256_permute2x128_si256(b[i], b[i+4], 0x20));
+                _mm256_storeu_si256((__m256i *)(d + (ptrdiff_t)(i+4) * dst_stride),
+                                    _mm256_permute2x128_si256(b[i], b[i+4], 0x31));
+            }
+        }
+    }
+    _mm256_zeroupper();
+    transpose_edges(src, src_stride, dst, dst_stride, width, height, 4, 8);
+}
+
+/* Streaming loads fetch whole lines of write-combined memory, instead
+   of issuing one uncached read per access. They need aligned sources */
+void TARGET("sse4.1")
+image_stream_load_sse4_1(
+    uint8_t       *dst,
+    const uint8_t *src,
+    unsigned int   size
+)
+{
+    const unsigned int head = MIN(size, (16 - ((uintptr_t)src & 15)) & 15);
+    unsigned int i;
+
+    memcpy(dst, src, head);
+    src  += head;
+    dst  += head;
+    size -= head;
+
+    for (i = 0; i + 64 <= size; i += 64) {
+        __m128i * const s = (__m128i *)(src + i);
+        const __m128i v0 = _mm_stream_load_si128(s);
+        const __m128i v1 = _mm_stream_load_si128(s + 1);
+        const __m128i v2 = _mm_stream_load_si128(s + 2);
+        const __m128i v3 = _mm_stream_load_si128(s + 3);
+        _mm_storeu_si128((__m128i *)(dst + i),      v0);
+        _mm_storeu_si128((__m128i *)(dst + i + 16), v1);
+        _mm_storeu_si128((__m128i *)(dst + i + 32), v2);
+        _mm_storeu_si128((__m128i *)(dst + i + 48), v3);
+    }
+    for (; i + 16 <= size; i += 16)
+        _mm_storeu_si128((__m128i *)(dst + i),
+                         _mm_stream_load_si128((__m128i *)(src + i)));
+    memcpy(dst + i, src + i, size - i);
+}
+
+/* Byte shuffles reversing 16 bytes of 1, 2 or 4-byte elements */
+static const uint8_t mirror_masks[3][16] = {
+    { 15, 14, 13, 12, 11, 10,  9,  8,  7,  6,  5,  4,  3,  2,  1,  0 },
+    { 14, 15, 12, 13, 10, 11,  8,  9,  6,  7,  4,  5,  2,  3,  0,  1 },
+    { 12, 13, 14, 15,  8,  9, 10, 11,  4,  5,  6,  7,  0,  1,  2,  3 },
+};
+
+void TARGET("ssse3")
+image_mirror_ssse3(
+    const uint8_t *src,
+    int            src_stride,
+    uint8_t       *dst,
+    int            dst_stride,
+    unsigned int   width,
+    unsigned int   height,
+    unsigned int   bpp
+)
+{
+    const __m128i mask = _mm_loadu_si128((const __m128i *)mirror_masks[bpp >> 1]);
+    const unsigned int n = 16 / bpp;
+    unsigned int x, y;
+
+    for (y = 0; y < height; y++, src += src_stride, dst += dst_stride) {
+        for (x = 0; x + n <= width; x += n) {
+            const __m128i v = _mm_loadu_si128((const __m128i *)(src + x * bpp));
+            _mm_storeu_si128((__m128i *)(dst + (width - x - n) * bpp),
+                             _mm_shuffle_epi8(v, mask));
+        }
+        image_mirror_row(src, dst, x, width, bpp);
+    }
+}
+
+/* Rounded division by 255 of 16-bit products */
+static inline __m128i TARGET("sse2")
+div255_epu16_sse2(__m128i x)
+{
+    x = _mm_add_epi16(x, _mm_set1_epi16(128));
+    return _mm_srli_epi16(_mm_add_epi16(x, _mm_srli_epi16(x, 8)), 8);
+}
+
+void TARGET("sse2")
+image_blend_row_sse2(
+    uint8_t       *dst,
+    const uint8_t *src,
+    const uint8_t *k,
+    unsigned int   n
+)
+{
+    const __m128i zero = _mm_setzero_si128();
+    unsigned int i;
+
+    for (i = 0; i + 16 <= n; i += 16) {
+        const __m128i d  = _mm_loadu_si128((const __m128i *)(dst + i));
+        const __m128i s  = _mm_loadu_si128((const __m128i *)(src + i));
+        const __m128i kk = _mm_loadu_si128((const __m128i *)(k + i));
+        const __m128i lo = div255_epu16_sse2(
+            _mm_mullo_epi16(_mm_unpacklo_epi8(d, zero),
+                            _mm_unpacklo_epi8(kk, zero)));
+        const __m128i hi = div255_epu16_sse2(
+            _mm_mullo_epi16(_mm_unpackhi_epi8(d, zero),
+                            _mm_unpackhi_epi8(kk, zero)));
+        _mm_storeu_si128((__m128i *)(dst + i),
+                         _mm_adds_epu8(s, _mm_packus_epi16(lo, hi)));
+    }
+    image_blend_row_tail(dst, src, k, i, n);
+}
+
+static inline __m256i TARGET("avx2")
+div255_epu16_avx2(__m256i x)
+{
+    x = _mm256_add_epi16(x, _mm256_set1_epi16(128));
+    return _mm256_srli_epi16(_mm256_add_epi16(x, _mm256_srli_epi16(x, 8)), 8);
+}
+
+void TARGET("avx2")
+image_blend_row_avx2(
+    uint8_t       *dst,
+    const uint8_t *src,
+    const uint8_t *k,
+    unsigned int   n
+)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    unsigned int i;
+
+    /* Unpacks and packs both work within 128-bit lanes, which keeps
+       the bytes in order */
+    for (i = 0; i + 32 <= n; i += 32) {
+        const __m256i d  = _mm256_loadu_si256((const __m256i *)(dst + i));
+        const __m256i s  = _mm256_loadu_si256((const __m256i *)(src + i));
+        const __m256i kk = _mm256_loadu_si256((const __m256i *)(k + i));
+        const __m256i lo = div255_epu16_avx2(
+            _mm256_mullo_epi16(_mm256_unpacklo_epi8(d, zero),
+                               _mm256_unpacklo_epi8(kk, zero)));
+        const __m256i hi = div255_epu16_avx2(
+            _mm256_mullo_epi16(_mm256_unpackhi_epi8(d, zero),
+                               _mm256_unpackhi_epi8(kk, zero)));
+        _mm256_storeu_si256((__m256i *)(dst + i),
+                            _mm256_adds_epu8(s, _mm256_packus_epi16(lo, hi)));
+    }
+    _mm256_zeroupper();
+    image_blend_row_tail(dst, src, k, i, n);
+}
+
+/* Non-temporal stores write whole lines without reading them first, and
+   keep large fills from evicting the caches */
+void TARGET("sse2")
+image_fill_rect_sse2(
+    uint8_t       *dst,
+    unsigned int   dst_stride,
+    unsigned int   width,
+    unsigned int   height,
+    uint32_t       value
+)
+{
+    const __m128i v = _mm_set1_epi32(value);
+    unsigned int x, y, head;
+
+    for (y = 0; y < height; y++, dst += dst_stride) {
+        uint32_t * const d = (uint32_t *)dst;
+
+        head = MIN(width, ((16 - ((uintptr_t)d & 15)) & 15) / 4);
+        for (x = 0; x < head; x++)
+            d[x] = value;
+        for (; x + 16 <= width; x += 16) {
+            _mm_stream_si128((__m128i *)(d + x),      v);
+            _mm_stream_si128((__m128i *)(d + x + 4),  v);
+            _mm_stream_si128((__m128i *)(d + x + 8),  v);
+            _mm_stream_si128((__m128i *)(d + x + 12), v);
+        }
+        for (; x + 4 <= width; x += 4)
+            _mm_stream_si128((__m128i *)(d + x), v);
+        for (; x < width; x++)
+            d[x] = value;
+    }
+    _mm_sfence();
+}
+
+void TARGET("avx2")
+image_fill_rect_avx2(
+    uint8_t       *dst,
+    unsigned int   dst_stride,
+    unsigned int   width,
+    unsigned int   height,
+    uint32_t       value
+)
+{
+    const __m256i v = _mm256_set1_epi32(value);
+    unsigned int x, y, head;
+
+    for (y = 0; y < height; y++, dst += dst_stride) {
+        uint32_t * const d = (uint32_t *)dst;
+
+        head = MIN(width, ((32 - ((uintptr_t)d & 31)) & 31) / 4);
+        for (x = 0; x < head; x++)
+            d[x] = value;
+        for (; x + 16 <= width; x += 16) {
+            _mm256_stream_si256((__m256i *)(d + x),     v);
+            _mm256_stream_si256((__m256i *)(d + x + 8), v);
+        }
+        for (; x + 8 <= width; x += 8)
+            _mm256_stream_si256((__m256i *)(d + x), v);
+        for (; x < width; x++)
+            d[x] = value;
+    }
+    _mm_sfence();
+    _mm256_zeroupper();
+}
+#endif
+
+#if USE_SIMD_NEON
+void image_swizzle_RGB32_neon(
+    const uint8_t *src,
+    unsigned int   src_stride,
+    uint8_t       *dst,
+    unsigned int   dst_stride,
+    unsigned int   width,
+    unsigned int   height,
+    const uint8_t  perm[4]
+)
+{
+    unsigned int x, y;
+
+    /* De-interleave 16 pixels into byte planes and store them back in
+       the destination order */
+    for (y = 0; y < height; y++, src += src_stride, dst += dst_stride) {
+        for (x = 0; x + 16 <= width; x += 16) {
+            const uint8x16x4_t v = vld4q_u8(src + 4 * x);
+            uint8x16x4_t r;
+            r.val[0] = v.val[perm[0]];
+            r.val[1] = v.val[perm[1]];
+            r.val[2] = v.val[perm[2]];
+            r.val[3] = v.val[perm[3]];
+            vst4q_u8(dst + 4 * x, r);
+        }
+        swizzle_RGB32_row(src + 4 * x, dst + 4 * x, width - x, perm);
+    }
+}
+
+void image_YUV420_to_RGB32_neon(
+    const uint8_t       *y_src,
+    unsigned int         y_stride,
+    const uint8_t       *u_src,
+    const uint8_t       *v_src,
+    unsigned int         uv_stride,
+    unsigned int         uv_step,
+    uint8_t             *dst,
+    unsigned int         dst_stride,
+    unsigned int         width,
+    unsigned int         height,
+    const ImageYUVCoefs *coefs,
+    const uint8_t        order[4]
+)
+{
+    const int16x8_t bias     = vdupq_n_s16(128);
+    const int16x8_t y_offset = vdupq_n_s16(coefs->y_offset);
+    const int16x8_t y_round  = vdupq_n_s16(1 << (IMAGE_YUV_FRAC_BITS - 1));
+    const int is_nv12        = uv_step == 2 && v_src == u_src + 1;
+    const unsigned int simd_width = (uv_step == 1 || is_nv12) ? width : 0;
+    unsigned int x, y;
+
+    for (y = 0; y < height; y++) {
+        const uint8_t * const yp = y_src + y * y_stride;
+        const uint8_t * const up = u_src + (y / 2) * uv_stride;
+        const uint8_t * const vp = v_src + (y / 2) * uv_stride;
+        uint8_t * const dp = dst + y * dst_stride;
+
+        for (x = 0; x + 16 <= simd_width; x += 16) {
+            int16x8_t u, v, t, yl, yh;
+            int16x8x2_t rv, guv, bu;
+            uint8x16_t y8, ch[4];
+            uint8x16x4_t r;
+
+            if (is_nv12) {
+                const uint8x8x2_t uv = vld2_u8(up + x);
+                u = vreinterpretq_s16_u16(vmovl_u8(uv.val[0]));
+                v = vreinterpretq_s16_u16(vmovl_u8(uv.val[1]));
+            }
+            else {
+                u = vreinterpretq_s16_u16(vmovl_u8(vld1_u8(up + x/2)));
+                v = vreinterpretq_s16_u16(vmovl_u8(vld1_u8(vp + x/2)));
+            }
+            /* vqdmulh doubles the product, so inputs are scaled by one
+               bit less than with pmulhw */
+            u = vshlq_n_s16(vsubq_s16(u, bias), IMAGE_YUV_INPUT_BITS - 1);
+            v = vshlq_n_s16(vsubq_s16(v, bias), IMAGE_YUV_INPUT_BITS - 1);
+
+            /* Each chroma term is shared by two horizontal pixels */
+            t   = vqdmulhq_n_s16(v, coefs->rv_coef);
+            rv  = vzipq_s16(t, t);
+            t   = vaddq_s16(vqdmulhq_n_s16(u, coefs->gu_coef),
+                            vqdmulhq_n_s16(v, coefs->gv_coef));
+            guv = vzipq_s16(t, t);
+            t   = vqdmulhq_n_s16(u, coefs->bu_coef);
+            bu  = vzipq_s16(t, t);
+
+            y8 = vld1q_u8(yp + x);
+            yl = vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(y8)));
+            yl = vshlq_n_s16(vsubq_s16(yl, y_offset), IMAGE_YUV_INPUT_BITS - 1);
+            yl = vaddq_s16(vqdmulhq_n_s16(yl, coefs->y_coef), y_round);
+            yh = vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(y8)));
+            yh = vshlq_n_s16(vsubq_s16(yh, y_offset), IMAGE_YUV_INPUT_BITS - 1);
+            yh = vaddq_s16(vqdmulhq_n_s16(yh, coefs->y_coef), y_round);
+
+#define CHANNEL(OP, TERM)                                                       \
+            vcombine_u8(                                                        \
+                vqmovun_s16(vshrq_n_s16(OP(yl, TERM.val[0]), IMAGE_YUV_FRAC_BITS)), \
+                vqmovun_s16(vshrq_n_s16(OP(yh, TERM.val[1]), IMAGE_YUV_FRAC_BITS)))
+            ch[0] = CHANNEL(vqaddq_s16, rv);
+            ch[1] = CHANNEL(vqsubq_s16, guv);
+            ch[2] = CHANNEL(vqaddq_s16, bu);
+            ch[3] = vdupq_n_u8(0xff);
+#undef CHANNEL
+            r.val[0] = ch[order[0]];
+            r.val[1] = ch[order[1]];
+            r.val[2] = ch[order[2]];
+            r.val[3] = ch[order[3]];
+            vst4q_u8(dp + 4 * x, r);
+        }
+        YUV420_to_RGB32_row(yp, up, vp, uv_step, dp, x, width, coefs, order);
+    }
+}
+
+void image_AYUV_to_YUV444P_neon(
+    const uint8_t       *src,
+    unsigned int         src_stride,
+    uint8_t             *y_dst,
+    unsigned int         y_stride,
+    uint8_t             *u_dst,
+    uint8_t             *v_dst,
+    unsigned int         uv_stride,
+    unsigned int         width,
+    unsigned int         height,
+    const uint8_t        order[4]
+)
+{
+    uint8_t pos[4];
+    unsigned int x, y;
+
+    image_invert_order(order, pos);
+    for (y = 0; y < height; y++) {
+        for (x = 0; x + 16 <= width; x += 16) {
+            const uint8x16x4_t v = vld4q_u8(src + 4 * x);
+            vst1q_u8(y_dst + x, v.val[pos[0]]);
+            vst1q_u8(u_dst + x, v.val[pos[1]]);
+            vst1q_u8(v_dst + x, v.val[pos[2]]);
+        }
+        AYUV_to_YUV444P_row(src, y_dst, u_dst, v_dst, x, width, pos);
+        src   += src_stride;
+        y_dst += y_stride;
+        u_dst += uv_stride;
+        v_dst += uv_stride;
+    }
+}
+
+void image_YUV444P_to_AYUV_neon(
+    const uint8_t       *y_src,
+    unsigned int         y_stride,
+    const uint8_t       *u_src,
+    const uint8_t       *v_src,
+    unsigned int         uv_stride,
+    uint8_t             *dst,
+    unsigned int         dst_stride,
+    unsigned int         width,
+    unsigned int         height,
+    const uint8_t        order[4]
+)
+{
+    unsigned int x, y;
+
+    for (y = 0; y < height; y++) {
+        for (x = 0; x + 16 <= width; x += 16) {
+            uint8x16_t ch[4];
+            uint8x16x4_t r;
+            ch[0] = vld1q_u8(y_src + x);
+            ch[1] = vld1q_u8(u_src + x);
+            ch[2] = vld1q_u8(v_src + x);
+            ch[3] = vdupq_n_u8(0xff);
+            r.val[0] = ch[order[0]];
+            r.val[1] = ch[order[1]];
+            r.val[2] = ch[order[2]];
+            r.val[3] = ch[order[3]];
+            vst4q_u8(dst + 4 * x, r);
+        }
+        YUV444P_to_AYUV_row(y_src, u_src, v_src, dst, x, width, order);
+        y_src += y_stride;
+        u_src += uv_stride;
+        v_src += uv_stride;
+        dst   += dst_stride;
+    }
+}
+
+void image_RGB32_to_AYUV_neon(
+    const uint8_t       *src,
+    unsigned int         src_stride,
+    uint8_t             *dst,
+    unsigned int         dst_stride,
+    unsigned int         width,
+    unsigned int         height,
+    const ImageRGBCoefs *coefs,
+    const uint8_t        order[4]
+)
+{
+    const int16x8_t y_offset = vdupq_n_s16(coefs->y_offset);
+    const int16x8_t uv_bias  = vdupq_n_s16(128);
+    unsigned int i, x, y;
+
+    for (y = 0; y < height; y++, src += src_stride, dst += dst_stride) {
+        for (x = 0; x + 16 <= width; x += 16) {
+            const uint8x16x4_t v = vld4q_u8(src + 4 * x);
+            int16x8_t lo[4], hi[4];
+            uint8x16_t ch[4];
+            uint8x16x4_t r;
+
+            for (i = 0; i < 4; i++) {
+                lo[i] = vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(v.val[i])));
+                hi[i] = vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(v.val[i])));
+            }
+
+            /* 32-bit sums, narrowed with rounding */
+#define DOT4(S, C, HALF)                                                \
+            vmlal_n_s16(vmlal_n_s16(vmlal_n_s16(                        \
+                vmull_n_s16(HALF(S[0]), C[0]), HALF(S[1]), C[1]),       \
+                HALF(S[2]), C[2]), HALF(S[3]), C[3])
+#define DOT(S, C)                                                       \
+            vcombine_s16(                                               \
+                vqrshrn_n_s32(DOT4(S, C, vget_low_s16), IMAGE_RGB_COEF_BITS), \
+                vqrshrn_n_s32(DOT4(S, C, vget_high_s16), IMAGE_RGB_COEF_BITS))
+#define CHANNEL(C, OFFSET)                                              \
+            vcombine_u8(vqmovun_s16(vaddq_s16(DOT(lo, C), OFFSET)),     \
+                        vqmovun_s16(vaddq_s16(DOT(hi, C), OFFSET)))
+            ch[0] = CHANNEL(coefs->y_coefs, y_offset);
+            ch[1] = CHANNEL(coefs->u_coefs, uv_bias);
+            ch[2] = CHANNEL(coefs->v_coefs, uv_bias);
+            ch[3] = v.val[coefs->a_index];
+#undef  CHANNEL
+#undef  DOT
+#undef  DOT4
+            r.val[0] = ch[order[0]];
+            r.val[1] = ch[order[1]];
+            r.val[2] = ch[order[2]];
+            r.val[3] = ch[order[3]];
+            vst4q_u8(dst + 4 * x, r);
+        }
+        RGB32_to_AYUV_row(src, dst, x, width, coefs, order);
+    }
+}
+
+/* 8x8 blocks of bytes, transposed with 8, 16 then 32-bit exchanges */
+void image_transpose_8_neon(
+    const uint8_t *src,
+    int            src_stride,
+    uint8_t       *dst,
+    int            dst_stride,
+    unsigned int   width,
+    unsigned int   height
+)
+{
+    unsigned int i, x, y;
+
+    for (y = 0; y + 8 <= height; y += 8) {
+        const uint8_t * const s = src + (ptrdiff_t)y * src_stride;
+        for (x = 0; x + 8 <= width; x += 8) {
+            uint8_t * const d = dst + (ptrdiff_t)x * dst_stride + y;
+            uint8x8_t r[8];
+            uint8x8x2_t a[4];
+            uint16x4x2_t b[4];
+            uint32x2x2_t c[4];
+
+            for (i = 0; i < 8; i++)
+                r[i] = vld1_u8(s + (ptrdiff_t)i * src_stride + x);
+            for (i = 0; i < 4; i++)
+                a[i] = vtrn_u8(r[2*i], r[2*i+1]);
+            for (i = 0; i < 2; i++) {
+                b[2*i]   = vtrn_u16(vreinterpret_u16_u8(a[2*i].val[0]),
+                                    vreinterpret_u16_u8(a[2*i+1].val[0]));
+                b[2*i+1] = vtrn_u16(vreinterpret_u16_u8(a[2*i].val[1]),
+                                    vreinterpret_u16_u8(a[2*i+1].val[1]));
+            }
+            /* c[0]: columns 0, 4; c[1]: 1, 5; c[2]: 2, 6; c[3]: 3, 7 */
+            for (i = 0; i < 2; i++) {
+                c[2*i]   = vtrn_u32(vreinterpret_u32_u16(b[0].val[i]),
+                                    vreinterpret_u32_u16(b[2].val[i]));
+                c[2*i+1] = vtrn_u32(vreinterpret_u32_u16(b[1].val[i]),
+                                    vreinterpret_u32_u16(b[3].val[i]));
+            }
+            for (i = 0; i < 4; i++) {
+                vst1_u8(d + (ptrdiff_t)i * dst_stride,
+                        vreinterpret_u8_u32(c[i].val[0]));
+                vst1_u8(d + (ptrdiff_t)(i+4) * dst_stride,
+                        vreinterpret_u8_u32(c[i].val[1]));
+            }
+        }
+    }
+    transpose_edges(src, src_stride, dst, dst_stride, width, height, 1, 8);
+}
+
+/* 4x4 blocks of 16-bit elements */
+void image_transpose_16_neon(
+    const uint8_t *src,
+    int            src_stride,
+    uint8_t       *dst,
+    int            dst_stride,
+    unsigned int   width,
+    unsigned int   height
+)
+{
+    unsigned int i, x, y;
+
+    for (y = 0; y + 4 <= height; y += 4) {
+        const uint8_t * const s = src + (ptrdiff_t)y * src_stride;
+        for (x = 0; x + 4 <= width; x += 4) {
+            uint8_t * const d = dst + (ptrdiff_t)x * dst_stride + 2 * y;
+            uint16x4_t r[4];
+            uint16x4x2_t a[2];
+            uint32x2x2_t c[2];
+
+            for (i = 0; i < 4; i++)
+                r[i] = vld1_u16((const uint16_t *)
+                                (s + (ptrdiff_t)i * src_stride + 2 * x));
+            a[0] = vtrn_u16(r[0], r[1]);
+            a[1] = vtrn_u16(r[2], r[3]);
+            c[0] = vtrn_u32(vreinterpret_u32_u16(a[0].val[0]),
+                            vreinterpret_u32_u16(a[1].val[0]));
+            c[1] = vtrn_u32(vreinterpret_u32_u16(a[0].val[1]),
+                            vreinterpret_u32_u16(a[1].val[1]));
+            vst1_u16((uint16_t *)d, vreinterpret_u16_u32(c[0].val[0]));
+            vst1_u16((uint16_t *)(d + dst_stride),
+                     vreinterpret_u16_u32(c[1].val[0]));
+            vst1_u16((uint16_t *)(d + 2 * dst_stride),
+                     vreinterpret_u16_u32(c[0].val[1]));
+            vst1_u16((uint16_t *)(d + 3 * dst_stride),
+                     vreinterpret_u16_u32(c[1].val[1]));
+        }
+    }
+    transpose_edges(src, src_stride, dst, dst_stride, width, height, 2, 4);
+}
+
+/* 4x4 blocks of 32-bit pixels */
+void image_transpose_32_neon(
+    const uint8_t *src,
+    int            src_stride,
+    uint8_t       *dst,
+    int            dst_stride,
+    unsigned int   width,
+    unsigned int   height
+)
+{
+    unsigned int i, x, y;
+
+    for (y = 0; y + 4 <= height; y += 4) {
+        const uint8_t * const s = src + (ptrdiff_t)y * src_stride;
+        for (x = 0; x + 4 <= width; x += 4) {
+            uint8_t * const d = dst + (ptrdiff_t)x * dst_stride + 4 * y;
+            uint32x4_t r[4];
+            uint32x4x2_t a[2];
+
+            for (i = 0; i < 4; i++)
+                r[i] = vld1q_u32((const uint32_t *)
+                                 (s + (ptrdiff_t)i * src_stride + 4 * x));
+            a[0] = vtrnq_u32(r[0], r[1]);
+            a[1] = vtrnq_u32(r[2], r[3]);
+            vst1q_u32((uint32_t *)d,
+                      vcombine_u32(vget_low_u32(a[0].val[0]),
+                                   vget_low_u32(a[1].val[0])));
+            vst1q_u32((uint32_t *)(d + dst_stride),
+                      vcombine_u32(vget_low_u32(a[0].val[1]),
+                                   vget_low_u32(a[1].val[1])));
+            vst1q_u32((uint32_t *)(d + 2 * dst_stride),
+                      vcombine_u32(vget_high_u32(a[0].val[0]),
+                                   vget_high_u32(a[1].val[0])));
+            vst1q_u32((uint32_t *)(d + 3 * dst_stride),
+                      vcombine_u32(vget_high_u32(a[0].val[1]),
+                                   vget_high_u32(a[1].val[1])));
+        }
+    }
+    transpose_edges(src, src_stride, dst, dst_stride, width, height, 4, 4);
+}
+
+void image_mirror_neon(
+    const uint8_t *src,
+    int            src_stride,
+    uint8_t       *dst,
+    int            dst_stride,
+    unsigned int   width,
+    unsigned int   height,
+    unsigned int   bpp
+)
+{
+    const unsigned int n = 16 / bpp;
+    unsigned int x, y;
+
+    for (y = 0; y < height; y++, src += src_stride, dst += dst_stride) {
+        for (x = 0; x + n <= width; x += n) {
+            uint8x16_t v = vld1q_u8(src + x * bpp);
+            switch (bpp) {
+            case 1: v = vrev64q_u8(v); break;
+            case 2: v = vreinterpretq_u8_u16(vrev64q_u16(vreinterpretq_u16_u8(v))); break;
+            case 4: v = vreinterpretq_u8_u32(vrev64q_u32(vreinterpretq_u32_u8(v))); break;
+            }
+            vst1q_u8(dst + (width - x - n) * bpp, vextq_u8(v, v, 8));
+        }
+        image_mirror_row(src, dst, x, width, bpp);
+    }
+}
+
+void image_blend_row_neon(
+    uint8_t       *dst,
+    const uint8_t *src,
+    const uint8_t *k,
+    unsigned int   n
+)
+{
+    unsigned int i;
+
+    for (i = 0; i + 16 <= n; i += 16) {
+        const uint8x16_t d  = vld1q_u8(dst + i);
+        const uint8x16_t kk = vld1q_u8(k + i);
+        const uint16x8_t lo = vmull_u8(vget_low_u8(d),  vget_low_u8(kk));
+        const uint16x8_t hi = vmull_u8(vget_high_u8(d), vget_high_u8(kk));
+
+        /* (x + 128 + ((x + 128) >> 8)) >> 8 */
+        const uint8x16_t r  = vcombine_u8(
+            vraddhn_u16(lo, vrshrq_n_u16(lo, 8)),
+            vraddhn_u16(hi, vrshrq_n_u16(hi, 8)));
+        vst1q_u8(dst + i, vqaddq_u8(vld1q_u8(src + i), r));
+    }
+    image_blend_row_tail(dst, src, k, i, n);
+}
+
+/* There are no non-temporal store intrinsics, plain stores are used */
+void image_fill_rect_neon(
+    uint8_t       *dst,
+    unsigned int   dst_stride,
+    unsigned int   width,
+    unsigned int   height,
+    uint32_t       value
+)
+{
+    const uint32x4_t v = vdupq_n_u32(value);
+    unsigned int x, y;
+
+    for (y = 0; y < height; y++, dst += dst_stride) {
+        uint32_t * const d = (uint32_t *)dst;
+
+        for (x = 0; x + 16 <= width; x += 16) {
+            vst1q_u32(d + x,      v);
+            vst1q_u32(d + x + 4,  v);
+            vst1q_u32(d + x + 8,  v);
+            vst1q_u32(d + x + 12, v);
+        }
+        for (; x + 4 <= width; x += 4)
+            vst1q_u32(d + x, v);
+        for (; x < width; x++)
+            d[x] = value;
+    }
+}
+#endif
@@ -0,0 +1,398 @@
+/*
+ *  image_simd.h - SIMD optimized image kernels
+ *
+ *  hwdecode-demos (C) 2009-2010 Splitted-Desktop Systems
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef IMAGE_SIMD_H
+#define IMAGE_SIMD_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "cpu.h"
+
+/* Reorders the bytes of each 32-bit pixel so that dst[i] = src[perm[i]] */
+typedef void (*image_swizzle_RGB32_func)(
+    const uint8_t *src,
+    unsigned int   src_stride,
+    uint8_t       *dst,
+    unsigned int   dst_stride,
+    unsigned int   width,
+    unsigned int   height,
+    const uint8_t  perm[4]
+);
+
+/* Fixed-point YUV to RGB coefficients, scaled by 1 << IMAGE_YUV_COEF_BITS.
+   Inputs are scaled by 1 << IMAGE_YUV_INPUT_BITS and multiplied by the
+   coefficients keeping the high 16 bits only, as pmulhw does. So terms
+   have IMAGE_YUV_FRAC_BITS fractional bits */
+#define IMAGE_YUV_COEF_BITS  13
+#define IMAGE_YUV_INPUT_BITS 7
+#define IMAGE_YUV_FRAC_BITS  (IMAGE_YUV_COEF_BITS + IMAGE_YUV_INPUT_BITS - 16)
+
+typedef struct _ImageYUVCoefs ImageYUVCoefs;
+
+struct _ImageYUVCoefs {
+    int16_t             y_offset;
+    int16_t             y_coef;
+    int16_t             rv_coef;
+    int16_t             gu_coef;
+    int16_t             gv_coef;
+    int16_t             bu_coef;
+};
+
+/* Converts 4:2:0 YUV to 32-bit RGB. Chroma samples are uv_step bytes
+   apart (1 for planar formats, 2 for NV12). The dst[i] byte of each
+   pixel receives the R, G, B or A component selected by order[i] */
+typedef void (*image_YUV420_to_RGB32_func)(
+    const uint8_t       *y_src,
+    unsigned int         y_stride,
+    const uint8_t       *u_src,
+    const uint8_t       *v_src,
+    unsigned int         uv_stride,
+    unsigned int         uv_step,
+    uint8_t             *dst,
+    unsigned int         dst_stride,
+    unsigned int         width,
+    unsigned int         height,
+    const ImageYUVCoefs *coefs,
+    const uint8_t        order[4]
+);
+
+static inline int image_clip_uint8(int v)
+{
+    return v < 0 ? 0 : (v > 255 ? 255 : v);
+}
+
+/* Returns the high 16 bits of the scaled input V times COEF */
+static inline int image_YUV_mulhi(int v, int coef)
+{
+    return (v * (1 << IMAGE_YUV_INPUT_BITS) * coef) >> 16;
+}
+
+/* Reference conversion of a single pixel, SIMD kernels match it exactly */
+static inline void
+image_YUV_to_RGB32_pixel(
+    int                  y,
+    int                  u,
+    int                  v,
+    const ImageYUVCoefs *c,
+    const uint8_t        order[4],
+    uint8_t             *dst
+)
+{
+    const int yy = image_YUV_mulhi(y - c->y_offset, c->y_coef) +
+        (1 << (IMAGE_YUV_FRAC_BITS - 1));
+    const int guv = image_YUV_mulhi(u - 128, c->gu_coef) +
+        image_YUV_mulhi(v - 128, c->gv_coef);
+    uint8_t rgba[4];
+
+    rgba[0] = image_clip_uint8((yy + image_YUV_mulhi(v - 128, c->rv_coef)) >> IMAGE_YUV_FRAC_BITS);
+    rgba[1] = image_clip_uint8((yy - guv) >> IMAGE_YUV_FRAC_BITS);
+    rgba[2] = image_clip_uint8((yy + image_YUV_mulhi(u - 128, c->bu_coef)) >> IMAGE_YUV_FRAC_BITS);
+    rgba[3] = 0xff;
+    dst[0] = rgba[order[0]];
+    dst[1] = rgba[order[1]];
+    dst[2] = rgba[order[2]];
+    dst[3] = rgba[order[3]];
+}
+
+/* Fixed-point RGB to YUV coefficients, scaled by 1 << IMAGE_RGB_COEF_BITS.
+   Coefficients are indexed by the byte position in the source pixel */
+#define IMAGE_RGB_COEF_BITS 13
+
+typedef struct _ImageRGBCoefs ImageRGBCoefs;
+
+struct _ImageRGBCoefs {
+    int16_t             y_coefs[4];
+    int16_t             u_coefs[4];
+    int16_t             v_coefs[4];
+    int16_t             y_offset;
+    uint8_t             a_index;
+};
+
+/* AYUV kernels: order[i] selects the Y (0), U (1), V (2) or A (3)
+   component held in byte i of each AYUV pixel */
+typedef void (*image_AYUV_to_YUV444P_func)(
+    const uint8_t       *src,
+    unsigned int         src_stride,
+    uint8_t             *y_dst,
+    unsigned int         y_stride,
+    uint8_t             *u_dst,
+    uint8_t             *v_dst,
+    unsigned int         uv_stride,
+    unsigned int         width,
+    unsigned int         height,
+    const uint8_t        order[4]
+);
+
+/* Alpha is set to 0xff */
+typedef void (*image_YUV444P_to_AYUV_func)(
+    const uint8_t       *y_src,
+    unsigned int         y_stride,
+    const uint8_t       *u_src,
+    const uint8_t       *v_src,
+    unsigned int         uv_stride,
+    uint8_t             *dst,
+    unsigned int         dst_stride,
+    unsigned int         width,
+    unsigned int         height,
+    const uint8_t        order[4]
+);
+
+/* Alpha is copied from the source pixel */
+typedef void (*image_RGB32_to_AYUV_func)(
+    const uint8_t       *src,
+    unsigned int         src_stride,
+    uint8_t             *dst,
+    unsigned int         dst_stride,
+    unsigned int         width,
+    unsigned int         height,
+    const ImageRGBCoefs *coefs,
+    const uint8_t        order[4]
+);
+
+/* Reference conversion of a single pixel, SIMD kernels match it exactly */
+static inline void
+image_RGB32_to_AYUV_pixel(
+    const uint8_t       *src,
+    const ImageRGBCoefs *c,
+    const uint8_t        order[4],
+    uint8_t             *dst
+)
+{
+    const int round = 1 << (IMAGE_RGB_COEF_BITS - 1);
+    int y, u, v;
+    uint8_t yuva[4];
+
+    y = src[0] * c->y_coefs[0] + src[1] * c->y_coefs[1] +
+        src[2] * c->y_coefs[2] + src[3] * c->y_coefs[3];
+    u = src[0] * c->u_coefs[0] + src[1] * c->u_coefs[1] +
+        src[2] * c->u_coefs[2] + src[3] * c->u_coefs[3];
+    v = src[0] * c->v_coefs[0] + src[1] * c->v_coefs[1] +
+        src[2] * c->v_coefs[2] + src[3] * c->v_coefs[3];
+    yuva[0] = image_clip_uint8(((y + round) >> IMAGE_RGB_COEF_BITS) + c->y_offset);
+    yuva[1] = image_clip_uint8(((u + round) >> IMAGE_RGB_COEF_BITS) + 128);
+    yuva[2] = image_clip_uint8(((v + round) >> IMAGE_RGB_COEF_BITS) + 128);
+    yuva[3] = src[c->a_index];
+    dst[0] = yuva[order[0]];
+    dst[1] = yuva[order[1]];
+    dst[2] = yuva[order[2]];
+    dst[3] = yuva[order[3]];
+}
+
+/* Computes pos[c], the byte index of component c, from order[] */
+static inline void
+image_invert_order(const uint8_t order[4], uint8_t pos[4])
+{
+    unsigned int i;
+
+    for (i = 0; i < 4; i++)
+        pos[order[i]] = i;
+}
+
+/* Copies SIZE bytes from src to dst */
+typedef void (*image_stream_load_func)(
+    uint8_t             *dst,
+    const uint8_t       *src,
+    unsigned int         size
+);
+
+/* Transposes a WxH block of 8, 16 or 32-bit elements, so that element
+   (x,y) of src lands at (y,x) in dst. Strides are signed so that callers
+   can flip either side, which gives 90 and 270 degree rotations */
+typedef void (*image_transpose_func)(
+    const uint8_t       *src,
+    int                  src_stride,
+    uint8_t             *dst,
+    int                  dst_stride,
+    unsigned int         width,
+    unsigned int         height
+);
+
+/* Reverses the order of the WIDTH bpp-byte elements of each row */
+typedef void (*image_mirror_func)(
+    const uint8_t       *src,
+    int                  src_stride,
+    uint8_t             *dst,
+    int                  dst_stride,
+    unsigned int         width,
+    unsigned int         height,
+    unsigned int         bpp
+);
+
+/* Composites N premultiplied bytes over dst: dst = src + dst * k / 255,
+   where k is 255 minus the alpha of the overlay covering each byte */
+typedef void (*image_blend_row_func)(
+    uint8_t             *dst,
+    const uint8_t       *src,
+    const uint8_t       *k,
+    unsigned int         n
+);
+
+/* Fills a WxH rectangle of 32-bit aligned pixels with VALUE. SIMD
+   kernels use non-temporal stores, fenced before returning */
+typedef void (*image_fill_rect_func)(
+    uint8_t             *dst,
+    unsigned int         dst_stride,
+    unsigned int         width,
+    unsigned int         height,
+    uint32_t             value
+);
+
+/* Rounded x / 255, exact for x in [0, 255 * 255] */
+static inline unsigned int image_div255(unsigned int x)
+{
+    x += 128;
+    return (x + (x >> 8)) >> 8;
+}
+
+/* Reference blend of bytes i to N - 1, SIMD kernels use it for the tail */
+static inline void
+image_blend_row_tail(
+    uint8_t             *dst,
+    const uint8_t       *src,
+    const uint8_t       *k,
+    unsigned int         i,
+    unsigned int         n
+)
+{
+    for (; i < n; i++)
+        dst[i] = MIN(src[i] + image_div255(dst[i] * k[i]), 255);
+}
+
+/* Reference transpose, SIMD kernels use it for the block edges */
+static inline void
+image_transpose_block(
+    const uint8_t       *src,
+    int                  src_stride,
+    uint8_t             *dst,
+    int                  dst_stride,
+    unsigned int         width,
+    unsigned int         height,
+    unsigned int         bpp
+)
+{
+    unsigned int x, y;
+
+    for (y = 0; y < height; y++, src += src_stride) {
+        uint8_t *d = dst + y * bpp;
+        for (x = 0; x < width; x++, d += dst_stride) {
+            switch (bpp) {
+            case 1: d[0] = src[x]; break;
+            case 2: memcpy(d, src + 2 * x, 2); break;
+            case 4: memcpy(d, src + 4 * x, 4); break;
+            }
+        }
+    }
+}
+
+/* Reference mirror of a row, SIMD kernels use it for the row edges.
+   Elements x to WIDTH - 1 of src are mirrored to dst */
+static inline void
+image_mirror_row(
+    const uint8_t       *src,
+    uint8_t             *dst,
+    unsigned int         x,
+    unsigned int         width,
+    unsigned int         bpp
+)
+{
+    for (; x < width; x++)
+        memcpy(dst + (width - 1 - x) * bpp, src + x * bpp, bpp);
+}
+
+#define IMAGE_AYUV_TO_YUV444P_ARGS                                      \
+    const uint8_t *, unsigned int, uint8_t *, unsigned int,             \
+    uint8_t *, uint8_t *, unsigned int, unsigned int, unsigned int,     \
+    const uint8_t [4]
+
+#define IMAGE_YUV444P_TO_AYUV_ARGS                                      \
+    const uint8_t *, unsigned int, const uint8_t *, const uint8_t *,    \
+    unsigned int, uint8_t *, unsigned int, unsigned int, unsigned int,  \
+    const uint8_t [4]
+
+#define IMAGE_RGB32_TO_AYUV_ARGS                                        \
+    const uint8_t *, unsigned int, uint8_t *, unsigned int,             \
+    unsigned int, unsigned int, const ImageRGBCoefs *, const uint8_t [4]
+
+#define IMAGE_YUV420_TO_RGB32_ARGS                                      \
+    const uint8_t *, unsigned int, const uint8_t *, const uint8_t *,    \
+    unsigned int, unsigned int, uint8_t *, unsigned int,                \
+    unsigned int, unsigned int, const ImageYUVCoefs *, const uint8_t [4]
+
+#define IMAGE_TRANSPOSE_ARGS                                            \
+    const uint8_t *, int, uint8_t *, int, unsigned int, unsigned int
+
+#define IMAGE_MIRROR_ARGS                                               \
+    const uint8_t *, int, uint8_t *, int, unsigned int, unsigned int,   \
+    unsigned int
+
+#define IMAGE_BLEND_ROW_ARGS                                            \
+    uint8_t *, const uint8_t *, const uint8_t *, unsigned int
+
+#define IMAGE_FILL_RECT_ARGS                                            \
+    uint8_t *, unsigned int, unsigned int, unsigned int, uint32_t
+
+#if USE_SIMD_X86
+void image_swizzle_RGB32_sse2(const uint8_t *, unsigned int, uint8_t *,
+                              unsigned int, unsigned int, unsigned int,
+                              const uint8_t [4]);
+void image_swizzle_RGB32_ssse3(const uint8_t *, unsigned int, uint8_t *,
+                               unsigned int, unsigned int, unsigned int,
+                               const uint8_t [4]);
+void image_swizzle_RGB32_avx2(const uint8_t *, unsigned int, uint8_t *,
+                              unsigned int, unsigned int, unsigned int,
+                              const uint8_t [4]);
+void image_YUV420_to_RGB32_sse2(IMAGE_YUV420_TO_RGB32_ARGS);
+void image_YUV420_to_RGB32_avx2(IMAGE_YUV420_TO_RGB32_ARGS);
+void image_AYUV_to_YUV444P_ssse3(IMAGE_AYUV_TO_YUV444P_ARGS);
+void image_AYUV_to_YUV444P_avx2(IMAGE_AYUV_TO_YUV444P_ARGS);
+void image_YUV444P_to_AYUV_sse2(IMAGE_YUV444P_TO_AYUV_ARGS);
+void image_YUV444P_to_AYUV_avx2(IMAGE_YUV444P_TO_AYUV_ARGS);
+void image_RGB32_to_AYUV_ssse3(IMAGE_RGB32_TO_AYUV_ARGS);
+void image_RGB32_to_AYUV_avx2(IMAGE_RGB32_TO_AYUV_ARGS);
+void image_transpose_8_sse2(IMAGE_TRANSPOSE_ARGS);
+void image_transpose_16_sse2(IMAGE_TRANSPOSE_ARGS);
+void image_transpose_32_sse2(IMAGE_TRANSPOSE_ARGS);
+void image_transpose_32_avx2(IMAGE_TRANSPOSE_ARGS);
+void image_mirror_ssse3(IMAGE_MIRROR_ARGS);
+void image_stream_load_sse4_1(uint8_t *, const uint8_t *, unsigned int);
+void image_blend_row_sse2(IMAGE_BLEND_ROW_ARGS);
+void image_blend_row_avx2(IMAGE_BLEND_ROW_ARGS);
+void image_fill_rect_sse2(IMAGE_FILL_RECT_ARGS);
+void image_fill_rect_avx2(IMAGE_FILL_RECT_ARGS);
+#endif
+
+#if USE_SIMD_NEON
+void image_swizzle_RGB32_neon(const uint8_t *, unsigned int, uint8_t *,
+                              unsigned int, unsigned int, unsigned int,
+                              const uint8_t [4]);
+void image_YUV420_to_RGB32_neon(IMAGE_YUV420_TO_RGB32_ARGS);
+void image_AYUV_to_YUV444P_neon(IMAGE_AYUV_TO_YUV444P_ARGS);
+void image_YUV444P_to_AYUV_neon(IMAGE_YUV444P_TO_AYUV_ARGS);
+void image_RGB32_to_AYUV_neon(IMAGE_RGB32_TO_AYUV_ARGS);
+void image_transpose_8_neon(IMAGE_TRANSPOSE_ARGS);
+void image_transpose_16_neon(IMAGE_TRANSPOSE_ARGS);
+void image_transpose_32_neon(IMAGE_TRANSPOSE_ARGS);
+void image_mirror_neon(IMAGE_MIRROR_ARGS);
+void image_blend_row_neon(IMAGE_BLEND_ROW_ARGS);
+void image_fill_rect_neon(IMAGE_FILL_RECT_ARGS);
+#endif
+
+#endif /* IMAGE_SIMD_H */
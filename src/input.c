@@ -0,0 +1,128 @@
+/*
+ *  input.c - Input files
+ *
+ *  hwdecode-demos (C) 2009-2010 Splitted-Desktop Systems
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "sysdeps.h"
+#include "input.h"
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+/* Input pages are prefetched ahead of the reader, and dropped behind it,
+   by windows of that size. This keeps the resident size of the input
+   bounded, whatever the file size */
+#define INPUT_WINDOW_SIZE (8 << 20)
+
+typedef struct _Input Input;
+
+struct _Input {
+    uint8_t            *data;
+    size_t              size;
+    size_t              released;       // end of the dropped pages
+    size_t              prefetched;     // end of the prefetched pages
+};
+
+static Input g_input;
+
+int input_open(const char *filename)
+{
+    Input * const input = &g_input;
+    struct stat st;
+    void *data;
+    int fd;
+
+    input_close();
+
+    fd = open(filename, O_RDONLY);
+    if (fd < 0)
+        return -1;
+    if (fstat(fd, &st) < 0 || !S_ISREG(st.st_mode) || st.st_size == 0) {
+        close(fd);
+        return -1;
+    }
+
+    /* 32-bit hosts cannot map files of 4 GiB or more */
+    if ((uint64_t)st.st_size > SIZE_MAX) {
+        fprintf(stderr, "ERROR: input file '%s' is too large to be mapped\n",
+                filename);
+        close(fd);
+        return -1;
+    }
+    data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED)
+        return -1;
+
+    input->data       = data;
+    input->size       = st.st_size;
+    input->released   = 0;
+    input->prefetched = MIN(input->size, 2 * INPUT_WINDOW_SIZE);
+    madvise(input->data, input->size, MADV_SEQUENTIAL);
+    madvise(input->data, input->prefetched, MADV_WILLNEED);
+    return 0;
+}
+
+void input_close(void)
+{
+    Input * const input = &g_input;
+
+    if (input->data)
+        munmap(input->data, input->size);
+    memset(input, 0, sizeof(*input));
+}
+
+int input_get_data(const uint8_t **data, size_t *size)
+{
+    Input * const input = &g_input;
+
+    if (!input->data)
+        return 0;
+    *data = input->data;
+    *size = input->size;
+    return 1;
+}
+
+void input_release(const uint8_t *data)
+{
+    Input * const input = &g_input;
+    size_t offset, end;
+
+    if (!input->data || data < input->data || data > input->data + input->size)
+        return;
+    offset = data - input->data;
+
+    /* Keep the window that holds DATA, and the previous one, since the
+       reader may still refer to the end of its last picture */
+    end = offset / INPUT_WINDOW_SIZE;
+    end = end > 0 ? (end - 1) * INPUT_WINDOW_SIZE : 0;
+    if (end > input->released) {
+        madvise(input->data + input->released, end - input->released,
+                MADV_DONTNEED);
+        input->released = end;
+    }
+
+    /* Prefetch the next window */
+    end = MIN(input->size, (offset / INPUT_WINDOW_SIZE + 2) * INPUT_WINDOW_SIZE);
+    if (end > input->prefetched) {
+        madvise(input->data + input->prefetched, end - input->prefetched,
+                MADV_WILLNEED);
+        input->prefetched = end;
+    }
+}
@@ -0,0 +1,39 @@
+/*
+ *  input.h - Input files
+ *
+ *  hwdecode-demos (C) 2009-2010 Splitted-Desktop Systems
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef INPUT_H
+#define INPUT_H
+
+// Maps FILENAME as the video data of the demos, in place of their
+// built-in clips
+int input_open(const char *filename);
+
+// Unmaps the input file, if any
+void input_close(void);
+
+// Returns 1 and the contents of the input file, or 0 if there is none
+int input_get_data(const uint8_t **data, size_t *size);
+
+// Tells that the input data before DATA will not be read again, so that
+// its pages can be dropped as reading goes on. This is a no-op if DATA is
+// not in the input file
+void input_release(const uint8_t *data);
+
+#endif /* INPUT_H */
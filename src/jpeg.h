@@ -25,6 +25,8 @@ typedef struct _JPEGPictureInfo         JPEGPictureInfo;
 typedef struct _JPEGIQMatrix            JPEGIQMatrix;
 typedef struct _JPEGHuffmanTable        JPEGHuffmanTable;
 typedef struct _JPEGSliceInfo           JPEGSliceInfo;
+typedef struct _JPEGPicture             JPEGPicture;
+typedef struct _JPEGParser              JPEGParser;
 
 struct _JPEGPictureInfo {
     unsigned short      width;
@@ -70,7 +72,39 @@ struct _JPEGSliceInfo {
     unsigned int        num_mcus;
 };
 
-void jpeg_get_video_data(const uint8_t **data, unsigned int *size);
+// An image, with a slice per restart interval of each scan. Slice data
+// excludes the RSTn markers. Progressive images are parsed, but their
+// scans cannot be described to a baseline decoder
+struct _JPEGPicture {
+    JPEGPictureInfo     pic_info;
+    JPEGIQMatrix        iq_matrix;
+    JPEGHuffmanTable    huf_table;
+    const uint8_t      *data;           // the image, from its SOI marker
+    unsigned int        data_size;
+    JPEGSliceInfo      *slices;         // offsets are relative to data
+    unsigned int        slice_count;
+    unsigned int        num_scans;
+    unsigned int        is_progressive;
+    unsigned int        frame_num;      // index of the image in the input
+};
+
+// Creates a parser over the SIZE bytes of a JPEG image, or of an MJPEG
+// stream of concatenated images, in BUF, which must outlive the parser
+JPEGParser *jpeg_parser_new(const uint8_t *buf, size_t size);
+
+// Creates a parser over the .jpg and .jpeg files of DIRNAME, in name
+// order. Each file is mapped in turn, until the next image is parsed
+JPEGParser *jpeg_parser_open_dir(const char *dirname);
+void jpeg_parser_destroy(JPEGParser *parser);
+
+// Parses the next image. Returns 1 if PICTURE was filled in, 0 at the end
+// of the input, or -1 on error. PICTURE->data and PICTURE->slices remain
+// valid until the next call
+int jpeg_parser_get_picture(JPEGParser *parser, JPEGPicture *picture);
+
+void jpeg_get_video_data(const uint8_t **data, size_t *size);
+
+// Accessors to the first image of the video data
 void jpeg_get_picture_info(JPEGPictureInfo *pic_info);
 void jpeg_get_iq_matrix(JPEGIQMatrix *iq_matrix);
 void jpeg_get_huf_table(JPEGHuffmanTable *huf_table);
@@ -0,0 +1,636 @@
+/*
+ *  mp4.c - Memory-mapped ISO-BMFF (MP4) demuxer
+ *
+ *  hwdecode-demos (C) 2009-2010 Splitted-Desktop Systems
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "sysdeps.h"
+#include "mp4.h"
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#define DEBUG 1
+#include "debug.h"
+
+struct _MP4Demuxer {
+    const uint8_t      *data;
+    size_t              size;
+    unsigned int        is_mapped;
+    MP4TrackInfo        track;
+
+    /* Sample index, as a structure of arrays */
+    uint64_t           *offsets;
+    uint32_t           *sizes;
+    int64_t            *dts;
+    int32_t            *cts_offsets;    // NULL if there is no ctts box
+    uint32_t           *keyframes;      // NULL if all samples are keyframes
+    unsigned int        num_keyframes;
+};
+
+typedef struct _MP4Box MP4Box;
+
+struct _MP4Box {
+    uint32_t            type;
+    const uint8_t      *data;           // payload, after the box header
+    uint64_t            size;
+};
+
+static inline uint32_t get16(const uint8_t *ptr)
+{
+    return ((uint32_t)ptr[0] << 8) | ptr[1];
+}
+
+static inline uint32_t get32(const uint8_t *ptr)
+{
+    return (((uint32_t)ptr[0] << 24) | ((uint32_t)ptr[1] << 16) |
+            ((uint32_t)ptr[2] <<  8) |  (uint32_t)ptr[3]);
+}
+
+static inline uint64_t get64(const uint8_t *ptr)
+{
+    return ((uint64_t)get32(ptr) << 32) | get32(ptr + 4);
+}
+
+/* Reads the box at *PPTR and moves past it */
+static int next_box(const uint8_t **pptr, const uint8_t *end, MP4Box *box)
+{
+    const uint8_t * const ptr = *pptr;
+    uint64_t size, header_size = 8;
+
+    if (end - ptr < 8)
+        return -1;
+
+    size      = get32(ptr);
+    box->type = get32(ptr + 4);
+    if (size == 1) {
+        if (end - ptr < 16)
+            return -1;
+        size        = get64(ptr + 8);
+        header_size = 16;
+    }
+    else if (size == 0)
+        size = end - ptr;
+    if (size < header_size || size > (uint64_t)(end - ptr))
+        return -1;
+
+    box->data = ptr + header_size;
+    box->size = size - header_size;
+    *pptr     = ptr + size;
+    return 0;
+}
+
+/* Finds the first child box of TYPE in the SIZE bytes of DATA */
+static int
+find_box(const uint8_t *data, uint64_t size, uint32_t type, MP4Box *box)
+{
+    const uint8_t *ptr = data;
+
+    while (next_box(&ptr, data + size, box) == 0) {
+        if (box->type == type)
+            return 0;
+    }
+    return -1;
+}
+
+static inline int find_child_box(const MP4Box *parent, uint32_t type, MP4Box *box)
+{
+    return find_box(parent->data, parent->size, type, box);
+}
+
+/* Returns the entries of a full box table whose 32-bit entry count ends
+   at HEADER_SIZE, or NULL if the table does not fit in the box */
+static const uint8_t *
+get_table(const MP4Box *box, unsigned int header_size, unsigned int entry_size,
+          uint32_t *pcount)
+{
+    uint32_t count;
+
+    if (box->size < header_size)
+        return NULL;
+    count = get32(box->data + header_size - 4);
+    if ((uint64_t)count * entry_size > box->size - header_size)
+        return NULL;
+    *pcount = count;
+    return box->data + header_size;
+}
+
+/* Reads an MPEG-4 descriptor header (ISO/IEC 14496-1, 8.3.3) */
+static int
+read_descriptor(const uint8_t **pptr, const uint8_t *end,
+                unsigned int *ptag, unsigned int *plength)
+{
+    const uint8_t *ptr = *pptr;
+    unsigned int i, length = 0;
+
+    if (ptr >= end)
+        return -1;
+    *ptag = *ptr++;
+    for (i = 0; i < 4; i++) {
+        if (ptr >= end)
+            return -1;
+        length = (length << 7) | (*ptr & 0x7f);
+        if (!(*ptr++ & 0x80))
+            break;
+    }
+    if (length > (unsigned int)(end - ptr))
+        return -1;
+    *pptr    = ptr;
+    *plength = length;
+    return 0;
+}
+
+/* Finds the DecoderSpecificInfo of an esds box, i.e. the VOL header */
+static int parse_esds(MP4Demuxer *mp4, const MP4Box *esds)
+{
+    const uint8_t *ptr = esds->data + 4;
+    const uint8_t * const end = esds->data + esds->size;
+    unsigned int tag, length, flags;
+
+    if (esds->size < 4)
+        return -1;
+
+    while (read_descriptor(&ptr, end, &tag, &length) == 0) {
+        switch (tag) {
+        case 0x03:                      // ES_Descriptor
+            if (length < 3)
+                return -1;
+            flags = ptr[2];
+            ptr += 3;
+            if (flags & 0x80)           // streamDependenceFlag
+                ptr += 2;
+            if (flags & 0x40) {         // URL_Flag
+                if (ptr >= end)
+                    return -1;
+                ptr += 1 + *ptr;
+            }
+            if (flags & 0x20)           // OCRstreamFlag
+                ptr += 2;
+            break;
+        case 0x04:                      // DecoderConfigDescriptor
+            if (length < 13)
+                return -1;
+            ptr += 13;
+            break;
+        case 0x05:                      // DecoderSpecificInfo
+            mp4->track.config      = ptr;
+            mp4->track.config_size = length;
+            return 0;
+        default:
+            ptr += length;
+            break;
+        }
+        if (ptr > end)
+            return -1;
+    }
+    return -1;
+}
+
+static int parse_stsd(MP4Demuxer *mp4, const MP4Box *stsd)
+{
+    const uint8_t *ptr;
+    MP4Box entry, child;
+    uint32_t count;
+
+    if (stsd->size < 8 || (count = get32(stsd->data + 4)) == 0)
+        return -1;
+
+    /* Only the first sample entry is used */
+    ptr = stsd->data + 8;
+    if (next_box(&ptr, stsd->data + stsd->size, &entry) < 0)
+        return -1;
+    mp4->track.codec = entry.type;
+
+    /* VisualSampleEntry, with child boxes after 78 bytes */
+    if (entry.size < 78)
+        return -1;
+    mp4->track.width  = get16(entry.data + 24);
+    mp4->track.height = get16(entry.data + 26);
+
+    if (find_box(entry.data + 78, entry.size - 78,
+                 MP4_FOURCC('a','v','c','C'), &child) == 0) {
+        mp4->track.config      = child.data;
+        mp4->track.config_size = child.size;
+    }
+    else if (find_box(entry.data + 78, entry.size - 78,
+                      MP4_FOURCC('e','s','d','s'), &child) == 0) {
+        if (parse_esds(mp4, &child) < 0)
+            D(bug("invalid esds box\n"));
+    }
+    return 0;
+}
+
+/* Computes the offset of each sample from the chunk tables */
+static int
+index_sample_offsets(MP4Demuxer *mp4, const MP4Box *stsc, const MP4Box *stco,
+                     int is_co64)
+{
+    const unsigned int num_samples = mp4->track.num_samples;
+    const uint8_t *chunks, *entries;
+    uint32_t num_chunks, num_entries, i, c, c_end, j, n;
+    uint32_t samples_per_chunk;
+    uint64_t offset;
+
+    chunks = get_table(stco, 8, is_co64 ? 8 : 4, &num_chunks);
+    if (!chunks)
+        return -1;
+    entries = get_table(stsc, 8, 12, &num_entries);
+    if (!entries)
+        return -1;
+
+    for (n = 0, i = 0; i < num_entries && n < num_samples; i++) {
+        c                 = get32(entries + 12 * i);
+        samples_per_chunk = get32(entries + 12 * i + 4);
+        c_end             = (i + 1 < num_entries ?
+                             get32(entries + 12 * (i + 1)) : num_chunks + 1);
+        if (c == 0 || c_end < c)
+            return -1;
+        c_end = MIN(c_end, num_chunks + 1);
+
+        for (; c < c_end && n < num_samples; c++) {
+            offset = (is_co64 ?
+                      get64(chunks + 8 * (c - 1)) :
+                      get32(chunks + 4 * (c - 1)));
+            for (j = 0; j < samples_per_chunk && n < num_samples; j++, n++) {
+                if (offset + mp4->sizes[n] > mp4->size)
+                    return -1;
+                mp4->offsets[n] = offset;
+                offset += mp4->sizes[n];
+            }
+        }
+    }
+    if (n < num_samples)
+        return -1;
+    return 0;
+}
+
+/* Computes decoding timestamps, and composition offsets if any */
+static int
+index_sample_times(MP4Demuxer *mp4, const MP4Box *stts, const MP4Box *ctts)
+{
+    const unsigned int num_samples = mp4->track.num_samples;
+    const uint8_t *entries;
+    uint32_t num_entries, i, j, count, n;
+    uint32_t delta = 0;
+    int32_t cts_offset;
+    int64_t dts = 0;
+
+    entries = get_table(stts, 8, 8, &num_entries);
+    if (!entries)
+        return -1;
+
+    for (n = 0, i = 0; i < num_entries && n < num_samples; i++) {
+        count = get32(entries + 8 * i);
+        delta = get32(entries + 8 * i + 4);
+        for (j = 0; j < count && n < num_samples; j++, n++) {
+            mp4->dts[n] = dts;
+            dts += delta;
+        }
+    }
+
+    /* Extend the last sample duration to samples missing in stts */
+    for (; n < num_samples; n++) {
+        mp4->dts[n] = dts;
+        dts += delta;
+    }
+
+    if (!ctts)
+        return 0;
+
+    entries = get_table(ctts, 8, 8, &num_entries);
+    if (!entries)
+        return -1;
+
+    mp4->cts_offsets = calloc(num_samples, sizeof(mp4->cts_offsets[0]));
+    if (!mp4->cts_offsets)
+        return -1;
+
+    for (n = 0, i = 0; i < num_entries && n < num_samples; i++) {
+        count      = get32(entries + 8 * i);
+        cts_offset = (int32_t)get32(entries + 8 * i + 4);
+        for (j = 0; j < count && n < num_samples; j++, n++)
+            mp4->cts_offsets[n] = cts_offset;
+    }
+    return 0;
+}
+
+static int compare_uint32(const void *a, const void *b)
+{
+    const uint32_t va = *(const uint32_t *)a;
+    const uint32_t vb = *(const uint32_t *)b;
+
+    return (va > vb) - (va < vb);
+}
+
+static int index_keyframes(MP4Demuxer *mp4, const MP4Box *stss)
+{
+    const uint8_t *entries;
+    uint32_t i, num_entries;
+    int is_sorted = 1;
+
+    entries = get_table(stss, 8, 4, &num_entries);
+    if (!entries)
+        return -1;
+
+    mp4->keyframes = malloc(MAX(num_entries, 1) * sizeof(mp4->keyframes[0]));
+    if (!mp4->keyframes)
+        return -1;
+
+    for (i = 0; i < num_entries; i++) {
+        mp4->keyframes[i] = get32(entries + 4 * i) - 1;
+        if (i > 0 && mp4->keyframes[i] < mp4->keyframes[i - 1])
+            is_sorted = 0;
+    }
+    if (!is_sorted)
+        qsort(mp4->keyframes, num_entries, sizeof(mp4->keyframes[0]),
+              compare_uint32);
+    mp4->num_keyframes = num_entries;
+    return 0;
+}
+
+static int parse_stbl(MP4Demuxer *mp4, const MP4Box *stbl)
+{
+    MP4Box stsd, stsz, stsc, stco, stts, ctts, stss;
+    uint32_t i, sample_size, num_samples;
+    int is_co64 = 0;
+
+    if (find_child_box(stbl, MP4_FOURCC('s','t','s','d'), &stsd) < 0 ||
+        find_child_box(stbl, MP4_FOURCC('s','t','s','z'), &stsz) < 0 ||
+        find_child_box(stbl, MP4_FOURCC('s','t','s','c'), &stsc) < 0 ||
+        find_child_box(stbl, MP4_FOURCC('s','t','t','s'), &stts) < 0) {
+        D(bug("incomplete sample table\n"));
+        return -1;
+    }
+    if (find_child_box(stbl, MP4_FOURCC('s','t','c','o'), &stco) < 0) {
+        if (find_child_box(stbl, MP4_FOURCC('c','o','6','4'), &stco) < 0) {
+            D(bug("no chunk offsets\n"));
+            return -1;
+        }
+        is_co64 = 1;
+    }
+
+    if (parse_stsd(mp4, &stsd) < 0) {
+        D(bug("invalid sample description\n"));
+        return -1;
+    }
+
+    /* Each sample takes one byte at least */
+    if (stsz.size < 12)
+        return -1;
+    sample_size = get32(stsz.data + 4);
+    num_samples = get32(stsz.data + 8);
+    if (num_samples > mp4->size)
+        return -1;
+    mp4->track.num_samples = num_samples;
+
+    mp4->offsets = malloc(MAX(num_samples, 1) * sizeof(mp4->offsets[0]));
+    mp4->sizes   = malloc(MAX(num_samples, 1) * sizeof(mp4->sizes[0]));
+    mp4->dts     = malloc(MAX(num_samples, 1) * sizeof(mp4->dts[0]));
+    if (!mp4->offsets || !mp4->sizes || !mp4->dts)
+        return -1;
+
+    if (sample_size == 0) {
+        const uint8_t * const sizes = get_table(&stsz, 12, 4, &num_samples);
+        if (!sizes)
+            return -1;
+        for (i = 0; i < num_samples; i++)
+            mp4->sizes[i] = get32(sizes + 4 * i);
+    }
+    else {
+        for (i = 0; i < num_samples; i++)
+            mp4->sizes[i] = sample_size;
+    }
+
+    if (index_sample_offsets(mp4, &stsc, &stco, is_co64) < 0) {
+        D(bug("invalid chunk tables\n"));
+        return -1;
+    }
+
+    if (index_sample_times(mp4,  &stts,
+                           find_child_box(stbl, MP4_FOURCC('c','t','t','s'),
+                                          &ctts) == 0 ? &ctts : NULL) < 0) {
+        D(bug("invalid time-to-sample tables\n"));
+        return -1;
+    }
+
+    if (find_child_box(stbl, MP4_FOURCC('s','t','s','s'), &stss) == 0 &&
+        index_keyframes(mp4, &stss) < 0) {
+        D(bug("invalid sync sample table\n"));
+        return -1;
+    }
+    return 0;
+}
+
+/* Returns 1 if TRAK is not a video track, so that it gets skipped */
+static int parse_trak(MP4Demuxer *mp4, const MP4Box *trak)
+{
+    MP4Box mdia, hdlr, mdhd, minf, stbl;
+
+    if (find_child_box(trak, MP4_FOURCC('m','d','i','a'), &mdia) < 0 ||
+        find_child_box(&mdia, MP4_FOURCC('h','d','l','r'), &hdlr) < 0 ||
+        hdlr.size < 12)
+        return -1;
+    if (get32(hdlr.data + 8) != MP4_FOURCC('v','i','d','e'))
+        return 1;
+
+    if (find_child_box(&mdia, MP4_FOURCC('m','d','h','d'), &mdhd) < 0 ||
+        mdhd.size < 24)
+        return -1;
+    mp4->track.timescale = get32(mdhd.data + (mdhd.data[0] == 1 ? 20 : 12));
+
+    if (find_child_box(&mdia, MP4_FOURCC('m','i','n','f'), &minf) < 0 ||
+        find_child_box(&minf, MP4_FOURCC('s','t','b','l'), &stbl) < 0)
+        return -1;
+    return parse_stbl(mp4, &stbl);
+}
+
+static int mp4_parse(MP4Demuxer *mp4)
+{
+    const uint8_t *ptr;
+    MP4Box moov, trak;
+    int ret;
+
+    if (find_box(mp4->data, mp4->size, MP4_FOURCC('m','o','o','v'), &moov) < 0) {
+        D(bug("no moov box\n"));
+        return -1;
+    }
+
+    ptr = moov.data;
+    while (next_box(&ptr, moov.data + moov.size, &trak) == 0) {
+        if (trak.type != MP4_FOURCC('t','r','a','k'))
+            continue;
+        if ((ret = parse_trak(mp4, &trak)) <= 0)
+            return ret;
+    }
+    D(bug("no video track\n"));
+    return -1;
+}
+
+MP4Demuxer *mp4_open_memory(const uint8_t *data, size_t size)
+{
+    MP4Demuxer *mp4;
+
+    mp4 = calloc(1, sizeof(*mp4));
+    if (!mp4)
+        return NULL;
+    mp4->data = data;
+    mp4->size = size;
+
+    if (mp4_parse(mp4) < 0) {
+        mp4_close(mp4);
+        return NULL;
+    }
+
+    D(bug("%c%c%c%c track, %ux%u, %u samples, %u keyframes\n",
+          mp4->track.codec >> 24, (mp4->track.codec >> 16) & 0xff,
+          (mp4->track.codec >> 8) & 0xff, mp4->track.codec & 0xff,
+          mp4->track.width, mp4->track.height, mp4->track.num_samples,
+          mp4->keyframes ? mp4->num_keyframes : mp4->track.num_samples));
+    return mp4;
+}
+
+MP4Demuxer *mp4_open(const char *filename)
+{
+    MP4Demuxer *mp4;
+    struct stat st;
+    void *data;
+    int fd;
+
+    fd = open(filename, O_RDONLY);
+    if (fd < 0)
+        return NULL;
+    if (fstat(fd, &st) < 0 || st.st_size == 0) {
+        close(fd);
+        return NULL;
+    }
+    data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED)
+        return NULL;
+
+    mp4 = mp4_open_memory(data, st.st_size);
+    if (!mp4) {
+        munmap(data, st.st_size);
+        return NULL;
+    }
+    mp4->is_mapped = 1;
+    return mp4;
+}
+
+void mp4_close(MP4Demuxer *mp4)
+{
+    if (!mp4)
+        return;
+
+    if (mp4->is_mapped)
+        munmap((void *)mp4->data, mp4->size);
+    free(mp4->offsets);
+    free(mp4->sizes);
+    free(mp4->dts);
+    free(mp4->cts_offsets);
+    free(mp4->keyframes);
+    free(mp4);
+}
+
+const MP4TrackInfo *mp4_get_track_info(MP4Demuxer *mp4)
+{
+    return &mp4->track;
+}
+
+/* Returns the index of the last keyframe <= N, or -1 if there is none */
+static int find_keyframe_index(MP4Demuxer *mp4, unsigned int n)
+{
+    unsigned int lo, hi, mid;
+
+    if (mp4->num_keyframes == 0 || mp4->keyframes[0] > n)
+        return -1;
+
+    lo = 0;
+    hi = mp4->num_keyframes;
+    while (hi - lo > 1) {
+        mid = lo + (hi - lo) / 2;
+        if (mp4->keyframes[mid] <= n)
+            lo = mid;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+int mp4_get_sample(MP4Demuxer *mp4, unsigned int n, MP4Sample *sample)
+{
+    int k;
+
+    if (n >= mp4->track.num_samples)
+        return -1;
+
+    sample->data        = mp4->data + mp4->offsets[n];
+    sample->size        = mp4->sizes[n];
+    sample->dts         = mp4->dts[n];
+    sample->pts         = mp4->dts[n];
+    if (mp4->cts_offsets)
+        sample->pts    += mp4->cts_offsets[n];
+    sample->is_keyframe = 1;
+    if (mp4->keyframes) {
+        k = find_keyframe_index(mp4, n);
+        sample->is_keyframe = k >= 0 && mp4->keyframes[k] == n;
+    }
+    return 0;
+}
+
+int mp4_find_keyframe(MP4Demuxer *mp4, unsigned int n)
+{
+    int k;
+
+    if (mp4->track.num_samples == 0)
+        return -1;
+    n = MIN(n, mp4->track.num_samples - 1);
+
+    if (!mp4->keyframes)
+        return n;
+
+    k = find_keyframe_index(mp4, n);
+    if (k >= 0)
+        return mp4->keyframes[k];
+
+    /* N precedes the first keyframe, where decoding can start */
+    if (mp4->num_keyframes == 0 ||
+        mp4->keyframes[0] >= mp4->track.num_samples)
+        return -1;
+    return mp4->keyframes[0];
+}
+
+int mp4_seek(MP4Demuxer *mp4, int64_t dts)
+{
+    unsigned int lo, hi, mid;
+
+    if (mp4->track.num_samples == 0 || mp4->dts[0] > dts)
+        return mp4_find_keyframe(mp4, 0);
+
+    /* Find the last sample with a timestamp <= DTS */
+    lo = 0;
+    hi = mp4->track.num_samples;
+    while (hi - lo > 1) {
+        mid = lo + (hi - lo) / 2;
+        if (mp4->dts[mid] <= dts)
+            lo = mid;
+        else
+            hi = mid;
+    }
+    return mp4_find_keyframe(mp4, lo);
+}
@@ -0,0 +1,81 @@
+/*
+ *  mp4.h - Memory-mapped ISO-BMFF (MP4) demuxer
+ *
+ *  hwdecode-demos (C) 2009-2010 Splitted-Desktop Systems
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef MP4_H
+#define MP4_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define MP4_FOURCC(ch1, ch2, ch3, ch4) \
+    ((((uint32_t)ch1) << 24) | \
+     (((uint32_t)ch2) << 16) | \
+     (((uint32_t)ch3) <<  8) | \
+      ((uint32_t)ch4))
+
+typedef struct _MP4Demuxer      MP4Demuxer;
+typedef struct _MP4TrackInfo    MP4TrackInfo;
+typedef struct _MP4Sample       MP4Sample;
+
+struct _MP4TrackInfo {
+    uint32_t            codec;          // sample entry, e.g. avc1, mp4v
+    unsigned int        width;
+    unsigned int        height;
+    uint32_t            timescale;      // timestamp units per second
+    const uint8_t      *config;         // avcC record, or MPEG-4 DSI
+    unsigned int        config_size;
+    unsigned int        num_samples;
+};
+
+struct _MP4Sample {
+    const uint8_t      *data;           // points into the file mapping
+    unsigned int        size;
+    int64_t             dts;
+    int64_t             pts;
+    unsigned int        is_keyframe;
+};
+
+// Maps FILENAME and indexes its first video track
+MP4Demuxer *mp4_open(const char *filename);
+
+// Indexes the first video track of the file held in DATA, which must
+// outlive the demuxer
+MP4Demuxer *mp4_open_memory(const uint8_t *data, size_t size);
+
+// Unmaps the file and releases the sample index
+void mp4_close(MP4Demuxer *mp4);
+
+// Returns information about the indexed video track
+const MP4TrackInfo *mp4_get_track_info(MP4Demuxer *mp4);
+
+// Fills in SAMPLE with sample N of the track, without copying it
+int mp4_get_sample(MP4Demuxer *mp4, unsigned int n, MP4Sample *sample);
+
+// Returns the last keyframe at or before sample N, clamped to the last
+// sample, or the first keyframe if N precedes it. Returns -1 if the
+// track has no keyframe
+int mp4_find_keyframe(MP4Demuxer *mp4, unsigned int n);
+
+// Returns the last keyframe with a decoding timestamp at or before DTS,
+// or the first keyframe if DTS precedes it. Returns -1 if the track has
+// no keyframe
+int mp4_seek(MP4Demuxer *mp4, int64_t dts);
+
+#endif /* MP4_H */
@@ -20,12 +20,15 @@
 
 #include "sysdeps.h"
 #include "mpeg2.h"
+#include "startcode.h"
+#include "get_bits.h"
+#include "utils.h"
+#include "input.h"
+
+#define DEBUG 1
+#include "debug.h"
 
-#define MPEG2_CLIP_WIDTH          320
-#define MPEG2_CLIP_HEIGHT         240
 #define MPEG2_CLIP_DATA_SIZE    19311
-#define MPEG2_CLIP_SLICE_OFFSET    59
-#define MPEG2_CLIP_SLICE_COUNT     15
 
 /* Data dump of a 320x240 MPEG-2 video clip (mpeg2.m2v), it has a single frame */
 static const uint8_t mpeg2_clip[MPEG2_CLIP_DATA_SIZE] = {
@@ -1641,249 +1644,488 @@ static const uint8_t mpeg2_clip[MPEG2_CLIP_DATA_SIZE] = {
     0x00, 0x01, 0xb7
 };
 
-static const MPEG2PictureInfo mpeg2_pic_info = {
-    .width = MPEG2_CLIP_WIDTH,
-    .height = MPEG2_CLIP_HEIGHT,
-    .picture_coding_type = 1,
-    .f_code = 0x0000ffff,
-    .picture_coding_extension = {
-        .bits = {
-            .intra_dc_precision = 1,
-            .picture_structure = 3,
-            .top_field_first = 0,
-            .frame_pred_frame_dct = 1,
-            .concealment_motion_vectors = 0,
-            .q_scale_type = 1,
-            .intra_vlc_format = 1,
-            .alternate_scan = 1,
-            .repeat_first_field = 0,
-            .progressive_frame = 1,
-            .is_first_field = 1,
-        },
-    },
+/* Default intra quantiser matrix, in zig-zag scan order */
+static const uint8_t default_intra_quantiser_matrix[64] = {
+     8, 16, 16, 19, 16, 19, 22, 22,
+    22, 22, 22, 22, 26, 24, 26, 27,
+    27, 27, 26, 26, 26, 26, 27, 27,
+    27, 29, 29, 29, 34, 34, 34, 29,
+    29, 29, 27, 27, 29, 29, 32, 32,
+    34, 34, 37, 38, 37, 35, 35, 34,
+    35, 38, 38, 40, 40, 40, 48, 48,
+    46, 46, 56, 56, 58, 69, 69, 83
 };
 
-static const MPEG2SliceInfo mpeg2_slice_info[MPEG2_CLIP_SLICE_COUNT] = {
-    {
-        .slice_data_size = 1047,
-        .slice_data_offset = 0,
-        .macroblock_offset = 38,
-        .slice_horizontal_position = 0,
-        .slice_vertical_position = 0,
-        .quantiser_scale_code = 8,
-        .intra_slice_flag = 0,
-    },
-    {
-        .slice_data_size = 1032,
-        .slice_data_offset = 1047,
-        .macroblock_offset = 38,
-        .slice_horizontal_position = 0,
-        .slice_vertical_position = 1,
-        .quantiser_scale_code = 8,
-        .intra_slice_flag = 0,
-    },
-    {
-        .slice_data_size = 1136,
-        .slice_data_offset = 2079,
-        .macroblock_offset = 38,
-        .slice_horizontal_position = 0,
-        .slice_vertical_position = 2,
-        .quantiser_scale_code = 8,
-        .intra_slice_flag = 0,
-    },
-    {
-        .slice_data_size = 1333,
-        .slice_data_offset = 3215,
-        .macroblock_offset = 38,
-        .slice_horizontal_position = 0,
-        .slice_vertical_position = 3,
-        .quantiser_scale_code = 8,
-        .intra_slice_flag = 0,
-    },
-    {
-        .slice_data_size = 1286,
-        .slice_data_offset = 4548,
-        .macroblock_offset = 38,
-        .slice_horizontal_position = 0,
-        .slice_vertical_position = 4,
-        .quantiser_scale_code = 8,
-        .intra_slice_flag = 0,
-    },
-    {
-        .slice_data_size = 1026,
-        .slice_data_offset = 5834,
-        .macroblock_offset = 38,
-        .slice_horizontal_position = 0,
-        .slice_vertical_position = 5,
-        .quantiser_scale_code = 8,
-        .intra_slice_flag = 0,
-    },
-    {
-        .slice_data_size = 1257,
-        .slice_data_offset = 6860,
-        .macroblock_offset = 38,
-        .slice_horizontal_position = 0,
-        .slice_vertical_position = 6,
-        .quantiser_scale_code = 8,
-        .intra_slice_flag = 0,
-    },
-    {
-        .slice_data_size = 1374,
-        .slice_data_offset = 8117,
-        .macroblock_offset = 38,
-        .slice_horizontal_position = 0,
-        .slice_vertical_position = 7,
-        .quantiser_scale_code = 8,
-        .intra_slice_flag = 0,
-    },
-    {
-        .slice_data_size = 1386,
-        .slice_data_offset = 9491,
-        .macroblock_offset = 38,
-        .slice_horizontal_position = 0,
-        .slice_vertical_position = 8,
-        .quantiser_scale_code = 8,
-        .intra_slice_flag = 0,
-    },
-    {
-        .slice_data_size = 1290,
-        .slice_data_offset = 10877,
-        .macroblock_offset = 38,
-        .slice_horizontal_position = 0,
-        .slice_vertical_position = 9,
-        .quantiser_scale_code = 8,
-        .intra_slice_flag = 0,
-    },
-    {
-        .slice_data_size = 1213,
-        .slice_data_offset = 12167,
-        .macroblock_offset = 38,
-        .slice_horizontal_position = 0,
-        .slice_vertical_position = 10,
-        .quantiser_scale_code = 8,
-        .intra_slice_flag = 0,
-    },
-    {
-        .slice_data_size = 1346,
-        .slice_data_offset = 13380,
-        .macroblock_offset = 38,
-        .slice_horizontal_position = 0,
-        .slice_vertical_position = 11,
-        .quantiser_scale_code = 8,
-        .intra_slice_flag = 0,
-    },
-    {
-        .slice_data_size = 1439,
-        .slice_data_offset = 14726,
-        .macroblock_offset = 38,
-        .slice_horizontal_position = 0,
-        .slice_vertical_position = 12,
-        .quantiser_scale_code = 8,
-        .intra_slice_flag = 0,
-    },
-    {
-        .slice_data_size = 1466,
-        .slice_data_offset = 16165,
-        .macroblock_offset = 38,
-        .slice_horizontal_position = 0,
-        .slice_vertical_position = 13,
-        .quantiser_scale_code = 8,
-        .intra_slice_flag = 0,
-    },
-    {
-        .slice_data_size = 1617,
-        .slice_data_offset = 17631,
-        .macroblock_offset = 38,
-        .slice_horizontal_position = 0,
-        .slice_vertical_position = 14,
-        .quantiser_scale_code = 8,
-        .intra_slice_flag = 0,
-    },
-};
+/* Start code values */
+#define PICTURE_START_CODE      0x00
+#define SLICE_START_CODE_MIN    0x01
+#define SLICE_START_CODE_MAX    0xaf
+#define USER_DATA_START_CODE    0xb2
+#define SEQUENCE_HEADER_CODE    0xb3
+#define EXTENSION_START_CODE    0xb5
+#define SEQUENCE_END_CODE       0xb7
+#define GROUP_START_CODE        0xb8
+
+/* Extension identifiers */
+#define SEQUENCE_EXTENSION_ID           1
+#define QUANT_MATRIX_EXTENSION_ID       3
+#define PICTURE_CODING_EXTENSION_ID     8
+
+/* Picture coding types */
+#define I_TYPE 1
+#define P_TYPE 2
+#define B_TYPE 3
+
+struct _MPEG2Parser {
+    const uint8_t      *buf;
+    size_t              size;
+    size_t              pos;            // offset of the next start code
+
+    /* Sequence state */
+    unsigned int        horizontal_size;
+    unsigned int        vertical_size;
+    MPEG2IQMatrix       iq_matrix;
 
-static const MPEG2IQMatrix mpeg2_iq_matrix = {
-    .load_intra_quantiser_matrix = 1,
-    .intra_quantiser_matrix = {
-        0x08, 0x10, 0x10, 0x13, 0x10, 0x13, 0x16, 0x16,
-        0x16, 0x16, 0x16, 0x16, 0x1a, 0x18, 0x1a, 0x1b,
-        0x1b, 0x1b, 0x1a, 0x1a, 0x1a, 0x1a, 0x1b, 0x1b,
-        0x1b, 0x1d, 0x1d, 0x1d, 0x22, 0x22, 0x22, 0x1d,
-        0x1d, 0x1d, 0x1b, 0x1b, 0x1d, 0x1d, 0x20, 0x20,
-        0x22, 0x22, 0x25, 0x26, 0x25, 0x23, 0x23, 0x22,
-        0x23, 0x26, 0x26, 0x28, 0x28, 0x28, 0x30, 0x30,
-        0x2e, 0x2e, 0x38, 0x38, 0x3a, 0x45, 0x45, 0x53
-    },
-    .load_non_intra_quantiser_matrix = 1,
-    .non_intra_quantiser_matrix = {
-        0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
-        0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
-        0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
-        0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
-        0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
-        0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
-        0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
-        0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10
-    },
-    .load_chroma_intra_quantiser_matrix = 1,
-    .chroma_intra_quantiser_matrix = {
-        0x08, 0x10, 0x10, 0x13, 0x10, 0x13, 0x16, 0x16,
-        0x16, 0x16, 0x16, 0x16, 0x1a, 0x18, 0x1a, 0x1b,
-        0x1b, 0x1b, 0x1a, 0x1a, 0x1a, 0x1a, 0x1b, 0x1b,
-        0x1b, 0x1d, 0x1d, 0x1d, 0x22, 0x22, 0x22, 0x1d,
-        0x1d, 0x1d, 0x1b, 0x1b, 0x1d, 0x1d, 0x20, 0x20,
-        0x22, 0x22, 0x25, 0x26, 0x25, 0x23, 0x23, 0x22,
-        0x23, 0x26, 0x26, 0x28, 0x28, 0x28, 0x30, 0x30,
-        0x2e, 0x2e, 0x38, 0x38, 0x3a, 0x45, 0x45, 0x53
-    },
-    .load_chroma_non_intra_quantiser_matrix = 1,
-    .chroma_non_intra_quantiser_matrix = {
-        0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
-        0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
-        0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
-        0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
-        0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
-        0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
-        0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
-        0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10
-    },
+    /* Reference tracking, by frame decoding order */
+    unsigned int        num_frames;
+    int                 past_reference;
+    int                 future_reference;
+    int                 forward_reference;
+    int                 backward_reference;
+    unsigned int        first_field_pending;
+
+    MPEG2SliceInfo     *slices;
+    unsigned int        slices_size;
 };
 
-void mpeg2_get_video_data(const uint8_t **data, unsigned int *size)
+static void read_quantiser_matrix(GetBitContext *gb, uint8_t matrix[64])
+{
+    unsigned int i;
+
+    for (i = 0; i < 64; i++)
+        matrix[i] = get_bits(gb, 8);
+}
+
+static int parse_sequence_header(MPEG2Parser *parser, GetBitContext *gb)
+{
+    MPEG2IQMatrix * const iq_matrix = &parser->iq_matrix;
+
+    if (get_bits_left(gb) < 64)
+        return -1;
+
+    parser->horizontal_size = get_bits(gb, 12);
+    parser->vertical_size   = get_bits(gb, 12);
+    skip_bits(gb, 4 + 4);               // aspect_ratio, frame_rate_code
+    skip_bits(gb, 18 + 1 + 10 + 1);     // bit_rate_value, marker, vbv, cpf
+
+    /* All matrices are reset to their default values */
+    if (get_bits1(gb))
+        read_quantiser_matrix(gb, iq_matrix->intra_quantiser_matrix);
+    else
+        memcpy(iq_matrix->intra_quantiser_matrix,
+               default_intra_quantiser_matrix, 64);
+    if (get_bits1(gb))
+        read_quantiser_matrix(gb, iq_matrix->non_intra_quantiser_matrix);
+    else
+        memset(iq_matrix->non_intra_quantiser_matrix, 16, 64);
+
+    memcpy(iq_matrix->chroma_intra_quantiser_matrix,
+           iq_matrix->intra_quantiser_matrix, 64);
+    memcpy(iq_matrix->chroma_non_intra_quantiser_matrix,
+           iq_matrix->non_intra_quantiser_matrix, 64);
+    iq_matrix->load_intra_quantiser_matrix            = 1;
+    iq_matrix->load_non_intra_quantiser_matrix        = 1;
+    iq_matrix->load_chroma_intra_quantiser_matrix     = 1;
+    iq_matrix->load_chroma_non_intra_quantiser_matrix = 1;
+    return get_bits_left(gb) < 0 ? -1 : 0;
+}
+
+static void parse_quant_matrix_extension(MPEG2Parser *parser, GetBitContext *gb)
+{
+    MPEG2IQMatrix * const iq_matrix = &parser->iq_matrix;
+
+    /* Chroma matrices follow the luma ones, unless they are loaded too */
+    if (get_bits1(gb)) {
+        read_quantiser_matrix(gb, iq_matrix->intra_quantiser_matrix);
+        memcpy(iq_matrix->chroma_intra_quantiser_matrix,
+               iq_matrix->intra_quantiser_matrix, 64);
+    }
+    if (get_bits1(gb)) {
+        read_quantiser_matrix(gb, iq_matrix->non_intra_quantiser_matrix);
+        memcpy(iq_matrix->chroma_non_intra_quantiser_matrix,
+               iq_matrix->non_intra_quantiser_matrix, 64);
+    }
+    if (get_bits1(gb))
+        read_quantiser_matrix(gb, iq_matrix->chroma_intra_quantiser_matrix);
+    if (get_bits1(gb))
+        read_quantiser_matrix(gb, iq_matrix->chroma_non_intra_quantiser_matrix);
+}
+
+static void parse_picture_header(MPEG2Picture *picture, GetBitContext *gb)
 {
+    MPEG2PictureInfo * const pic_info = &picture->pic_info;
+    unsigned int f_code;
+
+    picture->temporal_reference   = get_bits(gb, 10);
+    pic_info->picture_coding_type = get_bits(gb, 3);
+    skip_bits(gb, 16);                  // vbv_delay
+
+    /* MPEG-1 motion vector ranges, until a picture coding extension */
+    pic_info->f_code = 0xffff;
+    if (pic_info->picture_coding_type == P_TYPE ||
+        pic_info->picture_coding_type == B_TYPE) {
+        skip_bits(gb, 1);               // full_pel_forward_vector
+        f_code = get_bits(gb, 3);
+        pic_info->f_code = (pic_info->f_code & 0x00ff) | (f_code << 12) | (f_code << 8);
+    }
+    if (pic_info->picture_coding_type == B_TYPE) {
+        skip_bits(gb, 1);               // full_pel_backward_vector
+        f_code = get_bits(gb, 3);
+        pic_info->f_code = (pic_info->f_code & 0xff00) | (f_code << 4) | f_code;
+    }
+
+    pic_info->picture_coding_extension.value = 0;
+    pic_info->picture_coding_extension.bits.picture_structure    = 3;
+    pic_info->picture_coding_extension.bits.frame_pred_frame_dct = 1;
+    pic_info->picture_coding_extension.bits.progressive_frame    = 1;
+}
+
+static void parse_picture_coding_extension(MPEG2Picture *picture, GetBitContext *gb)
+{
+    MPEG2PictureInfo * const pic_info = &picture->pic_info;
+
+    pic_info->f_code = get_bits(gb, 16);
+#define READ(field, n) \
+    pic_info->picture_coding_extension.bits.field = get_bits(gb, n)
+    READ(intra_dc_precision, 2);
+    READ(picture_structure, 2);
+    READ(top_field_first, 1);
+    READ(frame_pred_frame_dct, 1);
+    READ(concealment_motion_vectors, 1);
+    READ(q_scale_type, 1);
+    READ(intra_vlc_format, 1);
+    READ(alternate_scan, 1);
+    READ(repeat_first_field, 1);
+    skip_bits(gb, 1);                   // chroma_420_type
+    READ(progressive_frame, 1);
+#undef READ
+}
+
+static int
+parse_extension(MPEG2Parser *parser, MPEG2Picture *picture, GetBitContext *gb,
+                int in_picture)
+{
+    if (get_bits_left(gb) < 32)
+        return -1;
+
+    switch (get_bits(gb, 4)) {
+    case SEQUENCE_EXTENSION_ID:
+        skip_bits(gb, 8 + 1 + 2);       // profile_and_level, progressive, chroma
+        parser->horizontal_size = (parser->horizontal_size & 0xfff) | (get_bits(gb, 2) << 12);
+        parser->vertical_size   = (parser->vertical_size   & 0xfff) | (get_bits(gb, 2) << 12);
+        break;
+    case QUANT_MATRIX_EXTENSION_ID:
+        parse_quant_matrix_extension(parser, gb);
+        break;
+    case PICTURE_CODING_EXTENSION_ID:
+        if (in_picture)
+            parse_picture_coding_extension(picture, gb);
+        break;
+    }
+    return get_bits_left(gb) < 0 ? -1 : 0;
+}
+
+/* Decodes macroblock_address_increment (Table B.1), or returns -1 */
+static int get_macroblock_address_increment(GetBitContext *gb)
+{
+    unsigned int v, increment = 0;
+
+    for (;;) {
+        v = show_bits(gb, 11);
+        if (v == 0x008)                 // macroblock_escape
+            increment += 33;
+        else if (v != 0x00f)            // MPEG-1 macroblock_stuffing
+            break;
+        skip_bits(gb, 11);
+    }
+
+    if (v >= 0x400) {
+        skip_bits(gb, 1);
+        return increment + 1;
+    }
+    if (v >= 0x200) {
+        skip_bits(gb, 3);
+        return increment + 5 - (v >> 8);
+    }
+    if (v >= 0x100) {
+        skip_bits(gb, 4);
+        return increment + 7 - (v >> 7);
+    }
+    if (v >= 0x080) {
+        skip_bits(gb, 5);
+        return increment + 9 - (v >> 6);
+    }
+    if (v >= 0x060) {
+        skip_bits(gb, 7);
+        return increment + 15 - (v >> 4);
+    }
+    if (v >= 0x030) {
+        skip_bits(gb, 8);
+        return increment + 21 - (v >> 3);
+    }
+    if (v >= 0x024) {
+        skip_bits(gb, 10);
+        return increment + 39 - (v >> 1);
+    }
+    if (v >= 0x018) {
+        skip_bits(gb, 11);
+        return increment + 57 - v;
+    }
+    return -1;
+}
+
+/* Parses the slice header up to the first macroblock. GB starts at the
+   slice start code, so that the macroblock offset includes it */
+static int
+parse_slice_header(MPEG2Parser *parser, MPEG2SliceInfo *slice, GetBitContext *gb)
+{
+    int increment;
+
+    skip_bits(gb, 24);
+    slice->slice_vertical_position = get_bits(gb, 8) - 1;
+    if (parser->vertical_size > 2800)
+        slice->slice_vertical_position += get_bits(gb, 3) << 7;
+
+    slice->quantiser_scale_code = get_bits(gb, 5);
+    slice->intra_slice_flag     = 0;
+    if (get_bits1(gb)) {                // intra_slice_flag
+        slice->intra_slice_flag = 1;
+        skip_bits(gb, 1 + 7);           // intra_slice, reserved_bits
+        while (get_bits1(gb)) {         // extra_bit_slice
+            skip_bits(gb, 8);           // extra_information_slice
+            if (get_bits_left(gb) < 0)
+                return -1;
+        }
+    }
+    slice->macroblock_offset = get_bits_count(gb);
+
+    increment = get_macroblock_address_increment(gb);
+    if (increment < 1 || get_bits_left(gb) < 0)
+        return -1;
+    slice->slice_horizontal_position = increment - 1;
+    return 0;
+}
+
+static int
+add_slice(MPEG2Parser *parser, MPEG2Picture *picture,
+          size_t offset, unsigned int size)
+{
+    MPEG2SliceInfo *slice;
+    GetBitContext gb;
+
+    parser->slices = fast_realloc(parser->slices, &parser->slices_size,
+                                  (picture->slice_count + 1) * sizeof(*slice));
+    if (!parser->slices)
+        return -1;
+
+    slice = &parser->slices[picture->slice_count];
+    slice->slice_data_offset = offset;
+    slice->slice_data_size   = size;
+
+    init_get_bits(&gb, parser->buf + offset, size);
+    if (parse_slice_header(parser, slice, &gb) < 0)
+        return -1;
+    picture->slice_count++;
+    return 0;
+}
+
+/* Assigns the frame and its reference frames, in decoding order */
+static void update_references(MPEG2Parser *parser, MPEG2Picture *picture)
+{
+    const MPEG2PictureInfo * const pic_info = &picture->pic_info;
+    const unsigned int is_field =
+        pic_info->picture_coding_extension.bits.picture_structure != 3;
+    const unsigned int is_first_field = !is_field || !parser->first_field_pending;
+
+    if (is_first_field) {
+        picture->frame_num = parser->num_frames++;
+        switch (pic_info->picture_coding_type) {
+        case I_TYPE:
+        case P_TYPE:
+            parser->forward_reference  = (pic_info->picture_coding_type == P_TYPE ?
+                                          parser->future_reference : -1);
+            parser->backward_reference = -1;
+            parser->past_reference     = parser->future_reference;
+            parser->future_reference   = picture->frame_num;
+            break;
+        default:
+            parser->forward_reference  = parser->past_reference;
+            parser->backward_reference = parser->future_reference;
+            break;
+        }
+    }
+    else
+        picture->frame_num = parser->num_frames - 1;
+
+    picture->forward_reference  = parser->forward_reference;
+    picture->backward_reference = parser->backward_reference;
+
+    /* The second field of a P-frame may refer to the first one */
+    if (!is_first_field && pic_info->picture_coding_type == P_TYPE)
+        picture->forward_reference = picture->frame_num;
+
+    picture->pic_info.picture_coding_extension.bits.is_first_field = is_first_field;
+    parser->first_field_pending = is_field && is_first_field;
+}
+
+MPEG2Parser *mpeg2_parser_new(const uint8_t *buf, size_t size)
+{
+    MPEG2Parser *parser;
+
+    parser = calloc(1, sizeof(*parser));
+    if (!parser)
+        return NULL;
+
+    parser->buf              = buf;
+    parser->size             = size;
+    parser->past_reference   = -1;
+    parser->future_reference = -1;
+    return parser;
+}
+
+void mpeg2_parser_destroy(MPEG2Parser *parser)
+{
+    if (!parser)
+        return;
+
+    free(parser->slices);
+    free(parser);
+}
+
+int mpeg2_parser_get_picture(MPEG2Parser *parser, MPEG2Picture *picture)
+{
+    const uint8_t * const buf = parser->buf;
+    const size_t size = parser->size;
+    size_t pos, next;
+    unsigned int code;
+    int in_picture = 0;
+    GetBitContext gb;
+
+    input_release(parser->buf + parser->pos);
+
+    memset(picture, 0, sizeof(*picture));
+
+    pos = startcode_find(buf, parser->pos, size);
+    for (; pos + 4 <= size; pos = next) {
+        next = startcode_find(buf, pos + 3, size);
+        code = buf[pos + 3];
+
+        /* A picture ends at the next start code other than a slice, an
+           extension or user data */
+        if (in_picture &&
+            (code < SLICE_START_CODE_MIN || code > SLICE_START_CODE_MAX) &&
+            code != EXTENSION_START_CODE && code != USER_DATA_START_CODE)
+            break;
+
+        if (code >= SLICE_START_CODE_MIN && code <= SLICE_START_CODE_MAX) {
+            if (in_picture && add_slice(parser, picture, pos, next - pos) < 0)
+                return -1;
+            continue;
+        }
+
+        init_get_bits(&gb, buf + pos + 4, next - pos - 4);
+        switch (code) {
+        case SEQUENCE_HEADER_CODE:
+            if (parse_sequence_header(parser, &gb) < 0)
+                return -1;
+            break;
+        case EXTENSION_START_CODE:
+            if (parse_extension(parser, picture, &gb, in_picture) < 0)
+                return -1;
+            break;
+        case PICTURE_START_CODE:
+            if (parser->horizontal_size == 0 || get_bits_left(&gb) < 29)
+                return -1;
+            parse_picture_header(picture, &gb);
+            in_picture = 1;
+            break;
+        }
+    }
+    parser->pos = pos;
+
+    if (!in_picture)
+        return 0;
+
+    picture->pic_info.width  = parser->horizontal_size;
+    picture->pic_info.height = parser->vertical_size;
+    picture->iq_matrix       = parser->iq_matrix;
+    picture->slices          = parser->slices;
+    update_references(parser, picture);
+    return 1;
+}
+
+/* Parses the first picture of the video data, only once */
+static const MPEG2Picture *get_picture(void)
+{
+    static MPEG2Parser *parser;
+    static MPEG2Picture picture;
+    const uint8_t *data;
+    size_t size;
+
+    if (!parser) {
+        mpeg2_get_video_data(&data, &size);
+        parser = mpeg2_parser_new(data, size);
+        if (!parser || mpeg2_parser_get_picture(parser, &picture) != 1) {
+            D(bug("failed to parse the first MPEG-2 picture\n"));
+            memset(&picture, 0, sizeof(picture));
+        }
+    }
+    return &picture;
+}
+
+void mpeg2_get_video_data(const uint8_t **data, size_t *size)
+{
+    if (input_get_data(data, size))
+        return;
     *data = mpeg2_clip;
     *size = MPEG2_CLIP_DATA_SIZE;
 }
 
 void mpeg2_get_picture_info(MPEG2PictureInfo *pic_info)
 {
-    memcpy(pic_info, &mpeg2_pic_info, sizeof(*pic_info));
+    memcpy(pic_info, &get_picture()->pic_info, sizeof(*pic_info));
 }
 
 void mpeg2_get_iq_matrix(MPEG2IQMatrix *iq_matrix)
 {
-    memcpy(iq_matrix, &mpeg2_iq_matrix, sizeof(*iq_matrix));
+    memcpy(iq_matrix, &get_picture()->iq_matrix, sizeof(*iq_matrix));
 }
 
 int mpeg2_get_slice_count(void)
 {
-    return MPEG2_CLIP_SLICE_COUNT;
+    return get_picture()->slice_count;
 }
 
 int mpeg2_get_slice_info(int slice, MPEG2SliceInfo *slice_info)
 {
-    if (slice < 0 || slice >= MPEG2_CLIP_SLICE_COUNT)
+    const MPEG2Picture * const picture = get_picture();
+
+    if (slice < 0 || slice >= (int)picture->slice_count)
         return -1;
-    memcpy(slice_info, &mpeg2_slice_info[slice], sizeof(*slice_info));
+    memcpy(slice_info, &picture->slices[slice], sizeof(*slice_info));
     return 0;
 }
 
 int mpeg2_get_slice_data(int slice, const uint8_t **data, unsigned int *size)
 {
-    const MPEG2SliceInfo *slice_info;
-    if (slice < 0 || slice >= MPEG2_CLIP_SLICE_COUNT)
+    const MPEG2Picture * const picture = get_picture();
+    const uint8_t *video_data;
+    size_t video_data_size;
+
+    if (slice < 0 || slice >= (int)picture->slice_count)
         return -1;
-    slice_info = &mpeg2_slice_info[slice];
-    *data = &mpeg2_clip[MPEG2_CLIP_SLICE_OFFSET + slice_info->slice_data_offset];
-    *size = slice_info->slice_data_size;
+    mpeg2_get_video_data(&video_data, &video_data_size);
+    *data = video_data + picture->slices[slice].slice_data_offset;
+    *size = picture->slices[slice].slice_data_size;
     return 0;
 }
@@ -24,6 +24,8 @@
 typedef struct _MPEG2PictureInfo MPEG2PictureInfo;
 typedef struct _MPEG2IQMatrix    MPEG2IQMatrix;
 typedef struct _MPEG2SliceInfo   MPEG2SliceInfo;
+typedef struct _MPEG2Picture     MPEG2Picture;
+typedef struct _MPEG2Parser      MPEG2Parser;
 
 struct _MPEG2PictureInfo {
     unsigned short      width;
@@ -61,7 +63,7 @@ struct _MPEG2IQMatrix {
 
 struct _MPEG2SliceInfo {
     unsigned int        slice_data_size;
-    unsigned int        slice_data_offset;
+    size_t              slice_data_offset;
     unsigned int        macroblock_offset;
     unsigned int        slice_horizontal_position;
     unsigned int        slice_vertical_position;
@@ -69,7 +71,33 @@ struct _MPEG2SliceInfo {
     int                 intra_slice_flag;
 };
 
-void mpeg2_get_video_data(const uint8_t **data, unsigned int *size);
+// A picture, or a field, with slices in decoding order. Reference
+// pictures are identified by the decoding order number of their frame,
+// or -1 if they are missing, e.g. for B-pictures of an open GOP
+struct _MPEG2Picture {
+    MPEG2PictureInfo    pic_info;
+    MPEG2IQMatrix       iq_matrix;
+    MPEG2SliceInfo     *slices;         // offsets are relative to the stream
+    unsigned int        slice_count;
+    unsigned int        frame_num;      // decoding order of the frame
+    unsigned int        temporal_reference;
+    int                 forward_reference;
+    int                 backward_reference;
+};
+
+// Creates a parser over the SIZE bytes of an elementary stream in BUF,
+// which must outlive the parser
+MPEG2Parser *mpeg2_parser_new(const uint8_t *buf, size_t size);
+void mpeg2_parser_destroy(MPEG2Parser *parser);
+
+// Parses the next picture. Returns 1 if PICTURE was filled in, 0 at the
+// end of the stream, or -1 on error. PICTURE->slices remains valid until
+// the next call
+int mpeg2_parser_get_picture(MPEG2Parser *parser, MPEG2Picture *picture);
+
+void mpeg2_get_video_data(const uint8_t **data, size_t *size);
+
+// Accessors to the first picture of the video data
 void mpeg2_get_picture_info(MPEG2PictureInfo *pic_info);
 void mpeg2_get_iq_matrix(MPEG2IQMatrix *iq_matrix);
 int mpeg2_get_slice_count(void);
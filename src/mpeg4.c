@@ -20,12 +20,16 @@
 
 #include "sysdeps.h"
 #include "mpeg4.h"
+#include "mp4.h"
+#include "startcode.h"
+#include "get_bits.h"
+#include "utils.h"
+#include "input.h"
+
+#define DEBUG 1
+#include "debug.h"
 
-#define MPEG4_CLIP_WIDTH          320
-#define MPEG4_CLIP_HEIGHT         240
 #define MPEG4_CLIP_DATA_SIZE    22274
-#define MPEG4_CLIP_SLICE_OFFSET    50
-#define MPEG4_CLIP_SLICE_COUNT      1
 
 /* Data dump of a 320x240 MPEG-4 video clip (mpeg4.mp4), it has a single frame */
 static const uint8_t mpeg4_clip[MPEG4_CLIP_DATA_SIZE] = {
@@ -1887,101 +1891,635 @@ static const uint8_t mpeg4_clip[MPEG4_CLIP_DATA_SIZE] = {
     0x00, 0x00, 0x00, 0x4c, 0x61, 0x76, 0x66, 0x35, 0x32, 0x2e, 0x33, 0x32,
     0x2e, 0x30
 };
+/* Start code values */
+#define VIDEO_OBJECT_START_CODE_MAX     0x1f
+#define VOL_START_CODE_MIN              0x20
+#define VOL_START_CODE_MAX              0x2f
+#define VOS_START_CODE                  0xb0
+#define VOS_END_CODE                    0xb1
+#define USER_DATA_START_CODE            0xb2
+#define GOV_START_CODE                  0xb3
+#define VISUAL_OBJECT_START_CODE        0xb5
+#define VOP_START_CODE                  0xb6
 
-static const MPEG4PictureInfo mpeg4_pic_info = {
-    .width = MPEG4_CLIP_WIDTH,
-    .height = MPEG4_CLIP_HEIGHT,
-    .vol_fields = {
-        .bits = {
-            .short_video_header = 0,
-            .chroma_format = 1,
-            .interlaced = 0,
-            .obmc_disable = 1,
-            .sprite_enable = 0,
-            .sprite_warping_accuracy = 0,
-            .quant_type = 0,
-            .quarter_sample = 0,
-            .data_partitioned = 0,
-            .reversible_vlc = 0,
-            .resync_marker_disable = 1,
-        },
-    },
-    .no_of_sprite_warping_points = 0,
-    .sprite_trajectory_du = { 0x0000, 0x0000, 0x0000 },
-    .sprite_trajectory_dv = { 0x0000, 0x0000, 0x0000 },
-    .quant_precision = 5,
-    .vop_fields = {
-        .bits = {
-            .vop_coding_type = 0,
-            .backward_reference_vop_coding_type = 0,
-            .vop_rounding_type = 1,
-            .intra_dc_vlc_thr = 0,
-            .top_field_first = 0,
-            .alternate_vertical_scan_flag = 0,
-        },
-    },
-    .vop_fcode_forward = 0,
-    .vop_fcode_backward = 0,
-    .vop_time_increment_resolution = 12,
-    .num_gobs_in_vop = 0,
-    .num_macroblocks_in_gob = 0,
-    .TRB = 0,
-    .TRD = 0,
-};
+/* Video object layer shapes */
+#define SHAPE_RECTANGULAR               0
 
-static const MPEG4SliceInfo mpeg4_slice_info[MPEG4_CLIP_SLICE_COUNT] = {
-    {
-        .slice_data_size = 21480,
-        .slice_data_offset = 0,
-        .macroblock_offset = 2,
-        .macroblock_number = 0,
-        .quant_scale = 4,
-    },
-};
+/* Sprite coding modes */
+#define SPRITE_NONE                     0
+#define SPRITE_STATIC                   1
+#define SPRITE_GMC                      2
+
+/* VOP coding types */
+#define I_TYPE                          0
+#define P_TYPE                          1
+#define B_TYPE                          2
+#define S_TYPE                          3
+
+/* Extended pixel aspect ratio */
+#define ASPECT_RATIO_EXTENDED_PAR       15
+
+struct _MPEG4Parser {
+    const uint8_t      *buf;
+    size_t              size;
+    size_t              pos;            // offset of the next start code
+    size_t              end;            // end of the current sample
+
+    /* MP4 input, with the VOL header in the track configuration */
+    MP4Demuxer         *mp4;
+    unsigned int        sample;         // next sample to read
+
+    /* Video object layer state */
+    MPEG4PictureInfo    vol_info;       // fields common to all VOPs
+    MPEG4IQMatrix       iq_matrix;
+    unsigned int        has_vol;
+    unsigned int        time_increment_bits;
+    unsigned int        mb_num;
+    unsigned int        reduced_resolution_vop_enable;
 
-static const MPEG4IQMatrix mpeg4_iq_matrix = {
-    .load_intra_quant_mat = 0,
-    .intra_quant_mat = { 0, },
-    .load_non_intra_quant_mat = 0,
-    .non_intra_quant_mat = { 0, },
+    /* Time of the last anchor VOPs, in vop_time_increment_resolution
+       units, and the seconds of the current GOV */
+    unsigned int        time_base;
+    unsigned int        last_time_base;
+    int64_t             last_non_b_time;
+    int                 pp_time;
+
+    /* Reference tracking, by VOP decoding order */
+    unsigned int        num_frames;
+    int                 past_reference;
+    int                 future_reference;
+    unsigned int        future_reference_type;
+
+    MPEG4SliceInfo     *slices;
+    unsigned int        slices_size;
 };
 
-void mpeg4_get_video_data(const uint8_t **data, unsigned int *size)
+/* Returns the number of bits needed to code values up to N - 1 */
+static unsigned int bits_for(unsigned int n)
+{
+    unsigned int bits = 1;
+
+    while (n > (1U << bits))
+        bits++;
+    return bits;
+}
+
+static int skip_marker(GetBitContext *gb)
+{
+    return get_bits1(gb) ? 0 : -1;
+}
+
+/* Reads a quantiser matrix, whose last value is repeated after a 0 */
+static void read_quant_matrix(GetBitContext *gb, uint8_t matrix[64])
+{
+    unsigned int i, v, last = 0;
+
+    for (i = 0; i < 64; i++) {
+        v = get_bits(gb, 8);
+        if (v == 0)
+            break;
+        matrix[i] = last = v;
+    }
+    for (; i < 64; i++)
+        matrix[i] = last;
+}
+
+/* Parses a video object layer header (6.2.3), for rectangular shapes
+   without scalability or complexity estimation */
+static int parse_vol(MPEG4Parser *parser, GetBitContext *gb)
+{
+    MPEG4PictureInfo * const vol_info = &parser->vol_info;
+    MPEG4IQMatrix * const iq_matrix = &parser->iq_matrix;
+    unsigned int verid = 1, resolution, mb_width, mb_height;
+
+    memset(vol_info, 0, sizeof(*vol_info));
+    memset(iq_matrix, 0, sizeof(*iq_matrix));
+    parser->has_vol = 0;
+
+    skip_bits(gb, 1 + 8);               // random_accessible_vol, video_object_type_indication
+    if (get_bits1(gb)) {                // is_object_layer_identifier
+        verid = get_bits(gb, 4);
+        skip_bits(gb, 3);               // video_object_layer_priority
+    }
+    if (get_bits(gb, 4) == ASPECT_RATIO_EXTENDED_PAR)
+        skip_bits(gb, 8 + 8);           // par_width, par_height
+
+    vol_info->vol_fields.bits.chroma_format = 1;
+    if (get_bits1(gb)) {                // vol_control_parameters
+        vol_info->vol_fields.bits.chroma_format = get_bits(gb, 2);
+        skip_bits(gb, 1);               // low_delay
+        if (get_bits1(gb)) {            // vbv_parameters
+            skip_bits(gb, 15 + 1 + 15 + 1); // bit_rate
+            skip_bits(gb, 15 + 1 + 3);  // vbv_buffer_size
+            skip_bits(gb, 11 + 1 + 15 + 1); // vbv_occupancy
+        }
+    }
+    if (get_bits(gb, 2) != SHAPE_RECTANGULAR) {
+        D(bug("unsupported video object layer shape\n"));
+        return -1;
+    }
+
+    if (skip_marker(gb) < 0)
+        return -1;
+    resolution = get_bits(gb, 16);
+    if (resolution == 0 || skip_marker(gb) < 0)
+        return -1;
+    vol_info->vop_time_increment_resolution = resolution;
+    parser->time_increment_bits = bits_for(resolution);
+    if (get_bits1(gb))                  // fixed_vop_rate
+        skip_bits(gb, parser->time_increment_bits);
+
+    if (skip_marker(gb) < 0)
+        return -1;
+    vol_info->width = get_bits(gb, 13);
+    if (skip_marker(gb) < 0)
+        return -1;
+    vol_info->height = get_bits(gb, 13);
+    if (skip_marker(gb) < 0)
+        return -1;
+    if (vol_info->width == 0 || vol_info->height == 0)
+        return -1;
+
+    vol_info->vol_fields.bits.interlaced   = get_bits1(gb);
+    vol_info->vol_fields.bits.obmc_disable = get_bits1(gb);
+    vol_info->vol_fields.bits.sprite_enable = get_bits(gb, verid == 1 ? 1 : 2);
+    switch (vol_info->vol_fields.bits.sprite_enable) {
+    case SPRITE_NONE:
+        break;
+    case SPRITE_GMC:
+        /* Global motion compensation is accepted, but not S-VOPs */
+        vol_info->no_of_sprite_warping_points = get_bits(gb, 6);
+        vol_info->vol_fields.bits.sprite_warping_accuracy = get_bits(gb, 2);
+        skip_bits(gb, 1);               // sprite_brightness_change
+        break;
+    default:
+        D(bug("unsupported static sprites\n"));
+        return -1;
+    }
+
+    vol_info->quant_precision = 5;
+    if (get_bits1(gb)) {                // not_8_bit
+        vol_info->quant_precision = get_bits(gb, 4);
+        if (get_bits(gb, 4) != 8) {     // bits_per_pixel
+            D(bug("unsupported pixel depth\n"));
+            return -1;
+        }
+    }
+
+    vol_info->vol_fields.bits.quant_type = get_bits1(gb);
+    if (vol_info->vol_fields.bits.quant_type) {
+        if ((iq_matrix->load_intra_quant_mat = get_bits1(gb)))
+            read_quant_matrix(gb, iq_matrix->intra_quant_mat);
+        if ((iq_matrix->load_non_intra_quant_mat = get_bits1(gb)))
+            read_quant_matrix(gb, iq_matrix->non_intra_quant_mat);
+    }
+    if (verid != 1)
+        vol_info->vol_fields.bits.quarter_sample = get_bits1(gb);
+
+    if (!get_bits1(gb)) {               // complexity_estimation_disable
+        D(bug("unsupported complexity estimation\n"));
+        return -1;
+    }
+    vol_info->vol_fields.bits.resync_marker_disable = get_bits1(gb);
+    vol_info->vol_fields.bits.data_partitioned      = get_bits1(gb);
+    if (vol_info->vol_fields.bits.data_partitioned)
+        vol_info->vol_fields.bits.reversible_vlc    = get_bits1(gb);
+
+    parser->reduced_resolution_vop_enable = 0;
+    if (verid != 1) {
+        if (get_bits1(gb)) {            // newpred_enable
+            D(bug("unsupported NEWPRED\n"));
+            return -1;
+        }
+        parser->reduced_resolution_vop_enable = get_bits1(gb);
+    }
+    if (get_bits1(gb)) {                // scalability
+        D(bug("unsupported scalability\n"));
+        return -1;
+    }
+    if (get_bits_left(gb) < 0)
+        return -1;
+
+    mb_width  = (vol_info->width  + 15) / 16;
+    mb_height = (vol_info->height + 15) / 16;
+    parser->mb_num  = mb_width * mb_height;
+    parser->has_vol = 1;
+    return 0;
+}
+
+/* Returns the number of zeros of the resync marker, before a 1 */
+static unsigned int resync_marker_length(const MPEG4PictureInfo *pic_info)
+{
+    switch (pic_info->vop_fields.bits.vop_coding_type) {
+    case P_TYPE:
+        return 15 + pic_info->vop_fcode_forward;
+    case B_TYPE:
+        return 15 + MAX(MAX(pic_info->vop_fcode_forward,
+                            pic_info->vop_fcode_backward), 2);
+    }
+    return 16;
+}
+
+/* Parses a VOP header (6.2.5), up to the macroblock data. Returns 1 if
+   the VOP is coded, 0 otherwise, or -1 on error */
+static int
+parse_vop(MPEG4Parser *parser, MPEG4Picture *picture, GetBitContext *gb,
+          unsigned int *vop_quant)
+{
+    MPEG4PictureInfo * const pic_info = &picture->pic_info;
+    unsigned int vop_coding_type;
+    int64_t time;
+
+    *pic_info = parser->vol_info;
+    picture->iq_matrix = parser->iq_matrix;
+
+    vop_coding_type = get_bits(gb, 2);
+    pic_info->vop_fields.bits.vop_coding_type = vop_coding_type;
+    while (get_bits1(gb))
+        picture->modulo_time_base++;
+    if (skip_marker(gb) < 0)
+        return -1;
+    picture->vop_time_increment = get_bits(gb, parser->time_increment_bits);
+    if (skip_marker(gb) < 0)
+        return -1;
+
+    /* Distances to the anchor VOPs, for direct mode in B-VOPs (7.7.2.1) */
+    if (vop_coding_type != B_TYPE) {
+        parser->last_time_base = parser->time_base;
+        parser->time_base     += picture->modulo_time_base;
+        time = (int64_t)parser->time_base * pic_info->vop_time_increment_resolution +
+            picture->vop_time_increment;
+        parser->pp_time         = time - parser->last_non_b_time;
+        parser->last_non_b_time = time;
+    }
+    else {
+        time = (int64_t)(parser->last_time_base + picture->modulo_time_base) *
+            pic_info->vop_time_increment_resolution + picture->vop_time_increment;
+        pic_info->TRD = parser->pp_time;
+        pic_info->TRB = parser->pp_time - (parser->last_non_b_time - time);
+    }
+
+    if (!get_bits1(gb))                 // vop_coded
+        return 0;
+
+    if (vop_coding_type == S_TYPE) {
+        D(bug("unsupported S-VOP\n"));
+        return -1;
+    }
+    if (vop_coding_type == P_TYPE)
+        pic_info->vop_fields.bits.vop_rounding_type = get_bits1(gb);
+    if (parser->reduced_resolution_vop_enable && vop_coding_type != B_TYPE &&
+        get_bits1(gb)) {
+        D(bug("unsupported reduced resolution VOP\n"));
+        return -1;
+    }
+    pic_info->vop_fields.bits.intra_dc_vlc_thr = get_bits(gb, 3);
+    if (pic_info->vol_fields.bits.interlaced) {
+        pic_info->vop_fields.bits.top_field_first = get_bits1(gb);
+        pic_info->vop_fields.bits.alternate_vertical_scan_flag = get_bits1(gb);
+    }
+    *vop_quant = get_bits(gb, pic_info->quant_precision);
+    if (*vop_quant == 0)
+        return -1;
+    if (vop_coding_type != I_TYPE) {
+        pic_info->vop_fcode_forward = get_bits(gb, 3);
+        if (pic_info->vop_fcode_forward == 0)
+            return -1;
+    }
+    if (vop_coding_type == B_TYPE) {
+        pic_info->vop_fcode_backward = get_bits(gb, 3);
+        if (pic_info->vop_fcode_backward == 0)
+            return -1;
+        pic_info->vop_fields.bits.backward_reference_vop_coding_type =
+            parser->future_reference_type;
+    }
+    return get_bits_left(gb) < 0 ? -1 : 1;
+}
+
+/* Parses a video packet header (6.2.5.2) past its resync marker, into
+   SLICE. Returns -1 if it is not a valid one */
+static int
+parse_video_packet_header(MPEG4Parser *parser, const MPEG4PictureInfo *pic_info,
+                          GetBitContext *gb, MPEG4SliceInfo *slice)
 {
+    const unsigned int vop_coding_type = pic_info->vop_fields.bits.vop_coding_type;
+
+    slice->macroblock_number = get_bits(gb, bits_for(parser->mb_num));
+    if (slice->macroblock_number == 0 || slice->macroblock_number >= parser->mb_num)
+        return -1;
+    slice->quant_scale = get_bits(gb, pic_info->quant_precision);
+    if (slice->quant_scale == 0)
+        return -1;
+
+    if (get_bits1(gb)) {                // header_extension_code
+        while (get_bits1(gb))           // modulo_time_base
+            ;
+        if (skip_marker(gb) < 0)
+            return -1;
+        skip_bits(gb, parser->time_increment_bits);
+        if (skip_marker(gb) < 0)
+            return -1;
+        if (get_bits(gb, 2) != vop_coding_type)
+            return -1;
+        skip_bits(gb, 3);               // intra_dc_vlc_thr
+        if (parser->reduced_resolution_vop_enable && vop_coding_type != B_TYPE)
+            skip_bits(gb, 1);           // vop_reduced_resolution
+        if (vop_coding_type != I_TYPE)
+            skip_bits(gb, 3);           // vop_fcode_forward
+        if (vop_coding_type == B_TYPE)
+            skip_bits(gb, 3);           // vop_fcode_backward
+    }
+    return get_bits_left(gb) < 0 ? -1 : 0;
+}
+
+/* Splits the VOP at OFFSET into a slice per video packet. Resync markers
+   are byte aligned and cannot be emulated by macroblock data */
+static int
+add_slices(MPEG4Parser *parser, MPEG4Picture *picture, size_t offset,
+           unsigned int size, unsigned int header_bits, unsigned int vop_quant)
+{
+    const uint8_t * const vop = parser->buf + offset;
+    const unsigned int marker_length =
+        resync_marker_length(&picture->pic_info) + 1;
+    MPEG4SliceInfo *slices, *slice, next_slice;
+    unsigned int pos, count = 1;
+    GetBitContext gb;
+
+    slices = fast_realloc(parser->slices, &parser->slices_size,
+                          sizeof(*slice));
+    if (!slices)
+        return -1;
+    parser->slices = slices;
+
+    slice = &parser->slices[0];
+    memset(slice, 0, sizeof(*slice));
+    slice->slice_data_offset = offset + header_bits / 8;
+    slice->macroblock_offset = header_bits % 8;
+    slice->quant_scale       = vop_quant;
+
+    pos = (header_bits + 7) / 8;
+    if (picture->pic_info.vol_fields.bits.resync_marker_disable)
+        pos = size;
+
+    for (; pos + 2 < size; pos++) {
+        if (vop[pos] != 0 || vop[pos + 1] != 0)
+            continue;
+        init_get_bits(&gb, vop + pos, size - pos);
+        if (get_bits(&gb, marker_length) != 1)
+            continue;
+
+        memset(&next_slice, 0, sizeof(next_slice));
+        if (parse_video_packet_header(parser, &picture->pic_info, &gb,
+                                      &next_slice) < 0)
+            continue;
+        next_slice.slice_data_offset = offset + pos + get_bits_count(&gb) / 8;
+        next_slice.macroblock_offset = get_bits_count(&gb) % 8;
+
+        slices = fast_realloc(parser->slices, &parser->slices_size,
+                              (count + 1) * sizeof(*slice));
+        if (!slices)
+            return -1;
+        parser->slices = slices;
+        slice = &parser->slices[count - 1];
+        slice->slice_data_size = offset + pos - slice->slice_data_offset;
+        parser->slices[count++] = next_slice;
+        pos += get_bits_count(&gb) / 8;
+    }
+    slice = &parser->slices[count - 1];
+    slice->slice_data_size = offset + size - slice->slice_data_offset;
+
+    picture->slices      = parser->slices;
+    picture->slice_count = count;
+    return 0;
+}
+
+/* Assigns the VOP and its reference VOPs, in decoding order */
+static void update_references(MPEG4Parser *parser, MPEG4Picture *picture)
+{
+    const unsigned int vop_coding_type =
+        picture->pic_info.vop_fields.bits.vop_coding_type;
+
+    picture->frame_num = parser->num_frames++;
+    switch (vop_coding_type) {
+    case I_TYPE:
+    case P_TYPE:
+        picture->forward_reference  = (vop_coding_type == P_TYPE ?
+                                       parser->future_reference : -1);
+        picture->backward_reference = -1;
+        parser->past_reference        = parser->future_reference;
+        parser->future_reference      = picture->frame_num;
+        parser->future_reference_type = vop_coding_type;
+        break;
+    default:
+        picture->forward_reference  = parser->past_reference;
+        picture->backward_reference = parser->future_reference;
+        break;
+    }
+}
+
+/* Locates the next start code unit, within the current MP4 sample if
+   any. Returns 1 if there is one, 0 at the end of the stream, or -1 on
+   error */
+static int
+next_unit(MPEG4Parser *parser, size_t *poffset, unsigned int *psize)
+{
+    const MP4TrackInfo *track;
+    size_t pos;
+    MP4Sample sample;
+
+    for (;;) {
+        pos = startcode_find(parser->buf, parser->pos, parser->end);
+        if (pos + 4 <= parser->end)
+            break;
+        if (!parser->mp4)
+            return 0;
+
+        track = mp4_get_track_info(parser->mp4);
+        if (parser->sample >= track->num_samples)
+            return 0;
+        if (mp4_get_sample(parser->mp4, parser->sample++, &sample) < 0)
+            return -1;
+        parser->pos = sample.data - parser->buf;
+        parser->end = parser->pos + sample.size;
+    }
+    parser->pos = startcode_find(parser->buf, pos + 3, parser->end);
+    *poffset = pos;
+    *psize   = parser->pos - pos;
+    return 1;
+}
+
+/* Parses the headers of a start code unit other than a VOP */
+static int parse_header(MPEG4Parser *parser, const uint8_t *buf, unsigned int size)
+{
+    const unsigned int code = buf[3];
+    GetBitContext gb;
+
+    init_get_bits(&gb, buf + 4, size - 4);
+    if (code >= VOL_START_CODE_MIN && code <= VOL_START_CODE_MAX)
+        return parse_vol(parser, &gb);
+    if (code == GOV_START_CODE && get_bits_left(&gb) >= 18) {
+        /* time_code, as the seconds of the next VOPs */
+        parser->time_base  = get_bits(&gb, 5) * 3600;
+        parser->time_base += get_bits(&gb, 6) * 60;
+        skip_bits(&gb, 1);              // marker_bit
+        parser->time_base += get_bits(&gb, 6);
+    }
+    return 0;
+}
+
+/* Parses the video object layer in the configuration of an MP4 track */
+static int parse_decoder_specific_info(MPEG4Parser *parser)
+{
+    const MP4TrackInfo * const track = mp4_get_track_info(parser->mp4);
+    unsigned int pos, next;
+
+    if (track->codec != MP4_FOURCC('m','p','4','v') || !track->config)
+        return -1;
+
+    pos = startcode_find(track->config, 0, track->config_size);
+    for (; pos + 4 <= track->config_size; pos = next) {
+        next = startcode_find(track->config, pos + 3, track->config_size);
+        if (parse_header(parser, track->config + pos, next - pos) < 0)
+            return -1;
+    }
+    return parser->has_vol ? 0 : -1;
+}
+
+MPEG4Parser *mpeg4_parser_new(const uint8_t *buf, size_t size)
+{
+    MPEG4Parser *parser;
+
+    parser = calloc(1, sizeof(*parser));
+    if (!parser)
+        return NULL;
+
+    parser->buf              = buf;
+    parser->size             = size;
+    parser->end              = size;
+    parser->past_reference   = -1;
+    parser->future_reference = -1;
+
+    /* MP4 files keep the VOL header in the track configuration */
+    if (size >= 8 && memcmp(buf + 4, "ftyp", 4) == 0) {
+        parser->mp4 = mp4_open_memory(buf, size);
+        parser->end = 0;
+        if (!parser->mp4 || parse_decoder_specific_info(parser) < 0) {
+            D(bug("no MPEG-4 video track in MP4 file\n"));
+            mpeg4_parser_destroy(parser);
+            return NULL;
+        }
+    }
+    return parser;
+}
+
+void mpeg4_parser_destroy(MPEG4Parser *parser)
+{
+    if (!parser)
+        return;
+
+    mp4_close(parser->mp4);
+    free(parser->slices);
+    free(parser);
+}
+
+int mpeg4_parser_get_picture(MPEG4Parser *parser, MPEG4Picture *picture)
+{
+    const uint8_t * const buf = parser->buf;
+    size_t offset;
+    unsigned int size, code, vop_quant;
+    GetBitContext gb;
+    int ret;
+
+    input_release(parser->buf + parser->pos);
+
+    while ((ret = next_unit(parser, &offset, &size)) > 0) {
+        code = buf[offset + 3];
+        if (code != VOP_START_CODE) {
+            if (parse_header(parser, buf + offset, size) < 0)
+                return -1;
+            continue;
+        }
+        if (!parser->has_vol)
+            continue;
+
+        memset(picture, 0, sizeof(*picture));
+        init_get_bits(&gb, buf + offset + 4, size - 4);
+        if ((ret = parse_vop(parser, picture, &gb, &vop_quant)) < 0)
+            return -1;
+        if (ret == 0)                   // not coded
+            continue;
+
+        if (add_slices(parser, picture, offset, size, 32 + get_bits_count(&gb),
+                       vop_quant) < 0)
+            return -1;
+        update_references(parser, picture);
+        return 1;
+    }
+    return ret;
+}
+
+/* Parses the first picture of the video data, only once */
+static const MPEG4Picture *get_picture(void)
+{
+    static MPEG4Parser *parser;
+    static MPEG4Picture picture;
+    const uint8_t *data;
+    size_t size;
+
+    if (!parser) {
+        mpeg4_get_video_data(&data, &size);
+        parser = mpeg4_parser_new(data, size);
+        if (!parser || mpeg4_parser_get_picture(parser, &picture) != 1) {
+            D(bug("failed to parse the first MPEG-4 picture\n"));
+            memset(&picture, 0, sizeof(picture));
+        }
+    }
+    return &picture;
+}
+
+void mpeg4_get_video_data(const uint8_t **data, size_t *size)
+{
+    if (input_get_data(data, size))
+        return;
     *data = mpeg4_clip;
     *size = MPEG4_CLIP_DATA_SIZE;
 }
 
 void mpeg4_get_picture_info(MPEG4PictureInfo *pic_info)
 {
-    memcpy(pic_info, &mpeg4_pic_info, sizeof(*pic_info));
+    memcpy(pic_info, &get_picture()->pic_info, sizeof(*pic_info));
 }
 
 void mpeg4_get_iq_matrix(MPEG4IQMatrix *iq_matrix)
 {
-    memcpy(iq_matrix, &mpeg4_iq_matrix, sizeof(*iq_matrix));
+    memcpy(iq_matrix, &get_picture()->iq_matrix, sizeof(*iq_matrix));
 }
 
 int mpeg4_get_slice_count(void)
 {
-    return MPEG4_CLIP_SLICE_COUNT;
+    return get_picture()->slice_count;
 }
 
 int mpeg4_get_slice_info(int slice, MPEG4SliceInfo *slice_info)
 {
-    if (slice < 0 || slice >= MPEG4_CLIP_SLICE_COUNT)
+    const MPEG4Picture * const picture = get_picture();
+
+    if (slice < 0 || slice >= (int)picture->slice_count)
         return -1;
-    memcpy(slice_info, &mpeg4_slice_info[slice], sizeof(*slice_info));
+    memcpy(slice_info, &picture->slices[slice], sizeof(*slice_info));
     return 0;
 }
 
 int mpeg4_get_slice_data(int slice, const uint8_t **data, unsigned int *size)
 {
-    const MPEG4SliceInfo *slice_info;
-    if (slice < 0 || slice >= MPEG4_CLIP_SLICE_COUNT)
+    const MPEG4Picture * const picture = get_picture();
+    const uint8_t *video_data;
+    size_t video_data_size;
+
+    if (slice < 0 || slice >= (int)picture->slice_count)
         return -1;
-    slice_info = &mpeg4_slice_info[slice];
-    *data = &mpeg4_clip[MPEG4_CLIP_SLICE_OFFSET + slice_info->slice_data_offset];
-    *size = slice_info->slice_data_size;
+    mpeg4_get_video_data(&video_data, &video_data_size);
+    *data = video_data + picture->slices[slice].slice_data_offset;
+    *size = picture->slices[slice].slice_data_size;
     return 0;
 }
@@ -24,6 +24,8 @@
 typedef struct _MPEG4PictureInfo MPEG4PictureInfo;
 typedef struct _MPEG4IQMatrix    MPEG4IQMatrix;
 typedef struct _MPEG4SliceInfo   MPEG4SliceInfo;
+typedef struct _MPEG4Picture     MPEG4Picture;
+typedef struct _MPEG4Parser      MPEG4Parser;
 
 struct _MPEG4PictureInfo
 {
@@ -69,6 +71,7 @@ struct _MPEG4PictureInfo
     short               TRD;
 };
 
+// Quantiser matrices are in zig-zag scan order, as in the bitstream
 struct _MPEG4IQMatrix {
     unsigned char       load_intra_quant_mat;
     unsigned char       load_non_intra_quant_mat;
@@ -78,13 +81,40 @@ struct _MPEG4IQMatrix {
 
 struct _MPEG4SliceInfo {
     unsigned int        slice_data_size;
-    unsigned int        slice_data_offset;
+    size_t              slice_data_offset;
     unsigned int        macroblock_offset;
     unsigned int        macroblock_number;
     int                 quant_scale;
 };
 
-void mpeg4_get_video_data(const uint8_t **data, unsigned int *size);
+// A VOP, with a slice per video packet. Slice data starts at the byte
+// holding the first macroblock bit, and macroblock_offset counts the
+// bits of that byte to skip
+struct _MPEG4Picture {
+    MPEG4PictureInfo    pic_info;
+    MPEG4IQMatrix       iq_matrix;
+    MPEG4SliceInfo     *slices;         // offsets are relative to the stream
+    unsigned int        slice_count;
+    unsigned int        frame_num;      // decoding order of the VOP
+    unsigned int        modulo_time_base;
+    unsigned int        vop_time_increment;
+    int                 forward_reference;
+    int                 backward_reference;
+};
+
+// Creates a parser over the SIZE bytes of an elementary stream or an MP4
+// file in BUF, which must outlive the parser
+MPEG4Parser *mpeg4_parser_new(const uint8_t *buf, size_t size);
+void mpeg4_parser_destroy(MPEG4Parser *parser);
+
+// Parses the next coded VOP. Returns 1 if PICTURE was filled in, 0 at the
+// end of the stream, or -1 on error. PICTURE->slices remains valid until
+// the next call
+int mpeg4_parser_get_picture(MPEG4Parser *parser, MPEG4Picture *picture);
+
+void mpeg4_get_video_data(const uint8_t **data, size_t *size);
+
+// Accessors to the first picture of the video data
 void mpeg4_get_picture_info(MPEG4PictureInfo *pic_info);
 void mpeg4_get_iq_matrix(MPEG4IQMatrix *iq_matrix);
 int mpeg4_get_slice_count(void);
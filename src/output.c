@@ -0,0 +1,529 @@
+/*
+ *  output.c - Decoded frames output
+ *
+ *  hwdecode-demos (C) 2009-2010 Splitted-Desktop Systems
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "sysdeps.h"
+#include "output.h"
+#include "utils.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <stdarg.h>
+#include <strings.h>
+#include <unistd.h>
+#include <sys/uio.h>
+
+#define DEBUG 1
+#include "debug.h"
+
+/* Staging buffer for headers and repacked rows */
+#define OUTPUT_BUFFER_SIZE      (4 * 1024 * 1024)
+
+/* O_DIRECT buffer, size and file offset alignment */
+#define OUTPUT_DIRECT_ALIGN     4096
+
+#if defined(IOV_MAX) && IOV_MAX < 1024
+#define OUTPUT_MAX_IOVECS       IOV_MAX
+#else
+#define OUTPUT_MAX_IOVECS       1024
+#endif
+
+struct _Output {
+    int                 fd;
+    enum OutputFormat   format;
+    unsigned int        use_direct_io;
+    uint8_t            *buffer;
+    unsigned int        buffer_len;
+    struct iovec        iovecs[OUTPUT_MAX_IOVECS];
+    unsigned int        num_iovecs;
+    unsigned int        num_frames;
+    unsigned int        width;
+    unsigned int        height;
+};
+
+static const struct {
+    const char         *ext;
+    enum OutputFormat   format;
+}
+output_extensions[] = {
+    { "ppm",    OUTPUT_FORMAT_PPM       },
+    { "y4m",    OUTPUT_FORMAT_Y4M       },
+    { "yuv",    OUTPUT_FORMAT_YUV       },
+    { "nv12",   OUTPUT_FORMAT_NV12      },
+};
+
+static enum OutputFormat get_format_from_filename(const char *filename)
+{
+    const char *ext = strrchr(filename, '.');
+    unsigned int i;
+
+    if (ext) {
+        for (i = 0; i < ARRAY_ELEMS(output_extensions); i++) {
+            if (strcasecmp(ext + 1, output_extensions[i].ext) == 0)
+                return output_extensions[i].format;
+        }
+    }
+    return OUTPUT_FORMAT_PPM;
+}
+
+static int write_all(int fd, const uint8_t *buf, size_t size)
+{
+    ssize_t n;
+
+    while (size > 0) {
+        n = write(fd, buf, size);
+        if (n < 0) {
+            if (errno == EINTR)
+                continue;
+            return -1;
+        }
+        buf  += n;
+        size -= n;
+    }
+    return 0;
+}
+
+static int writev_all(int fd, struct iovec *iov, unsigned int count)
+{
+    ssize_t n;
+
+    while (count > 0) {
+        n = writev(fd, iov, count);
+        if (n < 0) {
+            if (errno == EINTR)
+                continue;
+            return -1;
+        }
+
+        /* Skip what was written, and resume within a partial iovec */
+        while (count > 0 && (size_t)n >= iov->iov_len) {
+            n -= iov->iov_len;
+            iov++;
+            count--;
+        }
+        if (count > 0) {
+            iov->iov_base  = (uint8_t *)iov->iov_base + n;
+            iov->iov_len  -= n;
+        }
+    }
+    return 0;
+}
+
+/* Writes out pending data. O_DIRECT writes are kept to multiples of
+   the alignment, until the last one for which O_DIRECT is disabled */
+static int output_flush(Output *out, int is_final)
+{
+    unsigned int size;
+
+    if (!out->use_direct_io) {
+        if (writev_all(out->fd, out->iovecs, out->num_iovecs) < 0)
+            return -1;
+        out->num_iovecs = 0;
+        out->buffer_len = 0;
+        return 0;
+    }
+
+    size = out->buffer_len & ~(OUTPUT_DIRECT_ALIGN - 1);
+    if (size > 0) {
+        if (write_all(out->fd, out->buffer, size) < 0)
+            return -1;
+        out->buffer_len -= size;
+        memmove(out->buffer, out->buffer + size, out->buffer_len);
+    }
+
+    if (is_final && out->buffer_len > 0) {
+#ifdef O_DIRECT
+        const int flags = fcntl(out->fd, F_GETFL);
+        if (flags < 0 || fcntl(out->fd, F_SETFL, flags & ~O_DIRECT) < 0)
+            return -1;
+#endif
+        if (write_all(out->fd, out->buffer, out->buffer_len) < 0)
+            return -1;
+        out->buffer_len = 0;
+    }
+    return 0;
+}
+
+static int output_add_iovec(Output *out, const uint8_t *data, unsigned int size)
+{
+    struct iovec *iov;
+
+    /* Merge with the previous chunk if contiguous, e.g. unpadded rows */
+    if (out->num_iovecs > 0) {
+        iov = &out->iovecs[out->num_iovecs - 1];
+        if ((const uint8_t *)iov->iov_base + iov->iov_len == data) {
+            iov->iov_len += size;
+            return 0;
+        }
+    }
+
+    if (out->num_iovecs == OUTPUT_MAX_IOVECS && output_flush(out, 0) < 0)
+        return -1;
+
+    iov = &out->iovecs[out->num_iovecs++];
+    iov->iov_base = (void *)data;
+    iov->iov_len  = size;
+    return 0;
+}
+
+/* Returns SIZE bytes from the staging buffer, to be filled in by the
+   caller before the next output operation */
+static uint8_t *output_reserve(Output *out, unsigned int size)
+{
+    uint8_t *data;
+
+    if (size > OUTPUT_BUFFER_SIZE)
+        return NULL;
+
+    /* Flush first if the chunk cannot be queued right away */
+    if (out->buffer_len + size > OUTPUT_BUFFER_SIZE ||
+        (!out->use_direct_io && out->num_iovecs == OUTPUT_MAX_IOVECS)) {
+        if (output_flush(out, 0) < 0)
+            return NULL;
+        if (out->buffer_len + size > OUTPUT_BUFFER_SIZE)
+            return NULL;
+    }
+
+    data = out->buffer + out->buffer_len;
+    out->buffer_len += size;
+
+    if (!out->use_direct_io)
+        output_add_iovec(out, data, size);
+    return data;
+}
+
+static int output_copy(Output *out, const void *data, unsigned int size)
+{
+    uint8_t *dst;
+
+    while (size > 0) {
+        const unsigned int n = MIN(size, OUTPUT_BUFFER_SIZE / 2);
+        if ((dst = output_reserve(out, n)) == NULL)
+            return -1;
+        memcpy(dst, data, n);
+        data  = (const uint8_t *)data + n;
+        size -= n;
+    }
+    return 0;
+}
+
+/* Queues DATA to be written without a copy. It must stay valid until
+   the end of the current frame */
+static int output_ref(Output *out, const uint8_t *data, unsigned int size)
+{
+    if (out->use_direct_io)
+        return output_copy(out, data, size);
+    return output_add_iovec(out, data, size);
+}
+
+static int output_printf(Output *out, const char *format, ...)
+{
+    char str[256];
+    va_list args;
+    int len;
+
+    va_start(args, format);
+    len = vsnprintf(str, sizeof(str), format, args);
+    va_end(args);
+    if (len < 0 || len >= sizeof(str))
+        return -1;
+    return output_copy(out, str, len);
+}
+
+static int
+output_write_plane(
+    Output        *out,
+    const uint8_t *src,
+    unsigned int   src_stride,
+    unsigned int   row_bytes,
+    unsigned int   rows
+)
+{
+    unsigned int y;
+
+    for (y = 0; y < rows; y++, src += src_stride) {
+        if (output_ref(out, src, row_bytes) < 0)
+            return -1;
+    }
+    return 0;
+}
+
+/* Splits the interleaved UV plane of NV12 images */
+static int
+output_write_plane_NV12_to_I420(
+    Output        *out,
+    const uint8_t *src,
+    unsigned int   src_stride,
+    unsigned int   width,
+    unsigned int   height
+)
+{
+    const uint8_t *s;
+    uint8_t *dst;
+    unsigned int c, x, y;
+
+    for (c = 0; c < 2; c++) {
+        for (y = 0, s = src + c; y < height; y++, s += src_stride) {
+            if ((dst = output_reserve(out, width)) == NULL)
+                return -1;
+            for (x = 0; x < width; x++)
+                dst[x] = s[2*x];
+        }
+    }
+    return 0;
+}
+
+static int
+output_write_planes_I420_to_NV12(
+    Output        *out,
+    const uint8_t *u,
+    unsigned int   u_stride,
+    const uint8_t *v,
+    unsigned int   v_stride,
+    unsigned int   width,
+    unsigned int   height
+)
+{
+    uint8_t *dst;
+    unsigned int x, y;
+
+    for (y = 0; y < height; y++, u += u_stride, v += v_stride) {
+        if ((dst = output_reserve(out, 2 * width)) == NULL)
+            return -1;
+        for (x = 0; x < width; x++) {
+            dst[2*x + 0] = u[x];
+            dst[2*x + 1] = v[x];
+        }
+    }
+    return 0;
+}
+
+static int output_write_yuv(Output *out, Image *img)
+{
+    const unsigned int width   = img->width;
+    const unsigned int height  = img->height;
+    const unsigned int width2  = (width  + 1) / 2;
+    const unsigned int height2 = (height + 1) / 2;
+    unsigned int u_plane = 1, v_plane = 2;
+
+    if (output_write_plane(out, img->pixels[0], img->pitches[0],
+                           width, height) < 0)
+        return -1;
+
+    if (img->format == IMAGE_NV12) {
+        if (out->format == OUTPUT_FORMAT_NV12)
+            return output_write_plane(out, img->pixels[1], img->pitches[1],
+                                      2 * width2, height2);
+        return output_write_plane_NV12_to_I420(out, img->pixels[1],
+                                               img->pitches[1],
+                                               width2, height2);
+    }
+
+    if (img->format == IMAGE_YV12) {
+        u_plane = 2;
+        v_plane = 1;
+    }
+
+    if (out->format == OUTPUT_FORMAT_NV12)
+        return output_write_planes_I420_to_NV12(out,
+                                                img->pixels[u_plane],
+                                                img->pitches[u_plane],
+                                                img->pixels[v_plane],
+                                                img->pitches[v_plane],
+                                                width2, height2);
+
+    if (output_write_plane(out, img->pixels[u_plane], img->pitches[u_plane],
+                           width2, height2) < 0)
+        return -1;
+    if (output_write_plane(out, img->pixels[v_plane], img->pitches[v_plane],
+                           width2, height2) < 0)
+        return -1;
+    return 0;
+}
+
+/* Packs rows to RGB24, one whole row per staging buffer chunk */
+static int output_write_ppm(Output *out, Image *img)
+{
+    const uint32_t *src = (const uint32_t *)img->pixels[0];
+    const unsigned int src_stride = img->pitches[0] / 4;
+    uint8_t *dst;
+    unsigned int x, y;
+
+    for (y = 0; y < img->height; y++, src += src_stride) {
+        if ((dst = output_reserve(out, 3 * img->width)) == NULL)
+            return -1;
+        for (x = 0; x < img->width; x++) {
+            const uint32_t color = src[x];
+            dst[3*x + 0] = color >> 16;
+            dst[3*x + 1] = color >> 8;
+            dst[3*x + 2] = color;
+        }
+    }
+    return 0;
+}
+
+static int output_write_header(Output *out, Image *img)
+{
+    switch (out->format) {
+    case OUTPUT_FORMAT_PPM:
+        return output_printf(out, "P6\n%u %u\n255\n", img->width, img->height);
+    case OUTPUT_FORMAT_Y4M:
+        if (out->num_frames == 0 &&
+            output_printf(out, "YUV4MPEG2 W%u H%u F25:1 Ip A1:1 C420mpeg2\n",
+                          img->width, img->height) < 0)
+            return -1;
+        return output_printf(out, "FRAME\n");
+    default:
+        break;
+    }
+    return 0;
+}
+
+static int is_native_format(enum OutputFormat format, uint32_t fourcc)
+{
+    if (format == OUTPUT_FORMAT_PPM)
+        return fourcc == IMAGE_RGB32;
+
+    switch (fourcc) {
+    case IMAGE_NV12:
+    case IMAGE_YV12:
+    case IMAGE_IYUV:
+    case IMAGE_I420:
+        return 1;
+    }
+    return 0;
+}
+
+Output *output_open(const char *filename, enum OutputFormat format,
+                    unsigned int flags)
+{
+    Output *out;
+    int open_flags = O_WRONLY|O_CREAT|O_TRUNC;
+
+    out = calloc(1, sizeof(*out));
+    if (!out)
+        return NULL;
+    out->fd = -1;
+
+    if (format == OUTPUT_FORMAT_AUTO)
+        format = get_format_from_filename(filename);
+    out->format = format;
+
+#ifdef O_DIRECT
+    if (flags & OUTPUT_FLAG_DIRECT) {
+        out->fd = open(filename, open_flags|O_DIRECT, 0666);
+        if (out->fd >= 0)
+            out->use_direct_io = 1;
+        else if (errno == EINVAL)
+            D(bug("O_DIRECT is not supported for %s\n", filename));
+    }
+#endif
+    if (out->fd < 0)
+        out->fd = open(filename, open_flags, 0666);
+    if (out->fd < 0)
+        goto error;
+
+    if (posix_memalign((void **)&out->buffer, OUTPUT_DIRECT_ALIGN,
+                       OUTPUT_BUFFER_SIZE) != 0) {
+        out->buffer = NULL;
+        goto error;
+    }
+
+    D(bug("output to %s (%s writes)\n", filename,
+          out->use_direct_io ? "direct" : "vectored"));
+    return out;
+
+error:
+    if (out->fd >= 0)
+        close(out->fd);
+    free(out);
+    return NULL;
+}
+
+int output_close(Output *out)
+{
+    int error = 0;
+
+    if (!out)
+        return 0;
+
+    if (output_flush(out, 1) < 0)
+        error = -1;
+    if (close(out->fd) < 0)
+        error = -1;
+    free(out->buffer);
+    free(out);
+    return error;
+}
+
+enum OutputFormat output_get_format(Output *out)
+{
+    return out->format;
+}
+
+int output_write_image(Output *out, Image *img)
+{
+    Image *tmp_img = NULL;
+    int error = -1;
+
+    if (out->num_frames > 0 && out->format != OUTPUT_FORMAT_PPM &&
+        (img->width != out->width || img->height != out->height)) {
+        fprintf(stderr, "ERROR: output frame size changed to %ux%u\n",
+                img->width, img->height);
+        return -1;
+    }
+
+    if (!is_native_format(out->format, img->format)) {
+        tmp_img = image_create(img->width, img->height,
+                               (out->format == OUTPUT_FORMAT_PPM ? IMAGE_RGB32 :
+                                out->format == OUTPUT_FORMAT_NV12 ? IMAGE_NV12 :
+                                IMAGE_I420));
+        if (!tmp_img || image_convert(tmp_img, img) < 0)
+            goto end;
+        img = tmp_img;
+    }
+
+    if (output_write_header(out, img) < 0)
+        goto end;
+
+    if (out->format == OUTPUT_FORMAT_PPM) {
+        if (output_write_ppm(out, img) < 0)
+            goto end;
+    }
+    else {
+        if (output_write_yuv(out, img) < 0)
+            goto end;
+    }
+
+    /* Rows referenced in place must be written before IMG changes */
+    if (!out->use_direct_io && output_flush(out, 0) < 0)
+        goto end;
+
+    out->width  = img->width;
+    out->height = img->height;
+    out->num_frames++;
+    error = 0;
+end:
+    if (error < 0 && !out->use_direct_io) {
+        out->num_iovecs = 0;
+        out->buffer_len = 0;
+    }
+    image_destroy(tmp_img);
+    return error;
+}
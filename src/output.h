@@ -0,0 +1,54 @@
+/*
+ *  output.h - Decoded frames output
+ *
+ *  hwdecode-demos (C) 2009-2010 Splitted-Desktop Systems
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef OUTPUT_H
+#define OUTPUT_H
+
+#include "image.h"
+
+enum OutputFormat {
+    OUTPUT_FORMAT_AUTO = 0,
+    OUTPUT_FORMAT_PPM,          // RGB24 PPM images, one per frame
+    OUTPUT_FORMAT_Y4M,          // YUV4MPEG2 stream, 4:2:0
+    OUTPUT_FORMAT_YUV,          // Raw planar YUV 4:2:0 (I420)
+    OUTPUT_FORMAT_NV12          // Raw semi-planar YUV 4:2:0 (NV12)
+};
+
+// Bypass the page cache with O_DIRECT writes, if supported
+#define OUTPUT_FLAG_DIRECT (1 << 0)
+
+typedef struct _Output Output;
+
+// Creates FILENAME for a sequence of frames. The AUTO format is
+// determined from the file extension and defaults to PPM
+Output *output_open(const char *filename, enum OutputFormat format,
+                    unsigned int flags);
+
+// Flushes pending data and closes the output file
+int output_close(Output *out);
+
+// Returns the actual format of the output file
+enum OutputFormat output_get_format(Output *out);
+
+// Appends a frame. YUV formats store 4:2:0 images as is, other
+// image formats are converted first
+int output_write_image(Output *out, Image *img);
+
+#endif /* OUTPUT_H */
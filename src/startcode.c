@@ -0,0 +1,262 @@
+/*
+ *  startcode.c - Start code scanner for elementary streams
+ *
+ *  hwdecode-demos (C) 2009-2010 Splitted-Desktop Systems
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "sysdeps.h"
+#include "startcode.h"
+#include "utils.h"
+#include "cpu.h"
+
+#define DEBUG 1
+#include "debug.h"
+
+#if USE_SIMD_X86
+#include <immintrin.h>
+#define TARGET(isa) __attribute__((__target__(isa)))
+#endif
+
+#if USE_SIMD_NEON
+#include <arm_neon.h>
+#endif
+
+/* Kernels return the offset of the first 00 00 XX sequence at or after
+   POS, with XX <= 3, i.e. either a start code prefix, an emulation
+   prevention byte or zero stuffing; or SIZE if there is none */
+typedef size_t (*startcode_find_func)(const uint8_t *buf,
+                                      size_t pos, size_t size);
+
+static size_t
+startcode_find_c(const uint8_t *buf, size_t pos, size_t size)
+{
+    size_t i;
+
+    /* I is the last byte of the sequence: skip as many bytes as can't
+       be part of one */
+    for (i = pos + 2; i < size;) {
+        if (buf[i] > 3)
+            i += 3;
+        else if (buf[i - 1])
+            i += 2;
+        else if (buf[i - 2])
+            i++;
+        else
+            return i - 2;
+    }
+    return size;
+}
+
+#if USE_SIMD_X86
+TARGET("sse2")
+static size_t
+startcode_find_sse2(const uint8_t *buf, size_t pos, size_t size)
+{
+    const __m128i zero  = _mm_setzero_si128();
+    const __m128i three = _mm_set1_epi8(3);
+    __m128i a, b, c;
+    unsigned int mask;
+
+    for (; pos + 18 <= size; pos += 16) {
+        /* Most blocks of compressed data have no zero byte at all */
+        a = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)(buf + pos)), zero);
+        if (!_mm_movemask_epi8(a))
+            continue;
+
+        b = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)(buf + pos + 1)), zero);
+        c = _mm_loadu_si128((const __m128i *)(buf + pos + 2));
+        c = _mm_cmpeq_epi8(_mm_min_epu8(c, three), c);
+        mask = _mm_movemask_epi8(_mm_and_si128(_mm_and_si128(a, b), c));
+        if (mask)
+            return pos + __builtin_ctz(mask);
+    }
+    return startcode_find_c(buf, pos, size);
+}
+
+TARGET("avx2")
+static size_t
+startcode_find_avx2(const uint8_t *buf, size_t pos, size_t size)
+{
+    const __m256i zero  = _mm256_setzero_si256();
+    const __m256i three = _mm256_set1_epi8(3);
+    __m256i a, b, c;
+    unsigned int mask = 0;
+
+    for (; pos + 34 <= size; pos += 32) {
+        a = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i *)(buf + pos)), zero);
+        if (!_mm256_movemask_epi8(a))
+            continue;
+
+        b = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i *)(buf + pos + 1)), zero);
+        c = _mm256_loadu_si256((const __m256i *)(buf + pos + 2));
+        c = _mm256_cmpeq_epi8(_mm256_min_epu8(c, three), c);
+        mask = _mm256_movemask_epi8(_mm256_and_si256(_mm256_and_si256(a, b), c));
+        if (mask)
+            break;
+    }
+    _mm256_zeroupper();
+    if (mask)
+        return pos + __builtin_ctz(mask);
+    return startcode_find_c(buf, pos, size);
+}
+#endif
+
+#if USE_SIMD_NEON
+static size_t
+startcode_find_neon(const uint8_t *buf, size_t pos, size_t size)
+{
+    const uint8x16_t zero  = vdupq_n_u8(0);
+    const uint8x16_t three = vdupq_n_u8(3);
+    uint8x16_t m;
+    uint64x2_t m64;
+
+    /* There is no movemask, so the scalar kernel locates the sequence
+       once a block has one */
+    for (; pos + 18 <= size; pos += 16) {
+        m = vandq_u8(vceqq_u8(vld1q_u8(buf + pos), zero),
+                     vceqq_u8(vld1q_u8(buf + pos + 1), zero));
+        m = vandq_u8(m, vcleq_u8(vld1q_u8(buf + pos + 2), three));
+        m64 = vreinterpretq_u64_u8(m);
+        if (vgetq_lane_u64(m64, 0) | vgetq_lane_u64(m64, 1))
+            break;
+    }
+    return startcode_find_c(buf, pos, size);
+}
+#endif
+
+static startcode_find_func startcode_find_candidate = startcode_find_c;
+
+/* Select the best scanner kernel for the host CPU, again if its features
+   were masked since */
+static void startcode_init_kernels(void)
+{
+    static int initialized = 0;
+    static unsigned int selected_features;
+    const unsigned int features = cpu_get_features();
+    const char *find_isa = "c";
+
+    if (initialized && features == selected_features)
+        return;
+    initialized = 1;
+    selected_features = features;
+
+    startcode_find_candidate = startcode_find_c;
+#if USE_SIMD_X86
+    if (features & CPU_FEATURE_AVX2) {
+        startcode_find_candidate = startcode_find_avx2;
+        find_isa = "avx2";
+    }
+    else if (features & CPU_FEATURE_SSE2) {
+        startcode_find_candidate = startcode_find_sse2;
+        find_isa = "sse2";
+    }
+#endif
+#if USE_SIMD_NEON
+    if (features & CPU_FEATURE_NEON) {
+        startcode_find_candidate = startcode_find_neon;
+        find_isa = "neon";
+    }
+#endif
+    D(bug("using %s kernel for start code scanning\n", find_isa));
+}
+
+size_t startcode_find(const uint8_t *buf, size_t pos, size_t size)
+{
+    startcode_init_kernels();
+
+    while ((pos = startcode_find_candidate(buf, pos, size)) < size) {
+        if (buf[pos + 2] == 1)
+            return pos;
+        pos++;
+    }
+    return size;
+}
+
+/* Ends unit U at offset END, without trailing zero bytes */
+static inline void
+end_unit(StartCodeUnit *u, const uint8_t *buf, unsigned int end)
+{
+    while (end > u->offset && buf[end - 1] == 0)
+        end--;
+    u->size = end - u->offset;
+}
+
+int startcode_split(const uint8_t *buf, unsigned int size, StartCodeUnit **punits)
+{
+    StartCodeUnit *units = NULL, *new_units, *u = NULL;
+    unsigned int units_size = 0, n = 0, pos = 0;
+
+    startcode_init_kernels();
+
+    *punits = NULL;
+    while ((pos = startcode_find_candidate(buf, pos, size)) < size) {
+        switch (buf[pos + 2]) {
+        case 1:
+            if (u)
+                end_unit(u, buf, pos);
+            new_units = fast_realloc(units, &units_size,
+                                     (n + 1) * sizeof(*units));
+            if (!new_units) {
+                free(units);
+                return -1;
+            }
+            units = new_units;
+            u = &units[n++];
+            u->offset    = pos + 3;
+            u->size      = 0;
+            u->type      = pos + 3 < size ? buf[pos + 3] : 0;
+            u->epb_count = 0;
+            pos += 3;
+            break;
+        case 3:
+            if (u)
+                u->epb_count++;
+            pos += 3;
+            break;
+        default:
+            /* Zero stuffing, or the first byte of a 4-byte start code */
+            pos++;
+            break;
+        }
+    }
+    if (u)
+        end_unit(u, buf, size);
+
+    *punits = units;
+    return n;
+}
+
+unsigned int startcode_unescape(uint8_t *dst, const uint8_t *src, unsigned int size)
+{
+    unsigned int pos = 0, start = 0, n = 0;
+
+    startcode_init_kernels();
+
+    /* Copy the runs between emulation prevention bytes */
+    while ((pos = startcode_find_candidate(src, pos, size)) < size) {
+        if (src[pos + 2] != 3) {
+            pos++;
+            continue;
+        }
+        memcpy(dst + n, src + start, pos + 2 - start);
+        n    += pos + 2 - start;
+        pos  += 3;
+        start = pos;
+    }
+    memcpy(dst + n, src + start, size - start);
+    return n + size - start;
+}
@@ -0,0 +1,51 @@
+/*
+ *  startcode.h - Start code scanner for elementary streams
+ *
+ *  hwdecode-demos (C) 2009-2010 Splitted-Desktop Systems
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef STARTCODE_H
+#define STARTCODE_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef struct _StartCodeUnit StartCodeUnit;
+
+// A unit of an Annex-B H.264, MPEG-2 or VC-1 stream, i.e. the bytes
+// between two 00 00 01 start code prefixes, within the input buffer
+struct _StartCodeUnit {
+    unsigned int        offset;         // first byte after the prefix
+    unsigned int        size;           // without trailing zero bytes
+    unsigned int        type;           // NAL header or start code value
+    unsigned int        epb_count;      // number of 00 00 03 sequences
+};
+
+// Returns the offset of the first 00 00 01 prefix of BUF at or after
+// POS, or SIZE if there is none
+size_t startcode_find(const uint8_t *buf, size_t pos, size_t size);
+
+// Splits BUF into the units following each start code. Bytes before
+// the first start code are skipped. Returns the number of units, or -1
+// on error. *PUNITS is allocated and needs to be freed
+int startcode_split(const uint8_t *buf, unsigned int size, StartCodeUnit **punits);
+
+// Copies SIZE bytes of SRC to DST, without emulation prevention bytes.
+// DST needs SIZE bytes at most. Returns the number of bytes written
+unsigned int startcode_unescape(uint8_t *dst, const uint8_t *src, unsigned int size);
+
+#endif /* STARTCODE_H */
@@ -0,0 +1,216 @@
+/*
+ *  thread_pool.c - Worker threads pool
+ *
+ *  hwdecode-demos (C) 2009-2010 Splitted-Desktop Systems
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "sysdeps.h"
+#include "thread_pool.h"
+#include <unistd.h>
+
+#define DEBUG 1
+#include "debug.h"
+
+/* Upper bound on the number of threads, including the caller */
+#define MAX_THREADS 64
+
+static void run_serial(ThreadPoolFunc func, void *data, unsigned int num_jobs)
+{
+    unsigned int i;
+
+    for (i = 0; i < num_jobs; i++)
+        func(data, i);
+}
+
+#ifdef HAVE_PTHREADS
+#include <pthread.h>
+
+typedef struct _ThreadPool ThreadPool;
+
+struct _ThreadPool {
+    pthread_t          *threads;
+    unsigned int        num_threads;
+    pthread_mutex_t     lock;
+    pthread_cond_t      work_cond;
+    pthread_cond_t      done_cond;
+    ThreadPoolFunc      func;
+    void               *data;
+    unsigned int        num_jobs;
+    unsigned int        next_job;
+    unsigned int        pending_jobs;
+    unsigned int        is_busy;
+    unsigned int        quit;
+};
+
+static ThreadPool *g_thread_pool;
+
+/* Runs jobs until none is left. Called with the pool lock held */
+static void run_jobs(ThreadPool *pool)
+{
+    while (pool->next_job < pool->num_jobs) {
+        const unsigned int index = pool->next_job++;
+        pthread_mutex_unlock(&pool->lock);
+        pool->func(pool->data, index);
+        pthread_mutex_lock(&pool->lock);
+        if (--pool->pending_jobs == 0)
+            pthread_cond_signal(&pool->done_cond);
+    }
+}
+
+static void *worker_thread(void *arg)
+{
+    ThreadPool * const pool = arg;
+
+    pthread_mutex_lock(&pool->lock);
+    for (;;) {
+        while (!pool->quit && pool->next_job >= pool->num_jobs)
+            pthread_cond_wait(&pool->work_cond, &pool->lock);
+        if (pool->quit)
+            break;
+        run_jobs(pool);
+    }
+    pthread_mutex_unlock(&pool->lock);
+    return NULL;
+}
+
+int thread_pool_init(unsigned int num_threads)
+{
+    ThreadPool *pool;
+    unsigned int i;
+
+    if (g_thread_pool)
+        return 0;
+
+    if (num_threads == 0) {
+        const long n = sysconf(_SC_NPROCESSORS_ONLN);
+        num_threads = n > 0 ? n : 1;
+    }
+    num_threads = MIN(num_threads, MAX_THREADS);
+    if (num_threads < 2)
+        return 0;
+
+    pool = calloc(1, sizeof(*pool));
+    if (!pool)
+        return -1;
+
+    /* The caller runs jobs too, so only spawn num_threads - 1 workers */
+    pool->threads = calloc(num_threads - 1, sizeof(pool->threads[0]));
+    if (!pool->threads) {
+        free(pool);
+        return -1;
+    }
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->work_cond, NULL);
+    pthread_cond_init(&pool->done_cond, NULL);
+
+    for (i = 0; i < num_threads - 1; i++) {
+        if (pthread_create(&pool->threads[i], NULL, worker_thread, pool) != 0)
+            break;
+    }
+    pool->num_threads = i;
+    g_thread_pool = pool;
+    D(bug("created thread pool with %u worker threads\n", pool->num_threads));
+
+    if (pool->num_threads != num_threads - 1) {
+        thread_pool_exit();
+        return -1;
+    }
+    return 0;
+}
+
+void thread_pool_exit(void)
+{
+    ThreadPool * const pool = g_thread_pool;
+    unsigned int i;
+
+    if (!pool)
+        return;
+    g_thread_pool = NULL;
+
+    pthread_mutex_lock(&pool->lock);
+    pool->quit = 1;
+    pthread_cond_broadcast(&pool->work_cond);
+    pthread_mutex_unlock(&pool->lock);
+
+    for (i = 0; i < pool->num_threads; i++)
+        pthread_join(pool->threads[i], NULL);
+
+    pthread_cond_destroy(&pool->done_cond);
+    pthread_cond_destroy(&pool->work_cond);
+    pthread_mutex_destroy(&pool->lock);
+    free(pool->threads);
+    free(pool);
+}
+
+unsigned int thread_pool_get_size(void)
+{
+    return g_thread_pool ? g_thread_pool->num_threads + 1 : 1;
+}
+
+void thread_pool_run(ThreadPoolFunc func, void *data, unsigned int num_jobs)
+{
+    ThreadPool * const pool = g_thread_pool;
+
+    if (!pool || num_jobs < 2) {
+        run_serial(func, data, num_jobs);
+        return;
+    }
+
+    pthread_mutex_lock(&pool->lock);
+    if (pool->is_busy) {
+        /* Nested or concurrent submission */
+        pthread_mutex_unlock(&pool->lock);
+        run_serial(func, data, num_jobs);
+        return;
+    }
+    pool->is_busy      = 1;
+    pool->func         = func;
+    pool->data         = data;
+    pool->num_jobs     = num_jobs;
+    pool->next_job     = 0;
+    pool->pending_jobs = num_jobs;
+    pthread_cond_broadcast(&pool->work_cond);
+
+    run_jobs(pool);
+    while (pool->pending_jobs > 0)
+        pthread_cond_wait(&pool->done_cond, &pool->lock);
+
+    pool->num_jobs     = 0;
+    pool->next_job     = 0;
+    pool->is_busy      = 0;
+    pthread_mutex_unlock(&pool->lock);
+}
+#else
+int thread_pool_init(unsigned int num_threads)
+{
+    return 0;
+}
+
+void thread_pool_exit(void)
+{
+}
+
+unsigned int thread_pool_get_size(void)
+{
+    return 1;
+}
+
+void thread_pool_run(ThreadPoolFunc func, void *data, unsigned int num_jobs)
+{
+    run_serial(func, data, num_jobs);
+}
+#endif
@@ -0,0 +1,40 @@
+/*
+ *  thread_pool.h - Worker threads pool
+ *
+ *  hwdecode-demos (C) 2009-2010 Splitted-Desktop Systems
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+// Job function, called once per job index
+typedef void (*ThreadPoolFunc)(void *data, unsigned int index);
+
+// Creates the pool. 0 threads means the number of online CPUs
+int thread_pool_init(unsigned int num_threads);
+
+// Destroys the pool, waiting for the worker threads to terminate
+void thread_pool_exit(void);
+
+// Returns the number of threads running jobs, including the caller
+unsigned int thread_pool_get_size(void);
+
+// Runs FUNC for jobs 0 to NUM_JOBS - 1 and waits for their completion.
+// Jobs run serially if the pool is not initialized or already busy
+void thread_pool_run(ThreadPoolFunc func, void *data, unsigned int num_jobs);
+
+#endif /* THREAD_POOL_H */
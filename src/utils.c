@@ -75,6 +75,86 @@ void *fast_realloc(void *ptr, unsigned int *size, unsigned int min_size)
     return ptr;
 }
 
+typedef struct _ScratchBuffer ScratchBuffer;
+
+struct _ScratchBuffer {
+    void               *data;
+    unsigned int        size;
+};
+
+#ifdef HAVE_PTHREADS
+#include <pthread.h>
+
+static pthread_key_t  scratch_key;
+static pthread_once_t scratch_key_once = PTHREAD_ONCE_INIT;
+
+static void scratch_destroy(void *arg)
+{
+    ScratchBuffer * const scratch = arg;
+
+    free(scratch->data);
+    free(scratch);
+}
+
+static void scratch_key_create(void)
+{
+    pthread_key_create(&scratch_key, scratch_destroy);
+}
+
+static ScratchBuffer *scratch_get_buffer(int create)
+{
+    ScratchBuffer *scratch;
+
+    pthread_once(&scratch_key_once, scratch_key_create);
+    scratch = pthread_getspecific(scratch_key);
+    if (!scratch && create) {
+        scratch = calloc(1, sizeof(*scratch));
+        if (!scratch)
+            return NULL;
+        if (pthread_setspecific(scratch_key, scratch) != 0) {
+            free(scratch);
+            return NULL;
+        }
+    }
+    return scratch;
+}
+#else
+static ScratchBuffer *scratch_get_buffer(int create)
+{
+    static ScratchBuffer scratch;
+
+    return &scratch;
+}
+#endif
+
+void *scratch_get(unsigned int size)
+{
+    ScratchBuffer * const scratch = scratch_get_buffer(1);
+    void *data;
+
+    if (!scratch)
+        return NULL;
+
+    /* The previous buffer is kept, and freed later, on failure */
+    data = fast_realloc(scratch->data, &scratch->size, size);
+    if (!data)
+        return NULL;
+    scratch->data = data;
+    return data;
+}
+
+void scratch_release(void)
+{
+    ScratchBuffer * const scratch = scratch_get_buffer(0);
+
+    if (!scratch)
+        return;
+
+    free(scratch->data);
+    scratch->data = NULL;
+    scratch->size = 0;
+}
+
 uint64_t get_ticks_usec(void)
 {
 #ifdef HAVE_CLOCK_GETTIME
@@ -162,14 +242,18 @@ void delay_usec(unsigned int usec)
     } while (was_error && (errno == EINTR));
 }
 
-uint32_t gen_random_int(void)
+static int g_random_initialized = 0;
+
+void gen_random_seed(uint32_t seed)
 {
-    static int initialized = 0;
+    srand(seed);
+    g_random_initialized = 1;
+}
 
-    if (!initialized) {
-        srand(time(NULL));
-        initialized = 1;
-    }
+uint32_t gen_random_int(void)
+{
+    if (!g_random_initialized)
+        gen_random_seed(time(NULL));
     return rand();
 }
 
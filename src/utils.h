@@ -30,9 +30,18 @@ const char *string_of_FOURCC(uint32_t fourcc);
 
 void *fast_realloc(void *ptr, unsigned int *size, unsigned int min_size);
 
+// Returns a per-thread scratch buffer of at least SIZE bytes. Its
+// contents are not preserved across calls
+void *scratch_get(unsigned int size);
+
+// Releases the scratch buffer of the calling thread
+void scratch_release(void);
+
 uint64_t get_ticks_usec(void);
 void delay_usec(unsigned int usec);
 
+// Seed the random numbers generator, the current time is used otherwise
+void gen_random_seed(uint32_t seed);
 uint32_t gen_random_int(void);
 uint32_t gen_random_int_range(uint32_t begin, uint32_t end);
 
@@ -276,10 +276,27 @@ error:
     return -1;
 }
 
+static void destroy_subpictures(VAAPIContext *vaapi)
+{
+    unsigned int i;
+
+    for (i = 0; i < ARRAY_ELEMS(vaapi->subpic_ids); i++) {
+        if (vaapi->subpic_ids[i] != VA_INVALID_ID) {
+            vaDestroySubpicture(vaapi->display, vaapi->subpic_ids[i]);
+            vaapi->subpic_ids[i] = VA_INVALID_ID;
+        }
+    }
+
+    if (vaapi->subpic_image.image_id != VA_INVALID_ID) {
+        vaDestroyImage(vaapi->display, vaapi->subpic_image.image_id);
+        vaapi->subpic_image.image_id = VA_INVALID_ID;
+        vaapi->subpic_image.buf      = VA_INVALID_ID;
+    }
+}
+
 int vaapi_exit(void)
 {
     VAAPIContext * const vaapi = vaapi_get_context();
-    unsigned int i;
 
     if (!vaapi)
         return 0;
@@ -337,17 +354,7 @@ int vaapi_exit(void)
         vaapi->n_slice_buf_ids = 0;
     }
 
-    if (vaapi->subpic_image.image_id != VA_INVALID_ID) {
-        vaDestroyImage(vaapi->display, vaapi->subpic_image.image_id);
-        vaapi->subpic_image.image_id = VA_INVALID_ID;
-    }
-
-    for (i = 0; i < ARRAY_ELEMS(vaapi->subpic_ids); i++) {
-        if (vaapi->subpic_ids[i] != VA_INVALID_ID) {
-            vaDestroySubpicture(vaapi->display, vaapi->subpic_ids[i]);
-            vaapi->subpic_ids[i] = VA_INVALID_ID;
-        }
-    }
+    destroy_subpictures(vaapi);
 
     if (vaapi->context_id != VA_INVALID_ID) {
         vaDestroyContext(vaapi->display, vaapi->context_id);
@@ -828,7 +835,7 @@ static int get_image(VASurfaceID surface, Image *dst_img)
     VAImage image;
     VAImageFormat *image_format = NULL;
     VAStatus status;
-    Image bound_image;
+    Image bound_image, view_image, *src_img;
     int i, is_bound_image = 0, is_derived_image = 0, error = -1;
 
     image.image_id = VA_INVALID_ID;
@@ -915,7 +922,25 @@ static int get_image(VASurfaceID surface, Image *dst_img)
         goto end;
     is_bound_image = 1;
 
-    if (image_convert(dst_img, &bound_image) < 0)
+    /* Derived images map the surface itself, usually as write-combined
+       memory that is very slow to read with regular loads */
+    if (is_derived_image)
+        bound_image.flags |= IMAGE_FLAG_UNCACHED;
+
+    /* Crop to the requested region in place. vaGetImage() already
+       stored it at the origin of the VA image */
+    src_img = &bound_image;
+    if (common->use_getimage_rect) {
+        Rectangle * const img_rect = &common->getimage_rect;
+        if (image_view(&view_image, &bound_image,
+                       is_derived_image ? img_rect->x : 0,
+                       is_derived_image ? img_rect->y : 0,
+                       img_rect->width, img_rect->height) < 0)
+            goto end;
+        src_img = &view_image;
+    }
+
+    if (getimage_convert(dst_img, src_img) < 0)
         goto end;
 
     error = 0;
@@ -1111,6 +1136,113 @@ get_subpic_format(
     return 0;
 }
 
+/* Determines the overlay source and target rectangles for blend mode */
+static void get_blend_rects(Image *img, Rectangle *src_rect, Rectangle *dst_rect)
+{
+    CommonContext * const common = common_get_context();
+    VAAPIContext * const vaapi = vaapi_get_context();
+
+    if (common->use_vaapi_subpicture_source_rect)
+        *src_rect = common->vaapi_subpicture_source_rect;
+    else {
+        src_rect->x      = 0;
+        src_rect->y      = 0;
+        src_rect->width  = img->width;
+        src_rect->height = img->height;
+    }
+
+    if (common->use_vaapi_subpicture_target_rect)
+        *dst_rect = common->vaapi_subpicture_target_rect;
+    else {
+        dst_rect->x      = 0;
+        dst_rect->y      = 0;
+        dst_rect->width  = vaapi->picture_width;
+        dst_rect->height = vaapi->picture_height;
+    }
+}
+
+/* Blends the overlay into the surface pixels on the CPU, for drivers
+   without suitable subpicture support. Derived images are not used here:
+   their mappings are write-combined, and blending reads them back. So
+   the overlay is blended into a cached copy from vaGetImage(), which is
+   then uploaded with vaPutImage() */
+static int blend_image_cpu(VASurfaceID surface, Image *img)
+{
+    CommonContext * const common = common_get_context();
+    VAAPIContext * const vaapi = vaapi_get_context();
+    VAImageFormat *va_image_format = NULL;
+    VAImage va_image;
+    VAStatus status;
+    Image bound_image;
+    Rectangle src_rect, dst_rect;
+    unsigned int alpha = 255;
+    int i, is_bound_image = 0, error = -1;
+
+    static const uint32_t blend_formats[] = {
+        VA_FOURCC('N','V','1','2'),
+        VA_FOURCC('Y','V','1','2'),
+        0
+    };
+
+    va_image.image_id = VA_INVALID_ID;
+    va_image.buf      = VA_INVALID_ID;
+
+    for (i = 0; blend_formats[i] != 0; i++) {
+        if (get_image_format(vaapi, blend_formats[i], &va_image_format))
+            break;
+    }
+    if (!va_image_format)
+        goto end;
+
+    status = vaCreateImage(vaapi->display, va_image_format,
+                           vaapi->picture_width, vaapi->picture_height,
+                           &va_image);
+    if (!vaapi_check_status(status, "vaCreateImage()"))
+        goto end;
+
+    status = vaGetImage(vaapi->display, surface,
+                        0, 0, va_image.width, va_image.height,
+                        va_image.image_id);
+    if (!vaapi_check_status(status, "vaGetImage()"))
+        goto end;
+    D(bug("blending into %s image on the CPU\n",
+          string_of_VAImageFormat(va_image_format)));
+
+    if (common->use_vaapi_subpicture_flags &&
+        (common->vaapi_subpicture_flags & VA_SUBPICTURE_GLOBAL_ALPHA))
+        alpha = common->vaapi_subpicture_alpha * 255.0f + 0.5f;
+
+    get_blend_rects(img, &src_rect, &dst_rect);
+
+    if (bind_image(&va_image, &bound_image) < 0)
+        goto end;
+    is_bound_image = 1;
+    if (image_blend(&bound_image, img, &src_rect, &dst_rect, alpha) < 0)
+        goto end;
+    is_bound_image = 0;
+    if (release_image(&va_image) < 0)
+        goto end;
+
+    status = vaPutImage2(vaapi->display, surface, va_image.image_id,
+                         0, 0, va_image.width, va_image.height,
+                         0, 0, va_image.width, va_image.height);
+    if (!vaapi_check_status(status, "vaPutImage()"))
+        goto end;
+    error = 0;
+end:
+    if (is_bound_image) {
+        if (release_image(&va_image) < 0)
+            error = -1;
+    }
+
+    if (va_image.image_id != VA_INVALID_ID) {
+        status = vaDestroyImage(vaapi->display, va_image.image_id);
+        if (!vaapi_check_status(status, "vaDestroyImage()"))
+            error = -1;
+    }
+    return error;
+}
+
 static int blend_image(VASurfaceID surface, Image *img)
 {
     CommonContext * const common = common_get_context();
@@ -1123,8 +1255,21 @@ static int blend_image(VASurfaceID surface, Image *img)
     int is_bound_image = 0, error = -1;
     Rectangle src_rect, dst_rect, srect, drect;
 
-    vaapi->subpic_image.image_id = VA_INVALID_ID;
-    vaapi->subpic_image.buf      = VA_INVALID_ID;
+    /* The subpictures are already associated to the surface, only
+       upload the modified tiles of the overlay */
+    if (vaapi->subpic_image.image_id != VA_INVALID_ID &&
+        vaapi->subpic_image.width  == img->width &&
+        vaapi->subpic_image.height == img->height) {
+        if (!image_is_dirty(img))
+            return 0;
+        if (bind_image(&vaapi->subpic_image, &bound_image) < 0)
+            return -1;
+        error = image_convert_dirty(&bound_image, img);
+        if (release_image(&vaapi->subpic_image) < 0)
+            error = -1;
+        return error;
+    }
+    destroy_subpictures(vaapi);
 
     if (common->putimage_format) {
         uint32_t fourcc = get_vaapi_format(common->putimage_format);
@@ -1138,8 +1283,10 @@ static int blend_image(VASurfaceID surface, Image *img)
                 break;
         }
     }
-    if (!subpic_format)
-        goto end;
+    if (!subpic_format) {
+        D(bug("no suitable subpicture format, blending on the CPU\n"));
+        return blend_image_cpu(surface, img);
+    }
 
     /* Check HW supports the expected subpicture features */
     if (common->use_vaapi_subpicture_flags) {
@@ -1161,9 +1308,9 @@ static int blend_image(VASurfaceID surface, Image *img)
 
         for (i = 0; g_flags[i].flags != 0; i++) {
             if (missing_flags & g_flags[i].flags) {
-                D(bug("driver does not support %s subpicture flag\n",
-                      g_flags[i].name));
-                goto end;
+                D(bug("driver does not support %s subpicture flag, "
+                      "blending on the CPU\n", g_flags[i].name));
+                return blend_image_cpu(surface, img);
             }
         }
     }
@@ -1215,23 +1362,7 @@ static int blend_image(VASurfaceID surface, Image *img)
         }
     }
 
-    if (common->use_vaapi_subpicture_source_rect)
-        src_rect = common->vaapi_subpicture_source_rect;
-    else {
-        src_rect.x      = 0;
-        src_rect.y      = 0;
-        src_rect.width  = img->width;
-        src_rect.height = img->height;
-    }
-
-    if (common->use_vaapi_subpicture_target_rect)
-        dst_rect = common->vaapi_subpicture_target_rect;
-    else {
-        dst_rect.x      = 0;
-        dst_rect.y      = 0;
-        dst_rect.width  = vaapi->picture_width;
-        dst_rect.height = vaapi->picture_height;
-    }
+    get_blend_rects(img, &src_rect, &dst_rect);
 
     D(bug("render %d subpicture%s from (%d,%d):%ux%u to (%d,%d):%ux%u\n",
           subpic_count, subpic_count > 1 ? "s" : "",
@@ -1295,6 +1426,8 @@ end:
         if (release_image(&vaapi->subpic_image) < 0)
             error = -1;
     }
+    if (error)
+        destroy_subpictures(vaapi);
     return error;
 }
 
@@ -1429,11 +1562,7 @@ int vaapi_display(void)
         return -1;
 
     if (putimage_mode() != PUTIMAGE_NONE) {
-        Image *img;
-        img = image_generate(
-            common->putimage_size.width,
-            common->putimage_size.height
-        );
+        Image * const img = putimage_get_image();
         if (img) {
             switch (putimage_mode()) {
             case PUTIMAGE_OVERRIDE:
@@ -1447,7 +1576,7 @@ int vaapi_display(void)
             default:
                 break;
             }
-            image_destroy(img);
+            image_clear_dirty(img);
         }
     }
 
@@ -41,6 +41,7 @@ int decode(void)
         return -1;
 
     mpeg4_get_picture_info(&mpeg4_pic_info);
+    mpeg4_get_iq_matrix(&mpeg4_iq_matrix);
 
     if (vaapi_init_decoder(VAProfileMPEG4AdvancedSimple, VAEntrypointVLD,
                            mpeg4_pic_info.width, mpeg4_pic_info.height) < 0)
@@ -99,7 +100,6 @@ int decode(void)
         mpeg4_iq_matrix.load_non_intra_quant_mat) {
         if ((iq_matrix = vaapi_alloc_iq_matrix(sizeof(*iq_matrix))) == NULL)
             return -1;
-        mpeg4_get_iq_matrix(&mpeg4_iq_matrix);
 
 #define COPY(field) iq_matrix->field = mpeg4_iq_matrix.field
         COPY(load_intra_quant_mat);
@@ -40,6 +40,7 @@ int decode(void)
     VAAPIContext * const vaapi = vaapi_get_context();
     VAPictureParameterBufferVC1 *pic_param;
     VASliceParameterBufferVC1 *slice_param;
+    VAProfile profile;
     uint8_t *bitplane;
     int i, slice_count;
 
@@ -55,7 +56,14 @@ int decode(void)
 
     vc1_get_picture_info(&vc1_pic_info);
 
-    if (vaapi_init_decoder(VAProfileVC1Advanced, VAEntrypointVLD,
+    switch (vc1_pic_info.profile) {
+    case 0: profile = VAProfileVC1Simple;   break;
+    case 1: profile = VAProfileVC1Main;     break;
+    case 3: profile = VAProfileVC1Advanced; break;
+    default: return -1;
+    }
+
+    if (vaapi_init_decoder(profile, VAEntrypointVLD,
                            vc1_pic_info.width, vc1_pic_info.height) < 0)
         return -1;
 
@@ -20,13 +20,15 @@
 
 #include "sysdeps.h"
 #include "vc1.h"
+#include "startcode.h"
+#include "get_bits.h"
+#include "utils.h"
+#include "input.h"
+
+#define DEBUG 1
+#include "debug.h"
 
-#define VC1_CLIP_WIDTH          320
-#define VC1_CLIP_HEIGHT         240
 #define VC1_CLIP_DATA_SIZE    20860
-#define VC1_CLIP_BITPLANE_SIZE  150
-#define VC1_CLIP_SLICE_OFFSET    26
-#define VC1_CLIP_SLICE_COUNT      1
 
 /* Data dump of a 320x240 VC-1 video clip (vc1.raw), it has a single frame */
 static const uint8_t vc1_clip[VC1_CLIP_DATA_SIZE] = {
@@ -1771,195 +1773,1426 @@ static const uint8_t vc1_clip[VC1_CLIP_DATA_SIZE] = {
     0x0f, 0x55, 0xbf, 0x40
 };
 
-/* VC-1 Bitplane Buffer, in VA API format since this is only useful there */
-static const uint8_t vc1_bitplane[VC1_CLIP_BITPLANE_SIZE] = {
-    0x22, 0x22, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20,
-    0x00, 0x00, 0x20, 0x00, 0x00, 0x02, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x22, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00,
-    0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0x00, 0x00, 0x00, 0x00, 0x20, 0x00
+/* BDU start codes (Annex E) */
+#define END_OF_SEQUENCE_CODE    0x0a
+#define SLICE_CODE              0x0b
+#define FIELD_CODE              0x0c
+#define FRAME_CODE              0x0d
+#define ENTRY_POINT_CODE        0x0e
+#define SEQUENCE_HEADER_CODE    0x0f
+
+/* Profiles */
+#define PROFILE_SIMPLE          0
+#define PROFILE_MAIN            1
+#define PROFILE_ADVANCED        3
+
+/* Picture types, as in VC1PictureInfo */
+#define I_TYPE                  0
+#define P_TYPE                  1
+#define B_TYPE                  2
+#define BI_TYPE                 3
+#define SKIPPED_TYPE            4
+
+/* Frame coding modes */
+#define PROGRESSIVE             0
+#define FRAME_INTERLACE         1
+#define FIELD_INTERLACE         2
+
+/* Motion vector modes, as in VC1PictureInfo */
+#define MV_MODE_1MV             0
+#define MV_MODE_1MV_HPEL        1
+#define MV_MODE_1MV_HPEL_BILIN  2
+#define MV_MODE_MIXED_MV        3
+#define MV_MODE_INTENSITY_COMP  4
+
+/* Quantizer specifiers */
+#define QUANTIZER_IMPLICIT      0
+#define QUANTIZER_EXPLICIT      1
+#define QUANTIZER_NON_UNIFORM   2
+#define QUANTIZER_UNIFORM       3
+
+/* DQPROFILE values */
+#define DQPROFILE_FOUR_EDGES    0
+#define DQPROFILE_DOUBLE_EDGES  1
+#define DQPROFILE_SINGLE_EDGE   2
+#define DQPROFILE_ALL_MBS       3
+
+/* Bitplane coding modes */
+#define IMODE_RAW               0
+#define IMODE_NORM2             1
+#define IMODE_DIFF2             2
+#define IMODE_NORM6             3
+#define IMODE_DIFF6             4
+#define IMODE_ROWSKIP           5
+#define IMODE_COLSKIP           6
+
+/* Bit of each bitplane in the nibble of a macroblock, by picture type */
+#define BP_FIELDTX              0       // I, BI
+#define BP_ACPRED               1
+#define BP_OVERFLAGS            2
+#define BP_DIRECTMB             0       // P, B
+#define BP_SKIPMB               1
+#define BP_MVTYPEMB             2
+#define BP_FORWARDMB            2
+
+/* BFRACTION codes of the SMPTE reserved value, and of BI pictures */
+#define BFRACTION_RESERVED      21
+#define BFRACTION_BI            22
+
+/* Picture headers are only unescaped up to this size, which holds three
+   bitplanes of the largest pictures */
+#define MAX_PICTURE_HEADER_SIZE 16384
+
+/* Size of the RCV (Annex L) file header and of the frame headers */
+#define RCV_HEADER_SIZE         36
+#define RCV_FRAME_HEADER_SIZE   8
+
+/* PQUANT for each PQINDEX, with the implicit quantizer (Table 36) */
+static const uint8_t pquant_table[32] = {
+     0,  1,  2,  3,  4,  5,  6,  7,  8,  6,  7,  8,  9, 10, 11, 12,
+    13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 27, 29, 31
+};
+
+/* MVMODE and MVMODE2 for each code length, when PQUANT > 12 and when
+   PQUANT <= 12 (Tables 46 to 49) */
+static const uint8_t mv_mode_table[2][5] = {
+    { MV_MODE_1MV_HPEL_BILIN, MV_MODE_1MV, MV_MODE_1MV_HPEL,
+      MV_MODE_INTENSITY_COMP, MV_MODE_MIXED_MV },
+    { MV_MODE_1MV, MV_MODE_MIXED_MV, MV_MODE_1MV_HPEL,
+      MV_MODE_INTENSITY_COMP, MV_MODE_1MV_HPEL_BILIN }
+};
+
+static const uint8_t mv_mode2_table[2][4] = {
+    { MV_MODE_1MV_HPEL_BILIN, MV_MODE_1MV, MV_MODE_1MV_HPEL, MV_MODE_MIXED_MV },
+    { MV_MODE_1MV, MV_MODE_MIXED_MV, MV_MODE_1MV_HPEL, MV_MODE_1MV_HPEL_BILIN }
 };
 
-static const VC1PictureInfo vc1_pic_info = {
-    .profile = 3,
-    .level = 1,
-    .width = VC1_CLIP_WIDTH,
-    .height = VC1_CLIP_HEIGHT,
-    .sequence_fields = {
-        .bits = {
-            .interlace = 0,
-            .syncmarker = 0,
-            .overlap = 0,
-            .pulldown = 0,
-            .tfcntrflag = 0,
-            .finterpflag = 0,
-            .psf = 0,
-            .multires = 0,
-            .rangered = 0,
-            .max_b_frames = 7,
-        },
-    },
-    .entrypoint_fields = {
-        .bits = {
-            .broken_link = 0,
-            .closed_entry = 1,
-            .panscan_flag = 0,
-            .loopfilter = 1,
-        },
-    },
-    .conditional_overlap_flag = 0,
-    .fast_uvmc_flag = 1,
-    .range_mapping_fields = {
-        .bits = {
-            .luma_flag = 0,
-            .luma = 0,
-            .chroma_flag = 0,
-            .chroma = 0,
-        },
-    },
-    .b_picture_fraction = 0,
-    .cbp_table = 0,
-    .mb_mode_table = 0,
-    .range_reduction_frame = 0,
-    .rounding_control = 0,
-    .post_processing = 0,
-    .picture_resolution_index = 0,
-    .luma_scale = 0,
-    .luma_shift = 0,
-    .picture_fields = {
-        .bits = {
-            .picture_type = 0,
-            .frame_coding_mode = 0,
-            .top_field_first = 0,
-            .is_first_field = 1,
-            .intensity_compensation = 0,
-        },
-    },
-    .raw_coding = {
-        .flags = {
-            .mv_type_mb = 0,
-            .direct_mb = 0,
-            .skip_mb = 0,
-            .field_tx = 0,
-            .forward_mb = 0,
-            .ac_pred = 0,
-            .overflags = 0,
-        },
-    },
-    .bitplane_present = {
-        .flags = {
-            .bp_mv_type_mb = 0,
-            .bp_direct_mb = 0,
-            .bp_skip_mb = 0,
-            .bp_field_tx = 0,
-            .bp_forward_mb = 0,
-            .bp_ac_pred = 1,
-            .bp_overflags = 0,
-        },
-    },
-    .reference_fields = {
-        .bits = {
-            .reference_distance_flag = 0,
-            .reference_distance = 0,
-            .num_reference_pictures = 0,
-            .reference_field_pic_indicator = 0,
-        },
-    },
-    .mv_fields = {
-        .bits = {
-            .mv_mode = 0,
-            .mv_mode2 = 0,
-            .mv_table = 0,
-            .two_mv_block_pattern_table = 0,
-            .four_mv_switch = 0,
-            .four_mv_block_pattern_table = 0,
-            .extended_mv_flag = 0,
-            .extended_mv_range = 0,
-            .extended_dmv_flag = 0,
-            .extended_dmv_range = 0,
-        },
-    },
-    .pic_quantizer_fields = {
-        .bits = {
-            .dquant = 0,
-            .quantizer = 2,
-            .half_qp = 1,
-            .pic_quantizer_scale = 3,
-            .pic_quantizer_type = 0,
-            .dq_frame = 0,
-            .dq_profile = 0,
-            .dq_sb_edge = 0,
-            .dq_db_edge = 0,
-            .dq_binary_level = 0,
-            .alt_pic_quantizer = 0,
-        },
-    },
-    .transform_fields = {
-        .bits = {
-            .variable_sized_transform_flag = 0,
-            .mb_level_transform_type_flag = 0,
-            .frame_level_transform_type = 0,
-            .transform_ac_codingset_idx1 = 0,
-            .transform_ac_codingset_idx2 = 0,
-            .intra_transform_dc_table = 1,
-        },
-    },
+/* Picture types of the first and second fields, for each FPTYPE */
+static const uint8_t fptype_table[8][2] = {
+    { I_TYPE,  I_TYPE  }, { I_TYPE,  P_TYPE  },
+    { P_TYPE,  I_TYPE  }, { P_TYPE,  P_TYPE  },
+    { B_TYPE,  B_TYPE  }, { B_TYPE,  BI_TYPE },
+    { BI_TYPE, B_TYPE  }, { BI_TYPE, BI_TYPE }
 };
 
-static const VC1SliceInfo vc1_slice_info[VC1_CLIP_SLICE_COUNT] = {
-    {
-        .slice_data_size = 20834,
-        .slice_data_offset = 0,
-        .macroblock_offset = 195,
-        .slice_vertical_position = 0,
-    },
+/* IMODE and code length, indexed by the next 4 bits (Table 69) */
+static const uint8_t imode_vlc[16][2] = {
+    { IMODE_RAW,     4 }, { IMODE_DIFF6,   4 },
+    { IMODE_DIFF2,   3 }, { IMODE_DIFF2,   3 },
+    { IMODE_ROWSKIP, 3 }, { IMODE_ROWSKIP, 3 },
+    { IMODE_COLSKIP, 3 }, { IMODE_COLSKIP, 3 },
+    { IMODE_NORM2,   2 }, { IMODE_NORM2,   2 },
+    { IMODE_NORM2,   2 }, { IMODE_NORM2,   2 },
+    { IMODE_NORM6,   2 }, { IMODE_NORM6,   2 },
+    { IMODE_NORM6,   2 }, { IMODE_NORM6,   2 }
 };
 
-void vc1_get_video_data(const uint8_t **data, unsigned int *size)
+/* Pair of bits and code length, indexed by the next 3 bits (Table 80) */
+static const uint8_t norm2_vlc[8][2] = {
+    { 0, 1 }, { 0, 1 }, { 0, 1 }, { 0, 1 },
+    { 1, 3 }, { 2, 3 }, { 3, 2 }, { 3, 2 }
+};
+
+/* Codes of the six bits of a tile (Table 81), the first one in bit 0 */
+static const struct {
+    uint16_t            code;
+    uint8_t             bits;
+} norm6_vlc[64] = {
+    { 0x001,  1 }, { 0x002,  4 }, { 0x003,  4 }, { 0x000,  8 },
+    { 0x004,  4 }, { 0x001,  8 }, { 0x002,  8 }, { 0x047, 10 },
+    { 0x005,  4 }, { 0x003,  8 }, { 0x004,  8 }, { 0x04b, 10 },
+    { 0x005,  8 }, { 0x04d, 10 }, { 0x04e, 10 }, { 0x30e, 13 },
+    { 0x006,  4 }, { 0x006,  8 }, { 0x007,  8 }, { 0x053, 10 },
+    { 0x008,  8 }, { 0x055, 10 }, { 0x056, 10 }, { 0x30d, 13 },
+    { 0x009,  8 }, { 0x059, 10 }, { 0x05a, 10 }, { 0x30c, 13 },
+    { 0x05c, 10 }, { 0x30b, 13 }, { 0x30a, 13 }, { 0x037,  9 },
+    { 0x007,  4 }, { 0x00a,  8 }, { 0x00b,  8 }, { 0x043, 10 },
+    { 0x00c,  8 }, { 0x045, 10 }, { 0x046, 10 }, { 0x309, 13 },
+    { 0x00d,  8 }, { 0x049, 10 }, { 0x04a, 10 }, { 0x308, 13 },
+    { 0x04c, 10 }, { 0x307, 13 }, { 0x306, 13 }, { 0x036,  9 },
+    { 0x00e,  8 }, { 0x051, 10 }, { 0x052, 10 }, { 0x305, 13 },
+    { 0x054, 10 }, { 0x304, 13 }, { 0x303, 13 }, { 0x035,  9 },
+    { 0x058, 10 }, { 0x302, 13 }, { 0x301, 13 }, { 0x034,  9 },
+    { 0x300, 13 }, { 0x033,  9 }, { 0x032,  9 }, { 0x007,  6 }
+};
+
+#define NORM6_VLC_BITS          13
+#define NORM6_INVALID           0xff
+
+/* Tile for each value of the next NORM6_VLC_BITS bits, and the eight
+   bits of each byte as one byte per macroblock */
+static uint8_t norm6_table[1 << NORM6_VLC_BITS];
+static uint8_t expand_table[256][8];
+
+struct _VC1Parser {
+    const uint8_t      *buf;
+    size_t              size;
+    size_t              pos;            // offset of the next BDU or frame
+    unsigned int        is_rcv;
+
+    /* Sequence and entry-point state */
+    VC1PictureInfo      seq_info;       // fields common to all pictures
+    unsigned int        has_sequence_header;
+    unsigned int        has_entry_point;
+    unsigned int        postprocflag;
+    unsigned int        hrd_num_leaky_buckets;
+    unsigned int        res_x8;         // simple and main profiles
+
+    /* Picture state */
+    unsigned int        mb_width;
+    unsigned int        mb_height;      // of the frame, or of a field
+    unsigned int        rnd;            // simple and main profiles
+    unsigned int        refdist;
+    unsigned int        fptype;
+    VC1PictureInfo      first_field;
+    unsigned int        second_field_pending;
+
+    /* Reference tracking, by frame decoding order */
+    unsigned int        num_frames;
+    int                 past_reference;
+    int                 future_reference;
+    int                 forward_reference;
+    int                 backward_reference;
+
+    uint8_t            *header;         // unescaped picture header
+    unsigned int        header_size;
+    uint8_t            *plane;          // one bitplane, a byte per MB
+    unsigned int        plane_size;
+    uint8_t            *mb_flags;       // all bitplanes, a nibble per MB
+    unsigned int        mb_flags_size;
+    uint8_t            *bitplane;       // packed bitplanes
+    unsigned int        bitplane_size;
+    VC1SliceInfo       *slices;
+    unsigned int        slices_size;
+};
+
+/* Builds the lookup tables, only once */
+static void init_tables(void)
+{
+    static int initialized = 0;
+    unsigned int i, j, shift;
+
+    if (initialized)
+        return;
+    initialized = 1;
+
+    memset(norm6_table, NORM6_INVALID, sizeof(norm6_table));
+    for (i = 0; i < ARRAY_ELEMS(norm6_vlc); i++) {
+        shift = NORM6_VLC_BITS - norm6_vlc[i].bits;
+        for (j = 0; j < 1U << shift; j++)
+            norm6_table[(norm6_vlc[i].code << shift) | j] = i;
+    }
+
+    for (i = 0; i < 256; i++) {
+        for (j = 0; j < 8; j++)
+            expand_table[i][j] = (i >> (7 - j)) & 1;
+    }
+}
+
+static inline uint32_t get_le32(const uint8_t *p)
+{
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+/* Reads a code of 1s terminated by a 0, of at most MAX bits */
+static unsigned int get_unary(GetBitContext *gb, unsigned int max)
+{
+    unsigned int n;
+
+    for (n = 0; n < max && get_bits1(gb); n++)
+        ;
+    return n;
+}
+
+/* Reads a code of 0s terminated by a 1, of at most MAX bits */
+static unsigned int get_unary0(GetBitContext *gb, unsigned int max)
+{
+    unsigned int n;
+
+    for (n = 0; n < max && !get_bits1(gb); n++)
+        ;
+    return n;
+}
+
+/* Reads a 0, 10 or 11 code, as 0, 1 or 2 */
+static inline unsigned int decode012(GetBitContext *gb)
+{
+    if (!get_bits1(gb))
+        return 0;
+    return get_bits1(gb) + 1;
+}
+
+/* Reads BFRACTION (Table 40), as its index in the code table */
+static unsigned int get_bfraction(GetBitContext *gb)
+{
+    unsigned int v = get_bits(gb, 3);
+
+    if (v < 7)
+        return v;
+    return 7 + get_bits(gb, 4);
+}
+
+/* Reads a row of N bits, a byte per bit */
+static void read_bits_row(GetBitContext *gb, uint8_t *p, unsigned int n)
+{
+    unsigned int x;
+
+    for (x = 0; x + 8 <= n; x += 8)
+        memcpy(p + x, expand_table[get_bits(gb, 8)], 8);
+    for (; x < n; x++)
+        p[x] = get_bits1(gb);
+}
+
+static void
+decode_rowskip(GetBitContext *gb, uint8_t *plane, unsigned int width,
+               unsigned int height, unsigned int stride)
+{
+    unsigned int y;
+
+    for (y = 0; y < height; y++, plane += stride) {
+        if (get_bits1(gb))
+            read_bits_row(gb, plane, width);
+        else
+            memset(plane, 0, width);
+    }
+}
+
+static void
+decode_colskip(GetBitContext *gb, uint8_t *plane, unsigned int width,
+               unsigned int height, unsigned int stride)
+{
+    unsigned int x, y;
+
+    for (x = 0; x < width; x++) {
+        if (get_bits1(gb)) {
+            for (y = 0; y < height; y++)
+                plane[y * stride + x] = get_bits1(gb);
+        }
+        else {
+            for (y = 0; y < height; y++)
+                plane[y * stride + x] = 0;
+        }
+    }
+}
+
+/* Reads the six bits of a tile, or returns -1 */
+static inline int get_norm6(GetBitContext *gb)
+{
+    const unsigned int v = norm6_table[show_bits(gb, NORM6_VLC_BITS)];
+
+    if (v == NORM6_INVALID)
+        return -1;
+    skip_bits(gb, norm6_vlc[v].bits);
+    return v;
+}
+
+static int
+decode_norm6(GetBitContext *gb, uint8_t *plane, unsigned int width,
+             unsigned int height)
+{
+    const unsigned int stride = width;
+    unsigned int x, y;
+    uint8_t *p;
+    int v;
+
+    /* 2x3 tiles, then a colskip coded column on the left */
+    if (height % 3 == 0 && width % 3 != 0) {
+        for (y = 0; y < height; y += 3) {
+            p = plane + y * stride;
+            for (x = width & 1; x < width; x += 2) {
+                if ((v = get_norm6(gb)) < 0)
+                    return -1;
+                p[x]                  = v & 1;
+                p[x + 1]              = (v >> 1) & 1;
+                p[x + stride]         = (v >> 2) & 1;
+                p[x + stride + 1]     = (v >> 3) & 1;
+                p[x + 2 * stride]     = (v >> 4) & 1;
+                p[x + 2 * stride + 1] = (v >> 5) & 1;
+            }
+        }
+        if (width & 1)
+            decode_colskip(gb, plane, 1, height, stride);
+        return 0;
+    }
+
+    /* 3x2 tiles, then colskip coded columns on the left and a rowskip
+       coded row on top */
+    for (y = height & 1; y < height; y += 2) {
+        p = plane + y * stride;
+        for (x = width % 3; x < width; x += 3) {
+            if ((v = get_norm6(gb)) < 0)
+                return -1;
+            p[x]              = v & 1;
+            p[x + 1]          = (v >> 1) & 1;
+            p[x + 2]          = (v >> 2) & 1;
+            p[x + stride]     = (v >> 3) & 1;
+            p[x + stride + 1] = (v >> 4) & 1;
+            p[x + stride + 2] = (v >> 5) & 1;
+        }
+    }
+    x = width % 3;
+    if (x)
+        decode_colskip(gb, plane, x, height, stride);
+    if (height & 1)
+        decode_rowskip(gb, plane + x, width - x, 1, stride);
+    return 0;
+}
+
+/* Decodes a bitplane into bit BIT of the macroblock flags. Returns 1 if
+   it was coded in the picture header, 0 if it is raw coded in the
+   macroblock layer, or -1 on error */
+static int decode_bitplane(VC1Parser *parser, GetBitContext *gb, unsigned int bit)
+{
+    const unsigned int width  = parser->mb_width;
+    const unsigned int height = parser->mb_height;
+    const unsigned int n = width * height;
+    uint8_t * const plane = parser->plane;
+    unsigned int i, x, y, invert, imode, v;
+
+    invert = get_bits1(gb);
+    v = show_bits(gb, 4);
+    imode = imode_vlc[v][0];
+    skip_bits(gb, imode_vlc[v][1]);
+
+    switch (imode) {
+    case IMODE_RAW:
+        return 0;
+    case IMODE_NORM2:
+    case IMODE_DIFF2:
+        i = 0;
+        if (n & 1)
+            plane[i++] = get_bits1(gb);
+        for (; i < n; i += 2) {
+            v = show_bits(gb, 3);
+            skip_bits(gb, norm2_vlc[v][1]);
+            plane[i]     = norm2_vlc[v][0] & 1;
+            plane[i + 1] = norm2_vlc[v][0] >> 1;
+        }
+        break;
+    case IMODE_NORM6:
+    case IMODE_DIFF6:
+        if (decode_norm6(gb, plane, width, height) < 0)
+            return -1;
+        break;
+    case IMODE_ROWSKIP:
+        decode_rowskip(gb, plane, width, height, width);
+        break;
+    case IMODE_COLSKIP:
+        decode_colskip(gb, plane, width, height, width);
+        break;
+    }
+    if (get_bits_left(gb) < 0)
+        return -1;
+
+    /* Differential operator (8.7.3.8), or inversion */
+    if (imode == IMODE_DIFF2 || imode == IMODE_DIFF6) {
+        uint8_t *p = plane, *q;
+        p[0] ^= invert;
+        for (x = 1; x < width; x++)
+            p[x] ^= p[x - 1];
+        for (y = 1; y < height; y++) {
+            q  = p;
+            p += width;
+            p[0] ^= q[0];
+            for (x = 1; x < width; x++) {
+                if (p[x - 1] != q[x])
+                    p[x] ^= invert;
+                else
+                    p[x] ^= p[x - 1];
+            }
+        }
+    }
+    else if (invert) {
+        for (i = 0; i < n; i++)
+            plane[i] ^= 1;
+    }
+
+    for (i = 0; i < n; i++)
+        parser->mb_flags[i] |= plane[i] << bit;
+    return 1;
+}
+
+#define DECODE_BITPLANE(name, bit) do {                                 \
+        if ((ret = decode_bitplane(parser, gb, bit)) < 0)               \
+            return -1;                                                  \
+        pic_info->raw_coding.flags.name = ret == 0;                     \
+        pic_info->bitplane_present.flags.bp_##name = ret == 1;          \
+    } while (0)
+
+/* Packs the macroblock flags, two macroblocks per byte, the first one in
+   the high nibble */
+static int pack_bitplanes(VC1Parser *parser, VC1Picture *picture)
+{
+    const unsigned int n = parser->mb_width * parser->mb_height;
+    const uint8_t * const mb_flags = parser->mb_flags;
+    unsigned int i;
+
+    if (!picture->pic_info.bitplane_present.value)
+        return 0;
+
+    parser->bitplane = fast_realloc(parser->bitplane, &parser->bitplane_size,
+                                    (n + 1) / 2);
+    if (!parser->bitplane)
+        return -1;
+
+    for (i = 0; i + 1 < n; i += 2)
+        parser->bitplane[i / 2] = (mb_flags[i] << 4) | mb_flags[i + 1];
+    if (n & 1)
+        parser->bitplane[n / 2] = mb_flags[n - 1] << 4;
+
+    picture->bitplane      = parser->bitplane;
+    picture->bitplane_size = (n + 1) / 2;
+    return 0;
+}
+
+/* Prepares the bitplane buffers for a picture, or a field */
+static int
+init_picture(VC1Parser *parser, VC1Picture *picture, unsigned int is_field)
+{
+    const VC1PictureInfo * const seq_info = &parser->seq_info;
+    unsigned int n;
+
+    memset(picture, 0, sizeof(*picture));
+    picture->pic_info = *seq_info;
+
+    parser->mb_width  = (seq_info->width + 15) / 16;
+    parser->mb_height = is_field ? (seq_info->height + 31) / 32 :
+                                   (seq_info->height + 15) / 16;
+
+    n = parser->mb_width * parser->mb_height;
+    parser->plane = fast_realloc(parser->plane, &parser->plane_size, n);
+    if (!parser->plane)
+        return -1;
+    parser->mb_flags = fast_realloc(parser->mb_flags, &parser->mb_flags_size, n);
+    if (!parser->mb_flags)
+        return -1;
+    memset(parser->mb_flags, 0, n);
+
+    picture->pic_info.picture_fields.bits.is_first_field = 1;
+    return 0;
+}
+
+/* Unescapes the start of BDU, past its start code, into the parser
+   buffer, and starts reading it */
+static int
+load_header(VC1Parser *parser, GetBitContext *gb, const uint8_t *bdu,
+            unsigned int size)
+{
+    size = MIN(size, MAX_PICTURE_HEADER_SIZE);
+    parser->header = fast_realloc(parser->header, &parser->header_size, size);
+    if (!parser->header)
+        return -1;
+
+    size = startcode_unescape(parser->header, bdu, size);
+    init_get_bits(gb, parser->header, size);
+    return 0;
+}
+
+static int parse_sequence_header(VC1Parser *parser, GetBitContext *gb)
+{
+    VC1PictureInfo * const seq_info = &parser->seq_info;
+    unsigned int i;
+
+    if (get_bits_left(gb) < 48)
+        return -1;
+
+    memset(seq_info, 0, sizeof(*seq_info));
+    seq_info->profile = get_bits(gb, 2);
+    if (seq_info->profile != PROFILE_ADVANCED)
+        return -1;
+    seq_info->level = get_bits(gb, 3);
+    if (get_bits(gb, 2) != 1)           // COLORDIFF_FORMAT, only 4:2:0
+        return -1;
+    skip_bits(gb, 3 + 5);               // FRMRTQ_POSTPROC, BITRTQ_POSTPROC
+    parser->postprocflag = get_bits1(gb);
+    seq_info->width  = (get_bits(gb, 12) + 1) << 1;
+    seq_info->height = (get_bits(gb, 12) + 1) << 1;
+#define READ(field) \
+    seq_info->sequence_fields.bits.field = get_bits1(gb)
+    READ(pulldown);
+    READ(interlace);
+    READ(tfcntrflag);
+    READ(finterpflag);
+    skip_bits(gb, 1);                   // reserved
+    READ(psf);
+#undef READ
+    seq_info->sequence_fields.bits.max_b_frames = 7;
+
+    if (get_bits1(gb)) {                // DISPLAY_EXT
+        skip_bits(gb, 14 + 14);         // DISP_HORIZ_SIZE, DISP_VERT_SIZE
+        if (get_bits1(gb) && get_bits(gb, 4) == 15)
+            skip_bits(gb, 8 + 8);       // ASPECT_HORIZ_SIZE, ASPECT_VERT_SIZE
+        if (get_bits1(gb))              // FRAMERATE_FLAG
+            skip_bits(gb, get_bits1(gb) ? 16 : 8 + 4);
+        if (get_bits1(gb))              // COLOR_FORMAT_FLAG
+            skip_bits(gb, 8 + 8 + 8);
+    }
+
+    parser->hrd_num_leaky_buckets = 0;
+    if (get_bits1(gb)) {                // HRD_PARAM_FLAG
+        parser->hrd_num_leaky_buckets = get_bits(gb, 5);
+        skip_bits(gb, 4 + 4);           // BIT_RATE_EXPONENT, BUFFER_SIZE_EXPONENT
+        for (i = 0; i < parser->hrd_num_leaky_buckets; i++)
+            skip_bits(gb, 16 + 16);     // HRD_RATE, HRD_BUFFER
+    }
+    if (get_bits_left(gb) < 0)
+        return -1;
+
+    parser->has_sequence_header = 1;
+    parser->has_entry_point     = 0;
+    return 0;
+}
+
+static int parse_entry_point(VC1Parser *parser, GetBitContext *gb)
+{
+    VC1PictureInfo * const seq_info = &parser->seq_info;
+    unsigned int i;
+
+    if (!parser->has_sequence_header)
+        return 0;
+
+    seq_info->entrypoint_fields.bits.broken_link     = get_bits1(gb);
+    seq_info->entrypoint_fields.bits.closed_entry    = get_bits1(gb);
+    seq_info->entrypoint_fields.bits.panscan_flag    = get_bits1(gb);
+    seq_info->reference_fields.bits.reference_distance_flag = get_bits1(gb);
+    seq_info->entrypoint_fields.bits.loopfilter      = get_bits1(gb);
+    seq_info->fast_uvmc_flag                         = get_bits1(gb);
+    seq_info->mv_fields.bits.extended_mv_flag        = get_bits1(gb);
+    seq_info->pic_quantizer_fields.bits.dquant       = get_bits(gb, 2);
+    seq_info->transform_fields.bits.variable_sized_transform_flag = get_bits1(gb);
+    seq_info->sequence_fields.bits.overlap           = get_bits1(gb);
+    seq_info->pic_quantizer_fields.bits.quantizer    = get_bits(gb, 2);
+
+    for (i = 0; i < parser->hrd_num_leaky_buckets; i++)
+        skip_bits(gb, 8);               // HRD_FULL
+
+    if (get_bits1(gb)) {                // CODED_SIZE_FLAG
+        seq_info->width  = (get_bits(gb, 12) + 1) << 1;
+        seq_info->height = (get_bits(gb, 12) + 1) << 1;
+    }
+    seq_info->mv_fields.bits.extended_dmv_flag = 0;
+    if (seq_info->mv_fields.bits.extended_mv_flag)
+        seq_info->mv_fields.bits.extended_dmv_flag = get_bits1(gb);
+
+    seq_info->range_mapping_fields.value = 0;
+    if ((seq_info->range_mapping_fields.bits.luma_flag = get_bits1(gb)))
+        seq_info->range_mapping_fields.bits.luma = get_bits(gb, 3);
+    if ((seq_info->range_mapping_fields.bits.chroma_flag = get_bits1(gb)))
+        seq_info->range_mapping_fields.bits.chroma = get_bits(gb, 3);
+    if (get_bits_left(gb) < 0)
+        return -1;
+
+    parser->has_entry_point = 1;
+    return 0;
+}
+
+/* Parses the RCV file header, with STRUCT_C holding the sequence header
+   of the simple and main profiles (Annex J) */
+static int parse_rcv_header(VC1Parser *parser)
+{
+    VC1PictureInfo * const seq_info = &parser->seq_info;
+    const uint8_t * const buf = parser->buf;
+    GetBitContext gb;
+
+    init_get_bits(&gb, buf + 8, 4);
+    seq_info->profile = get_bits(&gb, 2);
+    if (seq_info->profile != PROFILE_SIMPLE && seq_info->profile != PROFILE_MAIN)
+        return -1;
+    skip_bits(&gb, 2);                  // RES_SM
+    skip_bits(&gb, 3 + 5);              // FRMRTQ_POSTPROC, BITRTQ_POSTPROC
+    seq_info->entrypoint_fields.bits.loopfilter = get_bits1(&gb);
+    parser->res_x8 = get_bits1(&gb);
+    seq_info->sequence_fields.bits.multires = get_bits1(&gb);
+    skip_bits(&gb, 1);                  // RES_FASTTX
+    seq_info->fast_uvmc_flag = get_bits1(&gb);
+    seq_info->mv_fields.bits.extended_mv_flag = get_bits1(&gb);
+    seq_info->pic_quantizer_fields.bits.dquant = get_bits(&gb, 2);
+    seq_info->transform_fields.bits.variable_sized_transform_flag = get_bits1(&gb);
+    skip_bits(&gb, 1);                  // RES_TRANSTAB
+    seq_info->sequence_fields.bits.overlap      = get_bits1(&gb);
+    seq_info->sequence_fields.bits.syncmarker   = get_bits1(&gb);
+    seq_info->sequence_fields.bits.rangered     = get_bits1(&gb);
+    seq_info->sequence_fields.bits.max_b_frames = get_bits(&gb, 3);
+    seq_info->pic_quantizer_fields.bits.quantizer = get_bits(&gb, 2);
+    seq_info->sequence_fields.bits.finterpflag  = get_bits1(&gb);
+
+    /* STRUCT_A holds the size, and STRUCT_B the level */
+    seq_info->height = get_le32(buf + 12);
+    seq_info->width  = get_le32(buf + 16);
+    seq_info->level  = buf[27] >> 5;
+    if (seq_info->width == 0 || seq_info->width > 4096 ||
+        seq_info->height == 0 || seq_info->height > 4096)
+        return -1;
+
+    parser->has_sequence_header = 1;
+    parser->has_entry_point     = 1;
+    return 0;
+}
+
+/* Parses VOPDQUANT (7.1.1.31.6) */
+static void parse_vopdquant(VC1PictureInfo *pic_info, GetBitContext *gb)
+{
+    unsigned int pqdiff;
+
+    if (pic_info->pic_quantizer_fields.bits.dquant != 2) {
+        pic_info->pic_quantizer_fields.bits.dq_frame = get_bits1(gb);
+        if (!pic_info->pic_quantizer_fields.bits.dq_frame)
+            return;
+        pic_info->pic_quantizer_fields.bits.dq_profile = get_bits(gb, 2);
+        switch (pic_info->pic_quantizer_fields.bits.dq_profile) {
+        case DQPROFILE_SINGLE_EDGE:
+            pic_info->pic_quantizer_fields.bits.dq_sb_edge = get_bits(gb, 2);
+            break;
+        case DQPROFILE_DOUBLE_EDGES:
+            pic_info->pic_quantizer_fields.bits.dq_db_edge = get_bits(gb, 2);
+            break;
+        case DQPROFILE_ALL_MBS:
+            pic_info->pic_quantizer_fields.bits.dq_binary_level = get_bits1(gb);
+            if (!pic_info->pic_quantizer_fields.bits.dq_binary_level)
+                return;
+            break;
+        }
+    }
+
+    pqdiff = get_bits(gb, 3);
+    if (pqdiff == 7)
+        pic_info->pic_quantizer_fields.bits.alt_pic_quantizer = get_bits(gb, 5);
+    else
+        pic_info->pic_quantizer_fields.bits.alt_pic_quantizer =
+            pic_info->pic_quantizer_fields.bits.pic_quantizer_scale + pqdiff + 1;
+}
+
+/* Parses PQINDEX, HALFQP and PQUANTIZER */
+static int parse_quantizer(VC1PictureInfo *pic_info, GetBitContext *gb)
+{
+    unsigned int pqindex, pquant, uniform;
+
+    pqindex = get_bits(gb, 5);
+    if (pqindex == 0)
+        return -1;
+
+    pquant  = pqindex;
+    uniform = 1;
+    switch (pic_info->pic_quantizer_fields.bits.quantizer) {
+    case QUANTIZER_IMPLICIT:
+        pquant  = pquant_table[pqindex];
+        uniform = pqindex <= 8;
+        break;
+    case QUANTIZER_NON_UNIFORM:
+        uniform = 0;
+        break;
+    }
+    pic_info->pic_quantizer_fields.bits.pic_quantizer_scale = pquant;
+    if (pqindex <= 8)
+        pic_info->pic_quantizer_fields.bits.half_qp = get_bits1(gb);
+    if (pic_info->pic_quantizer_fields.bits.quantizer == QUANTIZER_EXPLICIT)
+        uniform = get_bits1(gb);
+    pic_info->pic_quantizer_fields.bits.pic_quantizer_type = uniform;
+    return 0;
+}
+
+/* Parses MVMODE, and MVMODE2 with the intensity compensation parameters.
+   Returns whether the picture has mixed motion vectors */
+static int
+parse_mv_mode(VC1PictureInfo *pic_info, unsigned int fcm, GetBitContext *gb)
+{
+    const unsigned int lowquant =
+        pic_info->pic_quantizer_fields.bits.pic_quantizer_scale <= 12;
+    unsigned int mv_mode, mv_mode2 = 0, intcompfield;
+
+    mv_mode = mv_mode_table[lowquant][get_unary0(gb, 4)];
+    if (mv_mode == MV_MODE_INTENSITY_COMP) {
+        mv_mode2 = mv_mode2_table[lowquant][get_unary0(gb, 3)];
+        intcompfield = 1;
+        if (fcm == FIELD_INTERLACE) {
+            /* 1: both fields, 00: top field only, 01: bottom field only */
+            intcompfield = get_bits1(gb) ? 3 : 1 << get_bits1(gb);
+        }
+        /* Only the parameters of the first field are passed down */
+        pic_info->luma_scale = get_bits(gb, 6);
+        pic_info->luma_shift = get_bits(gb, 6);
+        if (intcompfield == 3)
+            skip_bits(gb, 6 + 6);       // LUMSCALE2, LUMSHIFT2
+        pic_info->picture_fields.bits.intensity_compensation = 1;
+    }
+    pic_info->mv_fields.bits.mv_mode  = mv_mode;
+    pic_info->mv_fields.bits.mv_mode2 = mv_mode2;
+    return (mv_mode == MV_MODE_MIXED_MV ||
+            (mv_mode == MV_MODE_INTENSITY_COMP && mv_mode2 == MV_MODE_MIXED_MV));
+}
+
+/* Parses TTMBF and TTFRM */
+static void parse_transform_type(VC1PictureInfo *pic_info, GetBitContext *gb)
+{
+    if (!pic_info->transform_fields.bits.variable_sized_transform_flag)
+        return;
+    pic_info->transform_fields.bits.mb_level_transform_type_flag = get_bits1(gb);
+    if (pic_info->transform_fields.bits.mb_level_transform_type_flag)
+        pic_info->transform_fields.bits.frame_level_transform_type = get_bits(gb, 2);
+}
+
+/* Parses the picture layer of the simple and main profiles (7.1.1) */
+static int
+parse_picture_header_sm(VC1Parser *parser, VC1PictureInfo *pic_info,
+                        GetBitContext *gb)
+{
+    unsigned int picture_type, bfraction, mixed_mv, x8_type = 0;
+    int ret;
+
+    if (pic_info->sequence_fields.bits.finterpflag)
+        skip_bits(gb, 1);               // INTERPFRM
+    skip_bits(gb, 2);                   // FRMCNT
+    if (pic_info->sequence_fields.bits.rangered)
+        pic_info->range_reduction_frame = get_bits1(gb);
+
+    if (get_bits1(gb))
+        picture_type = P_TYPE;
+    else if (!pic_info->sequence_fields.bits.max_b_frames || get_bits1(gb))
+        picture_type = I_TYPE;
+    else
+        picture_type = B_TYPE;
+
+    if (picture_type == B_TYPE) {
+        bfraction = get_bfraction(gb);
+        if (bfraction == BFRACTION_RESERVED)
+            return -1;
+        if (bfraction == BFRACTION_BI)
+            picture_type = BI_TYPE;
+        else
+            pic_info->b_picture_fraction = bfraction;
+    }
+    if (picture_type == I_TYPE || picture_type == BI_TYPE)
+        skip_bits(gb, 7);               // BF
+    pic_info->picture_fields.bits.picture_type = picture_type;
+
+    /* Rounding control toggles on each P picture (8.3.7) */
+    if (picture_type == I_TYPE || picture_type == BI_TYPE)
+        parser->rnd = 1;
+    else if (picture_type == P_TYPE)
+        parser->rnd ^= 1;
+    pic_info->rounding_control = parser->rnd;
+
+    if (parse_quantizer(pic_info, gb) < 0)
+        return -1;
+    if (pic_info->mv_fields.bits.extended_mv_flag)
+        pic_info->mv_fields.bits.extended_mv_range = get_unary(gb, 3);
+    if (pic_info->sequence_fields.bits.multires && picture_type != B_TYPE)
+        pic_info->picture_resolution_index = get_bits(gb, 2);
+
+    switch (picture_type) {
+    case I_TYPE:
+    case BI_TYPE:
+        if (parser->res_x8)
+            x8_type = get_bits1(gb);
+        break;
+    case P_TYPE:
+        mixed_mv = parse_mv_mode(pic_info, PROGRESSIVE, gb);
+        if (mixed_mv)
+            DECODE_BITPLANE(mv_type_mb, BP_MVTYPEMB);
+        DECODE_BITPLANE(skip_mb, BP_SKIPMB);
+        pic_info->mv_fields.bits.mv_table = get_bits(gb, 2);
+        pic_info->cbp_table = get_bits(gb, 2);
+        if (pic_info->pic_quantizer_fields.bits.dquant)
+            parse_vopdquant(pic_info, gb);
+        parse_transform_type(pic_info, gb);
+        break;
+    case B_TYPE:
+        pic_info->mv_fields.bits.mv_mode =
+            get_bits1(gb) ? MV_MODE_1MV : MV_MODE_1MV_HPEL_BILIN;
+        DECODE_BITPLANE(direct_mb, BP_DIRECTMB);
+        DECODE_BITPLANE(skip_mb, BP_SKIPMB);
+        pic_info->mv_fields.bits.mv_table = get_bits(gb, 2);
+        pic_info->cbp_table = get_bits(gb, 2);
+        if (pic_info->pic_quantizer_fields.bits.dquant)
+            parse_vopdquant(pic_info, gb);
+        parse_transform_type(pic_info, gb);
+        break;
+    }
+
+    if (!x8_type) {
+        pic_info->transform_fields.bits.transform_ac_codingset_idx1 = decode012(gb);
+        if (picture_type == I_TYPE || picture_type == BI_TYPE)
+            pic_info->transform_fields.bits.transform_ac_codingset_idx2 = decode012(gb);
+        pic_info->transform_fields.bits.intra_transform_dc_table = get_bits1(gb);
+    }
+    return get_bits_left(gb) < 0 ? -1 : 0;
+}
+
+/* Parses the advanced profile picture layer from PQINDEX onwards, which
+   is all the header of the second field of a frame */
+static int
+parse_picture_layer(VC1Parser *parser, VC1PictureInfo *pic_info,
+                    GetBitContext *gb)
+{
+    const unsigned int fcm = pic_info->picture_fields.bits.frame_coding_mode;
+    unsigned int picture_type = pic_info->picture_fields.bits.picture_type;
+    unsigned int mixed_mv;
+    int ret;
+
+    if (parse_quantizer(pic_info, gb) < 0)
+        return -1;
+    if (parser->postprocflag)
+        pic_info->post_processing = get_bits(gb, 2);
+
+    switch (picture_type) {
+    case I_TYPE:
+    case BI_TYPE:
+        if (fcm == FRAME_INTERLACE)
+            DECODE_BITPLANE(field_tx, BP_FIELDTX);
+        DECODE_BITPLANE(ac_pred, BP_ACPRED);
+        if (pic_info->sequence_fields.bits.overlap &&
+            pic_info->pic_quantizer_fields.bits.pic_quantizer_scale <= 8) {
+            pic_info->conditional_overlap_flag = decode012(gb);
+            if (pic_info->conditional_overlap_flag == 2)
+                DECODE_BITPLANE(overflags, BP_OVERFLAGS);
+        }
+        break;
+    case P_TYPE:
+        if (fcm == FIELD_INTERLACE) {
+            pic_info->reference_fields.bits.num_reference_pictures = get_bits1(gb);
+            if (!pic_info->reference_fields.bits.num_reference_pictures)
+                pic_info->reference_fields.bits.reference_field_pic_indicator = get_bits1(gb);
+        }
+        if (pic_info->mv_fields.bits.extended_mv_flag)
+            pic_info->mv_fields.bits.extended_mv_range = get_unary(gb, 3);
+        if (fcm != PROGRESSIVE && pic_info->mv_fields.bits.extended_dmv_flag)
+            pic_info->mv_fields.bits.extended_dmv_range = get_unary(gb, 3);
+
+        switch (fcm) {
+        case PROGRESSIVE:
+            mixed_mv = parse_mv_mode(pic_info, fcm, gb);
+            if (mixed_mv)
+                DECODE_BITPLANE(mv_type_mb, BP_MVTYPEMB);
+            DECODE_BITPLANE(skip_mb, BP_SKIPMB);
+            pic_info->mv_fields.bits.mv_table = get_bits(gb, 2);
+            pic_info->cbp_table = get_bits(gb, 2);
+            break;
+        case FRAME_INTERLACE:
+            pic_info->mv_fields.bits.four_mv_switch = get_bits1(gb);
+            if (get_bits1(gb)) {        // INTCOMP
+                pic_info->picture_fields.bits.intensity_compensation = 1;
+                pic_info->luma_scale = get_bits(gb, 6);
+                pic_info->luma_shift = get_bits(gb, 6);
+            }
+            DECODE_BITPLANE(skip_mb, BP_SKIPMB);
+            pic_info->mb_mode_table = get_bits(gb, 2);
+            pic_info->mv_fields.bits.mv_table = get_bits(gb, 2);
+            pic_info->cbp_table = get_bits(gb, 3);
+            pic_info->mv_fields.bits.two_mv_block_pattern_table = get_bits(gb, 2);
+            if (pic_info->mv_fields.bits.four_mv_switch)
+                pic_info->mv_fields.bits.four_mv_block_pattern_table = get_bits(gb, 2);
+            break;
+        case FIELD_INTERLACE:
+            mixed_mv = parse_mv_mode(pic_info, fcm, gb);
+            pic_info->mb_mode_table = get_bits(gb, 3);
+            pic_info->mv_fields.bits.mv_table =
+                get_bits(gb, 2 + pic_info->reference_fields.bits.num_reference_pictures);
+            pic_info->cbp_table = get_bits(gb, 3);
+            if (mixed_mv)
+                pic_info->mv_fields.bits.four_mv_block_pattern_table = get_bits(gb, 2);
+            break;
+        }
+        if (pic_info->pic_quantizer_fields.bits.dquant)
+            parse_vopdquant(pic_info, gb);
+        parse_transform_type(pic_info, gb);
+        break;
+    case B_TYPE:
+        if (fcm == FRAME_INTERLACE) {
+            pic_info->b_picture_fraction = get_bfraction(gb);
+            if (pic_info->b_picture_fraction >= BFRACTION_RESERVED)
+                return -1;
+        }
+        if (pic_info->mv_fields.bits.extended_mv_flag)
+            pic_info->mv_fields.bits.extended_mv_range = get_unary(gb, 3);
+        if (fcm != PROGRESSIVE && pic_info->mv_fields.bits.extended_dmv_flag)
+            pic_info->mv_fields.bits.extended_dmv_range = get_unary(gb, 3);
+
+        switch (fcm) {
+        case PROGRESSIVE:
+            pic_info->mv_fields.bits.mv_mode =
+                get_bits1(gb) ? MV_MODE_1MV : MV_MODE_1MV_HPEL_BILIN;
+            DECODE_BITPLANE(direct_mb, BP_DIRECTMB);
+            DECODE_BITPLANE(skip_mb, BP_SKIPMB);
+            pic_info->mv_fields.bits.mv_table = get_bits(gb, 2);
+            pic_info->cbp_table = get_bits(gb, 2);
+            break;
+        case FRAME_INTERLACE:
+            skip_bits(gb, 1);           // INTCOMP, always 0
+            DECODE_BITPLANE(direct_mb, BP_DIRECTMB);
+            DECODE_BITPLANE(skip_mb, BP_SKIPMB);
+            pic_info->mb_mode_table = get_bits(gb, 2);
+            pic_info->mv_fields.bits.mv_table = get_bits(gb, 2);
+            pic_info->cbp_table = get_bits(gb, 3);
+            pic_info->mv_fields.bits.two_mv_block_pattern_table = get_bits(gb, 2);
+            pic_info->mv_fields.bits.four_mv_block_pattern_table = get_bits(gb, 2);
+            break;
+        case FIELD_INTERLACE:
+            pic_info->mv_fields.bits.mv_mode = mv_mode2_table[
+                pic_info->pic_quantizer_fields.bits.pic_quantizer_scale <= 12][
+                get_unary0(gb, 3)];
+            DECODE_BITPLANE(forward_mb, BP_FORWARDMB);
+            pic_info->mb_mode_table = get_bits(gb, 3);
+            pic_info->mv_fields.bits.mv_table = get_bits(gb, 3);
+            pic_info->cbp_table = get_bits(gb, 3);
+            if (pic_info->mv_fields.bits.mv_mode == MV_MODE_MIXED_MV)
+                pic_info->mv_fields.bits.four_mv_block_pattern_table = get_bits(gb, 2);
+            pic_info->reference_fields.bits.num_reference_pictures = 1;
+            break;
+        }
+        if (pic_info->pic_quantizer_fields.bits.dquant)
+            parse_vopdquant(pic_info, gb);
+        parse_transform_type(pic_info, gb);
+        break;
+    }
+
+    pic_info->transform_fields.bits.transform_ac_codingset_idx1 = decode012(gb);
+    if (picture_type == I_TYPE || picture_type == BI_TYPE)
+        pic_info->transform_fields.bits.transform_ac_codingset_idx2 = decode012(gb);
+    pic_info->transform_fields.bits.intra_transform_dc_table = get_bits1(gb);
+    if ((picture_type == I_TYPE || picture_type == BI_TYPE) &&
+        pic_info->pic_quantizer_fields.bits.dquant)
+        parse_vopdquant(pic_info, gb);
+    return get_bits_left(gb) < 0 ? -1 : 0;
+}
+
+/* Parses an advanced profile picture header (7.1.1), up to the picture
+   layer */
+static int
+parse_picture_header_adv(VC1Parser *parser, VC1PictureInfo *pic_info,
+                         GetBitContext *gb)
+{
+    const unsigned int interlace = pic_info->sequence_fields.bits.interlace;
+    unsigned int fcm, picture_type, bfraction, rff = 0, rptfrm = 0, n;
+
+    fcm = interlace ? decode012(gb) : PROGRESSIVE;
+    if (fcm == FIELD_INTERLACE) {
+        parser->fptype = get_bits(gb, 3);
+        picture_type = fptype_table[parser->fptype][0];
+    }
+    else {
+        static const uint8_t ptype_table[5] = {
+            P_TYPE, B_TYPE, I_TYPE, BI_TYPE, SKIPPED_TYPE
+        };
+        picture_type = ptype_table[get_unary(gb, 4)];
+    }
+    pic_info->picture_fields.bits.frame_coding_mode = fcm;
+    pic_info->picture_fields.bits.picture_type      = picture_type;
+
+    if (pic_info->sequence_fields.bits.tfcntrflag)
+        skip_bits(gb, 8);               // TFCNTR
+    if (pic_info->sequence_fields.bits.pulldown) {
+        if (!interlace || pic_info->sequence_fields.bits.psf)
+            rptfrm = get_bits(gb, 2);
+        else {
+            pic_info->picture_fields.bits.top_field_first = get_bits1(gb);
+            rff = get_bits1(gb);
+        }
+    }
+    else if (interlace)
+        pic_info->picture_fields.bits.top_field_first = 1;
+
+    if (pic_info->entrypoint_fields.bits.panscan_flag && get_bits1(gb)) {
+        if (interlace && !pic_info->sequence_fields.bits.psf)
+            n = 2 + rff;
+        else
+            n = 1 + rptfrm;
+        skip_bits_long(gb, n * (18 + 18 + 14 + 14));
+    }
+    if (picture_type == SKIPPED_TYPE)
+        return get_bits_left(gb) < 0 ? -1 : 0;
+
+    pic_info->rounding_control = get_bits1(gb);
+    if (interlace)
+        skip_bits(gb, 1);               // UVSAMP
+
+    if (fcm == FIELD_INTERLACE) {
+        /* Keep the distance of the last anchor pictures for B-fields */
+        if (pic_info->reference_fields.bits.reference_distance_flag &&
+            picture_type != B_TYPE && picture_type != BI_TYPE) {
+            parser->refdist = get_bits(gb, 2);
+            if (parser->refdist == 3)
+                parser->refdist += get_unary(gb, 13);
+        }
+        pic_info->reference_fields.bits.reference_distance = parser->refdist;
+        if (picture_type == B_TYPE || picture_type == BI_TYPE) {
+            pic_info->b_picture_fraction = get_bfraction(gb);
+            if (pic_info->b_picture_fraction >= BFRACTION_RESERVED)
+                return -1;
+        }
+    }
+    else if (fcm == PROGRESSIVE) {
+        if (pic_info->sequence_fields.bits.finterpflag)
+            skip_bits(gb, 1);           // INTERPFRM
+        if (picture_type == B_TYPE) {
+            bfraction = get_bfraction(gb);
+            if (bfraction == BFRACTION_RESERVED)
+                return -1;
+            if (bfraction == BFRACTION_BI)
+                pic_info->picture_fields.bits.picture_type = BI_TYPE;
+            else
+                pic_info->b_picture_fraction = bfraction;
+        }
+    }
+    return parse_picture_layer(parser, pic_info, gb);
+}
+
+static int
+add_slice(VC1Parser *parser, VC1Picture *picture, size_t offset,
+          unsigned int size, unsigned int macroblock_offset,
+          unsigned int slice_vertical_position)
+{
+    VC1SliceInfo *slice;
+
+    parser->slices = fast_realloc(parser->slices, &parser->slices_size,
+                                  (picture->slice_count + 1) * sizeof(*slice));
+    if (!parser->slices)
+        return -1;
+
+    slice = &parser->slices[picture->slice_count++];
+    slice->slice_data_offset       = offset;
+    slice->slice_data_size         = size;
+    slice->macroblock_offset       = macroblock_offset;
+    slice->slice_vertical_position = slice_vertical_position;
+    picture->slices = parser->slices;
+    return 0;
+}
+
+/* Parses a frame or a field BDU, at the start of a picture. Macroblock
+   offsets count the start code, and no emulation prevention bytes */
+static int
+parse_frame(VC1Parser *parser, VC1Picture *picture, size_t offset,
+            unsigned int size, unsigned int is_second_field)
 {
+    VC1PictureInfo * const pic_info = &picture->pic_info;
+    const VC1PictureInfo * const first_field = &parser->first_field;
+    unsigned int is_field;
+    GetBitContext gb;
+
+    if (load_header(parser, &gb, parser->buf + offset + 4, size - 4) < 0)
+        return -1;
+
+    /* Fields have half as many macroblock rows, and an FCM of 11 */
+    is_field = is_second_field ||
+        (parser->seq_info.sequence_fields.bits.interlace && show_bits(&gb, 2) == 3);
+    if (init_picture(parser, picture, is_field) < 0)
+        return -1;
+
+    if (!is_second_field) {
+        if (parse_picture_header_adv(parser, pic_info, &gb) < 0)
+            return -1;
+        parser->first_field = *pic_info;
+        parser->second_field_pending = is_field;
+    }
+    else {
+        /* The second field shares the frame-level part of the header */
+        pic_info->picture_fields.bits.frame_coding_mode = FIELD_INTERLACE;
+        pic_info->picture_fields.bits.picture_type =
+            fptype_table[parser->fptype][1];
+        pic_info->picture_fields.bits.top_field_first =
+            first_field->picture_fields.bits.top_field_first;
+        pic_info->picture_fields.bits.is_first_field = 0;
+        pic_info->rounding_control = first_field->rounding_control;
+        pic_info->reference_fields.bits.reference_distance =
+            first_field->reference_fields.bits.reference_distance;
+        pic_info->b_picture_fraction = first_field->b_picture_fraction;
+        if (parse_picture_layer(parser, pic_info, &gb) < 0)
+            return -1;
+        parser->second_field_pending = 0;
+    }
+    return add_slice(parser, picture, offset, size, 32 + get_bits_count(&gb), 0);
+}
+
+static int
+parse_slice(VC1Parser *parser, VC1Picture *picture, size_t offset,
+            unsigned int size)
+{
+    VC1PictureInfo pic_info;
+    GetBitContext gb;
+    unsigned int slice_addr;
+
+    if (load_header(parser, &gb, parser->buf + offset + 4, size - 4) < 0)
+        return -1;
+
+    slice_addr = get_bits(&gb, 9);
+    if (get_bits1(&gb)) {               // PIC_HEADER_FLAG
+        /* The repeated header matches the one of the picture */
+        pic_info = parser->seq_info;
+        if (picture->pic_info.picture_fields.bits.is_first_field) {
+            if (parse_picture_header_adv(parser, &pic_info, &gb) < 0)
+                return -1;
+        }
+        else {
+            pic_info = picture->pic_info;
+            if (parse_picture_layer(parser, &pic_info, &gb) < 0)
+                return -1;
+        }
+    }
+    if (get_bits_left(&gb) < 0)
+        return -1;
+    return add_slice(parser, picture, offset, size, 32 + get_bits_count(&gb),
+                     slice_addr);
+}
+
+/* Assigns the frame and its reference frames, in decoding order */
+static void update_references(VC1Parser *parser, VC1Picture *picture)
+{
+    const VC1PictureInfo * const pic_info = &picture->pic_info;
+    const unsigned int picture_type = pic_info->picture_fields.bits.picture_type;
+    const unsigned int is_first_field =
+        pic_info->picture_fields.bits.frame_coding_mode != FIELD_INTERLACE ||
+        pic_info->picture_fields.bits.is_first_field;
+
+    if (is_first_field) {
+        picture->frame_num = parser->num_frames++;
+        switch (picture_type) {
+        case I_TYPE:
+        case P_TYPE:
+        case SKIPPED_TYPE:
+            parser->forward_reference  = (picture_type != I_TYPE ?
+                                          parser->future_reference : -1);
+            parser->backward_reference = -1;
+            parser->past_reference     = parser->future_reference;
+            parser->future_reference   = picture->frame_num;
+            break;
+        default:
+            parser->forward_reference  = parser->past_reference;
+            parser->backward_reference = parser->future_reference;
+            break;
+        }
+    }
+    else
+        picture->frame_num = parser->num_frames - 1;
+
+    picture->forward_reference  = parser->forward_reference;
+    picture->backward_reference = parser->backward_reference;
+
+    /* The second field of a P-frame may refer to the first one */
+    if (!is_first_field && picture_type == P_TYPE)
+        picture->forward_reference = picture->frame_num;
+
+    /* Intra fields need no reference, whatever the other field is */
+    if (picture_type == I_TYPE || picture_type == BI_TYPE) {
+        picture->forward_reference  = -1;
+        picture->backward_reference = -1;
+    }
+}
+
+/* Parses the next frame of an RCV file */
+static int get_picture_rcv(VC1Parser *parser, VC1Picture *picture)
+{
+    const uint8_t * const buf = parser->buf;
+    size_t offset;
+    unsigned int frame_size;
+    GetBitContext gb;
+
+    if (parser->pos + RCV_FRAME_HEADER_SIZE > parser->size)
+        return 0;
+
+    frame_size = get_le32(buf + parser->pos) & 0x00ffffff;
+    offset     = parser->pos + RCV_FRAME_HEADER_SIZE;
+    if (frame_size > parser->size - offset)
+        return -1;
+    parser->pos = offset + frame_size;
+
+    if (init_picture(parser, picture, 0) < 0)
+        return -1;
+
+    /* Empty frames repeat the previous one */
+    if (frame_size <= 1) {
+        picture->pic_info.picture_fields.bits.picture_type = SKIPPED_TYPE;
+        return 1;
+    }
+
+    init_get_bits(&gb, buf + offset, frame_size);
+    if (parse_picture_header_sm(parser, &picture->pic_info, &gb) < 0)
+        return -1;
+    if (add_slice(parser, picture, offset, frame_size, get_bits_count(&gb), 0) < 0)
+        return -1;
+    return 1;
+}
+
+/* Parses the BDUs of the next picture, or field */
+static int get_picture_adv(VC1Parser *parser, VC1Picture *picture)
+{
+    const uint8_t * const buf = parser->buf;
+    const size_t size = parser->size;
+    size_t pos, next;
+    unsigned int code;
+    int ret, in_picture = 0;
+    GetBitContext gb;
+
+    pos = startcode_find(buf, parser->pos, size);
+    for (; pos + 4 <= size; pos = next) {
+        next = startcode_find(buf, pos + 3, size);
+        code = buf[pos + 3];
+
+        /* A picture ends at the next BDU other than a slice or user data */
+        if (in_picture && code != SLICE_CODE && (code < 0x1b || code > 0x1f))
+            break;
+
+        switch (code) {
+        case SEQUENCE_HEADER_CODE:
+        case ENTRY_POINT_CODE:
+            if (load_header(parser, &gb, buf + pos + 4, next - pos - 4) < 0)
+                return -1;
+            if (code == SEQUENCE_HEADER_CODE)
+                ret = parse_sequence_header(parser, &gb);
+            else
+                ret = parse_entry_point(parser, &gb);
+            if (ret < 0)
+                return -1;
+            parser->second_field_pending = 0;
+            break;
+        case FRAME_CODE:
+            if (!parser->has_entry_point)
+                break;
+            if (parse_frame(parser, picture, pos, next - pos, 0) < 0)
+                return -1;
+            in_picture = 1;
+            break;
+        case FIELD_CODE:
+            if (!parser->second_field_pending)
+                break;
+            if (parse_frame(parser, picture, pos, next - pos, 1) < 0)
+                return -1;
+            in_picture = 1;
+            break;
+        case SLICE_CODE:
+            if (in_picture && parse_slice(parser, picture, pos, next - pos) < 0)
+                return -1;
+            break;
+        }
+    }
+    parser->pos = pos;
+    return in_picture;
+}
+
+VC1Parser *vc1_parser_new(const uint8_t *buf, size_t size)
+{
+    VC1Parser *parser;
+
+    init_tables();
+
+    parser = calloc(1, sizeof(*parser));
+    if (!parser)
+        return NULL;
+
+    parser->buf              = buf;
+    parser->size             = size;
+    parser->past_reference   = -1;
+    parser->future_reference = -1;
+
+    /* RCV files start with the number of frames and a 0xc5 marker */
+    if (size >= RCV_HEADER_SIZE && buf[3] == 0xc5 &&
+        get_le32(buf + 4) == 4 && get_le32(buf + 20) == 12) {
+        parser->is_rcv = 1;
+        parser->pos    = RCV_HEADER_SIZE;
+        if (parse_rcv_header(parser) < 0) {
+            D(bug("unsupported RCV file\n"));
+            vc1_parser_destroy(parser);
+            return NULL;
+        }
+    }
+    return parser;
+}
+
+void vc1_parser_destroy(VC1Parser *parser)
+{
+    if (!parser)
+        return;
+
+    free(parser->header);
+    free(parser->plane);
+    free(parser->mb_flags);
+    free(parser->bitplane);
+    free(parser->slices);
+    free(parser);
+}
+
+int vc1_parser_get_picture(VC1Parser *parser, VC1Picture *picture)
+{
+    int ret;
+
+    input_release(parser->buf + parser->pos);
+
+    if (parser->is_rcv)
+        ret = get_picture_rcv(parser, picture);
+    else
+        ret = get_picture_adv(parser, picture);
+    if (ret <= 0)
+        return ret;
+
+    if (pack_bitplanes(parser, picture) < 0)
+        return -1;
+    update_references(parser, picture);
+    return 1;
+}
+
+/* Parses the first picture of the video data, only once */
+static const VC1Picture *get_picture(void)
+{
+    static VC1Parser *parser;
+    static VC1Picture picture;
+    const uint8_t *data;
+    size_t size;
+
+    if (!parser) {
+        vc1_get_video_data(&data, &size);
+        parser = vc1_parser_new(data, size);
+        if (!parser || vc1_parser_get_picture(parser, &picture) != 1) {
+            D(bug("failed to parse the first VC-1 picture\n"));
+            memset(&picture, 0, sizeof(picture));
+        }
+    }
+    return &picture;
+}
+
+void vc1_get_video_data(const uint8_t **data, size_t *size)
+{
+    if (input_get_data(data, size))
+        return;
     *data = vc1_clip;
     *size = VC1_CLIP_DATA_SIZE;
 }
 
 void vc1_get_picture_info(VC1PictureInfo *pic_info)
 {
-    memcpy(pic_info, &vc1_pic_info, sizeof(*pic_info));
+    memcpy(pic_info, &get_picture()->pic_info, sizeof(*pic_info));
 }
 
 void vc1_get_bitplane(const uint8_t **data, unsigned int *size)
 {
-    *data = vc1_bitplane;
-    *size = VC1_CLIP_BITPLANE_SIZE;
+    const VC1Picture * const picture = get_picture();
+
+    *data = picture->bitplane;
+    *size = picture->bitplane_size;
 }
 
 int vc1_get_slice_count(void)
 {
-    return VC1_CLIP_SLICE_COUNT;
+    return get_picture()->slice_count;
 }
 
 int vc1_get_slice_info(int slice, VC1SliceInfo *slice_info)
 {
-    if (slice < 0 || slice >= VC1_CLIP_SLICE_COUNT)
+    const VC1Picture * const picture = get_picture();
+
+    if (slice < 0 || slice >= (int)picture->slice_count)
         return -1;
-    memcpy(slice_info, &vc1_slice_info[slice], sizeof(*slice_info));
+    memcpy(slice_info, &picture->slices[slice], sizeof(*slice_info));
     return 0;
 }
 
 int vc1_get_slice_data(int slice, const uint8_t **data, unsigned int *size)
 {
-    const VC1SliceInfo *slice_info;
-    if (slice < 0 || slice >= VC1_CLIP_SLICE_COUNT)
+    const VC1Picture * const picture = get_picture();
+    const uint8_t *video_data;
+    size_t video_data_size;
+
+    if (slice < 0 || slice >= (int)picture->slice_count)
         return -1;
-    slice_info = &vc1_slice_info[slice];
-    *data = &vc1_clip[VC1_CLIP_SLICE_OFFSET + slice_info->slice_data_offset];
-    *size = slice_info->slice_data_size;
+    vc1_get_video_data(&video_data, &video_data_size);
+    *data = video_data + picture->slices[slice].slice_data_offset;
+    *size = picture->slices[slice].slice_data_size;
     return 0;
 }
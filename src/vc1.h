@@ -23,6 +23,8 @@
 
 typedef struct _VC1PictureInfo VC1PictureInfo;
 typedef struct _VC1SliceInfo   VC1SliceInfo;
+typedef struct _VC1Picture     VC1Picture;
+typedef struct _VC1Parser      VC1Parser;
 
 struct _VC1PictureInfo {
     unsigned char       profile;
@@ -162,12 +164,39 @@ struct _VC1PictureInfo {
 
 struct _VC1SliceInfo {
     unsigned int        slice_data_size;
-    unsigned int        slice_data_offset;
+    size_t              slice_data_offset;
     unsigned int        macroblock_offset;
     int                 slice_vertical_position;
 };
 
-void vc1_get_video_data(const uint8_t **data, unsigned int *size);
+// A picture, or a field, with slices in decoding order. Reference
+// pictures are identified by the decoding order number of their frame,
+// or -1 if they are missing
+struct _VC1Picture {
+    VC1PictureInfo      pic_info;
+    const uint8_t      *bitplane;       // VA API layout, or NULL if none
+    unsigned int        bitplane_size;
+    VC1SliceInfo       *slices;         // offsets are relative to the stream
+    unsigned int        slice_count;
+    unsigned int        frame_num;      // decoding order of the frame
+    int                 forward_reference;
+    int                 backward_reference;
+};
+
+// Creates a parser over the SIZE bytes of an RCV file (simple and main
+// profiles) or of an advanced profile elementary stream in BUF, which
+// must outlive the parser
+VC1Parser *vc1_parser_new(const uint8_t *buf, size_t size);
+void vc1_parser_destroy(VC1Parser *parser);
+
+// Parses the next picture. Returns 1 if PICTURE was filled in, 0 at the
+// end of the stream, or -1 on error. PICTURE->slices and
+// PICTURE->bitplane remain valid until the next call
+int vc1_parser_get_picture(VC1Parser *parser, VC1Picture *picture);
+
+void vc1_get_video_data(const uint8_t **data, size_t *size);
+
+// Accessors to the first picture of the video data
 void vc1_get_picture_info(VC1PictureInfo *pic_info);
 void vc1_get_bitplane(const uint8_t **data, unsigned int *size);
 int vc1_get_slice_count(void);
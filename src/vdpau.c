@@ -785,7 +785,7 @@ static int vdpau_decode_to_image(void)
 
     VdpYCbCrFormat ycbcr_format = VDP_INVALID_HANDLE;
     VdpStatus status;
-    Image *image = NULL;
+    Image *image = NULL, *src_image, view_image;
     uint32_t image_format;
     int i, error = -1;
 
@@ -831,7 +831,17 @@ static int vdpau_decode_to_image(void)
     if (!vdpau_check_status(status, "VdpVideoSurfaceGetBitsYCbCr()"))
         goto end;
 
-    if (image_convert(common->image, image) < 0)
+    src_image = image;
+    if (common->use_getimage_rect) {
+        Rectangle * const img_rect = &common->getimage_rect;
+        if (image_view(&view_image, image,
+                       img_rect->x, img_rect->y,
+                       img_rect->width, img_rect->height) < 0)
+            goto end;
+        src_image = &view_image;
+    }
+
+    if (getimage_convert(common->image, src_image) < 0)
         goto end;
 
     error = 0;
@@ -927,15 +937,77 @@ static const VdpRGBAFormat bitmap_formats[] = {
     VDP_INVALID_HANDLE
 };
 
+/* Blends the overlay into the video surface pixels on the CPU, for
+   implementations without suitable bitmap surface formats */
+static int blend_image_cpu(Image *src_img)
+{
+    VDPAUContext * const vdpau = vdpau_get_context();
+    VDPAUSurface * const surface = &vdpau->video_surface;
+    VdpYCbCrFormat ycbcr_format = VDP_INVALID_HANDLE;
+    VdpStatus status;
+    Image *image = NULL;
+    uint32_t image_format;
+    int i, error = -1;
+
+    for (i = 0; ycbcr_formats[i] != VDP_INVALID_HANDLE; i++) {
+        const VdpYCbCrFormat format = ycbcr_formats[i];
+        if (vdpau_is_supported_ycbcr_format(vdpau->device, format)) {
+            ycbcr_format = format;
+            break;
+        }
+    }
+    if (ycbcr_format == VDP_INVALID_HANDLE)
+        goto end;
+
+    image_format = image_get_yuv_format(ycbcr_format);
+    if (!image_format)
+        goto end;
+    D(bug("blending into %s image on the CPU\n",
+          string_of_FOURCC(image_format)));
+
+    image = image_create(surface->width, surface->height, image_format);
+    if (!image)
+        goto end;
+
+    status = vdpau_video_surface_get_bits_ycbcr(
+        surface->vdp_surface,
+        ycbcr_format,
+        image->pixels,
+        image->pitches
+    );
+    if (!vdpau_check_status(status, "VdpVideoSurfaceGetBitsYCbCr()"))
+        goto end;
+
+    if (image_blend(image, src_img, NULL, NULL, 255) < 0)
+        goto end;
+
+    status = vdpau_video_surface_put_bits_ycbcr(
+        surface->vdp_surface,
+        ycbcr_format,
+        image->pixels,
+        image->pitches
+    );
+    if (!vdpau_check_status(status, "VdpVideoSurfacePutBitsYCbCr()"))
+        goto end;
+
+    error = 0;
+end:
+    if (image)
+        image_destroy(image);
+    return error;
+}
+
 static int blend_image(Image *src_img)
 {
     CommonContext * const common = common_get_context();
     VDPAUContext * const vdpau = vdpau_get_context();
     VdpRGBAFormat bitmap_format = VDP_INVALID_HANDLE;
+    VDPAUSurface *surface;
     VdpStatus status;
     Image *image = NULL;
+    Rectangle *rects, *dirty_rects = NULL, full_rect;
     uint32_t image_format;
-    int i, error = -1;
+    int i, n_rects, error = -1;
 
     if (!common)
         return -1;
@@ -960,6 +1032,10 @@ static int blend_image(Image *src_img)
                 break;
             }
         }
+        if (bitmap_format == VDP_INVALID_HANDLE) {
+            D(bug("no suitable bitmap format, blending on the CPU\n"));
+            return blend_image_cpu(src_img);
+        }
     }
     if (bitmap_format == VDP_INVALID_HANDLE)
         goto end;
@@ -970,40 +1046,84 @@ static int blend_image(Image *src_img)
     D(bug("selected %s image format for putimage in blend mode\n",
           string_of_FOURCC(image_format)));
 
+    /* Surfaces are kept across frames, and then only receive the
+       modified tiles of the overlay */
+    surface = common->vdpau_layers ? &vdpau->subpic_surface : &vdpau->bitmap_surface;
+    if (surface->vdp_surface != VDP_INVALID_HANDLE &&
+        surface->width  == src_img->width &&
+        surface->height == src_img->height) {
+        n_rects = image_get_dirty_rects(src_img, &dirty_rects);
+        if (n_rects < 0)
+            goto end;
+        if (n_rects == 0)
+            return 0;
+        rects = dirty_rects;
+    }
+    else {
+        destroy_output_surface(vdpau, &vdpau->subpic_surface);
+        destroy_bitmap_surface(vdpau, &vdpau->bitmap_surface);
+
+        if (common->vdpau_layers) {
+            if (create_output_surface(vdpau, surface,
+                                      src_img->width, src_img->height) < 0)
+                goto end;
+        }
+        else {
+            if (create_bitmap_surface(vdpau, surface,
+                                      src_img->width, src_img->height) < 0)
+                goto end;
+        }
+        full_rect.x      = 0;
+        full_rect.y      = 0;
+        full_rect.width  = src_img->width;
+        full_rect.height = src_img->height;
+        rects   = &full_rect;
+        n_rects = 1;
+    }
+
     image = image_create(src_img->width, src_img->height, image_format);
     if (!image)
         goto end;
 
-    if (image_convert(image, src_img) < 0)
-        goto end;
-
-    if (common->vdpau_layers) {
-        if (create_output_surface(vdpau, &vdpau->subpic_surface,
-                                  src_img->width, src_img->height) < 0)
-            goto end;
-
-        status = vdpau_output_surface_put_bits_native(
-            vdpau->subpic_surface.vdp_surface,
-            image->pixels,
-            image->pitches,
-            NULL
-        );
-        if (!vdpau_check_status(status, "VdpOutputSurfacePutBitsNative()"))
+    if (rects == dirty_rects) {
+        if (image_convert_dirty(image, src_img) < 0)
             goto end;
     }
     else {
-        if (create_bitmap_surface(vdpau, &vdpau->bitmap_surface,
-                                  src_img->width, src_img->height) < 0)
+        if (image_convert(image, src_img) < 0)
             goto end;
+    }
 
-        status = vdpau_bitmap_surface_put_bits_native(
-            vdpau->bitmap_surface.vdp_surface,
-            image->pixels,
-            image->pitches,
-            NULL
-        );
-        if (!vdpau_check_status(status, "VdpBitmapSurfacePutBitsNative()"))
-            goto end;
+    for (i = 0; i < n_rects; i++) {
+        const Rectangle * const r = &rects[i];
+        uint8_t *pixels = image->pixels[0] + r->y * image->pitches[0] + r->x * 4;
+        VdpRect vdp_rect;
+
+        vdp_rect.x0 = r->x;
+        vdp_rect.y0 = r->y;
+        vdp_rect.x1 = r->x + r->width;
+        vdp_rect.y1 = r->y + r->height;
+
+        if (common->vdpau_layers) {
+            status = vdpau_output_surface_put_bits_native(
+                surface->vdp_surface,
+                &pixels,
+                image->pitches,
+                &vdp_rect
+            );
+            if (!vdpau_check_status(status, "VdpOutputSurfacePutBitsNative()"))
+                goto end;
+        }
+        else {
+            status = vdpau_bitmap_surface_put_bits_native(
+                surface->vdp_surface,
+                &pixels,
+                image->pitches,
+                &vdp_rect
+            );
+            if (!vdpau_check_status(status, "VdpBitmapSurfacePutBitsNative()"))
+                goto end;
+        }
     }
 
     error = 0;
@@ -1014,6 +1134,7 @@ end:
     }
     if (image)
         image_destroy(image);
+    free(dirty_rects);
     return error;
 }
 
@@ -1136,14 +1257,19 @@ static int render_cliprects(
     VdpVideoMixerParameter params[VDPAU_MAX_PARAMS];
     const void *param_values[VDPAU_MAX_PARAMS];
     VdpStatus status;
+    Image *mask_image = NULL;
+    Rectangle *mask_rects = NULL, surface_rect;
     unsigned int n_params = 0;
     unsigned int i, error = 1;
+    float sx, sy;
 
     if (!common->use_clipping)
         return 0;
 
     if (create_video_surface(vdpau, &video_surface, 160, 120, chroma_type) < 0)
         return -1;
+    sx = (float)video_surface.width  / (float)render_width;
+    sy = (float)video_surface.height / (float)render_height;
 
     params[n_params]         = VDP_VIDEO_MIXER_PARAMETER_VIDEO_SURFACE_WIDTH;
     param_values[n_params++] = &video_surface.width;
@@ -1161,17 +1287,48 @@ static int render_cliprects(
     if (!vdpau_check_status(status, "VdpVideoMixerCreate()"))
         goto end;
 
-    if (put_image(common->cliprects_image, &video_surface) < 0)
+    /* Rasterize the source mask at the video surface size, rather than
+       scaling down the window-sized cliprects image */
+    mask_rects = malloc(common->cliprects_count * sizeof(*mask_rects));
+    if (!mask_rects)
         goto end;
 
     for (i = 0; i < common->cliprects_count; i++) {
         Rectangle * const rect = &common->cliprects[i];
-        const float sx = (float)video_surface.width  / (float)render_width;
-        const float sy = (float)video_surface.height / (float)render_height;
-        source_rect.x0  = sx * (float)rect->x;
-        source_rect.y0  = sy * (float)rect->y;
-        source_rect.x1  = source_rect.x0 + sx * (float)rect->width;
-        source_rect.y1  = source_rect.y0 + sy * (float)rect->height;
+        source_rect.x0 = sx * (float)rect->x;
+        source_rect.y0 = sy * (float)rect->y;
+        source_rect.x1 = source_rect.x0 + sx * (float)rect->width;
+        source_rect.y1 = source_rect.y0 + sy * (float)rect->height;
+        mask_rects[i].x      = source_rect.x0;
+        mask_rects[i].y      = source_rect.y0;
+        mask_rects[i].width  = source_rect.x1 - source_rect.x0;
+        mask_rects[i].height = source_rect.y1 - source_rect.y0;
+    }
+
+    mask_image = image_create(video_surface.width, video_surface.height,
+                              IMAGE_RGB32);
+    if (!mask_image)
+        goto end;
+
+    surface_rect.x      = 0;
+    surface_rect.y      = 0;
+    surface_rect.width  = video_surface.width;
+    surface_rect.height = video_surface.height;
+    if (image_fill_rects(mask_image, &surface_rect, 1, 0xffffffff) < 0)
+        goto end;
+    if (image_fill_rects(mask_image, mask_rects, common->cliprects_count,
+                         0xffff5400) < 0)
+        goto end;
+
+    if (put_image(mask_image, &video_surface) < 0)
+        goto end;
+
+    for (i = 0; i < common->cliprects_count; i++) {
+        Rectangle * const rect = &common->cliprects[i];
+        source_rect.x0  = mask_rects[i].x;
+        source_rect.y0  = mask_rects[i].y;
+        source_rect.x1  = source_rect.x0 + mask_rects[i].width;
+        source_rect.y1  = source_rect.y0 + mask_rects[i].height;
         output_rect.x0  = rect->x;
         output_rect.y0  = rect->y;
         output_rect.x1  = output_rect.x0 + rect->width;
@@ -1210,6 +1367,10 @@ end:
             error = 1;
     }
 
+    if (mask_image)
+        image_destroy(mask_image);
+    free(mask_rects);
+
     if (error)
         return -1;
     return 0;
@@ -1229,11 +1390,7 @@ static int vdpau_display(void)
         return -1;
 
     if (putimage_mode() != PUTIMAGE_NONE) {
-        Image *img;
-        img = image_generate(
-            common->putimage_size.width,
-            common->putimage_size.height
-        );
+        Image * const img = putimage_get_image();
         if (img) {
             switch (putimage_mode()) {
             case PUTIMAGE_OVERRIDE:
@@ -1247,7 +1404,7 @@ static int vdpau_display(void)
             default:
                 break;
             }
-            image_destroy(img);
+            image_clear_dirty(img);
         }
     }
 
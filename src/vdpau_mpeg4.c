@@ -150,8 +150,9 @@ int decode(void)
 
     MPEG4PictureInfo mpeg4_pic_info;
     MPEG4IQMatrix mpeg4_iq_matrix;
-    const uint8_t *mpeg4_slice_data;
+    const uint8_t *mpeg4_slice_data, *mpeg4_slice_end;
     unsigned int mpeg4_slice_data_size;
+    int slice_count;
 
     if (!vdpau)
         return -1;
@@ -206,17 +207,18 @@ int decode(void)
     if (append_picture_header(&mpeg4_pic_info) < 0)
         return -1;
 
-    for (i = 0; i < mpeg4_get_slice_count(); i++) {
-        if (mpeg4_get_slice_data(i, &mpeg4_slice_data, &mpeg4_slice_data_size) < 0)
-            return -1;
-        /* The first byte was merged with the header */
-        if (i == 0) {
-            ++mpeg4_slice_data;
-            --mpeg4_slice_data_size;
-        }
-        if (vdpau_append_slice_data(mpeg4_slice_data, mpeg4_slice_data_size) < 0)
-            return -1;
-    }
+    /* VDPAU parses video packet headers itself, so pass the VOP data
+       from the first slice to the end of the last one. The first byte
+       was merged with the header */
+    slice_count = mpeg4_get_slice_count();
+    if (mpeg4_get_slice_data(slice_count - 1, &mpeg4_slice_data, &mpeg4_slice_data_size) < 0)
+        return -1;
+    mpeg4_slice_end = mpeg4_slice_data + mpeg4_slice_data_size;
+    if (mpeg4_get_slice_data(0, &mpeg4_slice_data, &mpeg4_slice_data_size) < 0)
+        return -1;
+    ++mpeg4_slice_data;
+    if (vdpau_append_slice_data(mpeg4_slice_data, mpeg4_slice_end - mpeg4_slice_data) < 0)
+        return -1;
 
     return vdpau_decode();
 }
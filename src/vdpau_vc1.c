@@ -26,6 +26,7 @@ int decode(void)
 {
     VDPAUContext * const vdpau = vdpau_get_context();
     VdpPictureInfoVC1 *pic_info;
+    VdpDecoderProfile profile;
     int i, picture_type;
 
     VC1PictureInfo vc1_pic_info;
@@ -37,7 +38,14 @@ int decode(void)
 
     vc1_get_picture_info(&vc1_pic_info);
 
-    if (vdpau_init_decoder(VDP_DECODER_PROFILE_VC1_ADVANCED,
+    switch (vc1_pic_info.profile) {
+    case 0: profile = VDP_DECODER_PROFILE_VC1_SIMPLE;   break;
+    case 1: profile = VDP_DECODER_PROFILE_VC1_MAIN;     break;
+    case 3: profile = VDP_DECODER_PROFILE_VC1_ADVANCED; break;
+    default: return -1;
+    }
+
+    if (vdpau_init_decoder(profile,
                            vc1_pic_info.width, vc1_pic_info.height) < 0)
         return -1;
 